@@ -0,0 +1,60 @@
+# !/usr/bin/env python3
+"""
+Reader of the binary time series files (.bin) written by the observed and reduced quantity recordings.
+The file header gives the precision, the column names and the number of components of each column,
+followed by raw rows of the time and all column components.
+"""
+import struct
+import sys
+
+
+class TimeSeries:
+    def __init__(self, file_path: str) -> None:
+        with open(file_path, "rb") as file:
+            data = file.read()
+        if data[:8] != b"SPHTSv1\0":
+            raise ValueError(f"{file_path} is not a time series file")
+        real_size, number_of_columns = struct.unpack_from("<II", data, 8)
+        offset = 16
+        self.column_names = []
+        self.column_components = []
+        for _ in range(number_of_columns):
+            (name_size,) = struct.unpack_from("<I", data, offset)
+            offset += 4
+            self.column_names.append(data[offset:offset + name_size].decode())
+            offset += name_size
+            (components,) = struct.unpack_from("<i", data, offset)
+            offset += 4
+            self.column_components.append(components)
+
+        row_size = 1 + sum(self.column_components)
+        row_format = "<" + ("f" if real_size == 4 else "d") * row_size
+        row_bytes = struct.calcsize(row_format)
+        number_of_rows = (len(data) - offset) // row_bytes  # an incomplete last row is discarded
+        self.rows = [struct.unpack_from(row_format, data, offset + i * row_bytes) for i in range(number_of_rows)]
+        self.times = [row[0] for row in self.rows]
+
+    def column(self, name: str) -> list:
+        """values of a column as rows * components"""
+        index = self.column_names.index(name)
+        first = 1 + sum(self.column_components[:index])
+        return [list(row[first:first + self.column_components[index]]) for row in self.rows]
+
+    def write_to_dat(self, dat_file_path: str) -> None:
+        """write in the text format of the former .dat files"""
+        header = ['"run_time"']
+        for name, components in zip(self.column_names, self.column_components):
+            if components == 1:
+                header.append(f'"{name}"')
+            else:
+                header.extend(f'"{name}[{i}]"' for i in range(components))
+        with open(dat_file_path, "w") as file:
+            file.write("   ".join(header) + "   \n")
+            for row in self.rows:
+                file.write(f"{row[0]}   " + "".join(f"{value:.9f}   " for value in row[1:]) + "\n")
+
+
+if __name__ == "__main__":
+    # convert the given .bin files to .dat files
+    for bin_file_path in sys.argv[1:]:
+        TimeSeries(bin_file_path).write_to_dat(bin_file_path[:-len(".bin")] + ".dat")
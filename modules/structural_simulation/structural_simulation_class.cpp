@@ -385,6 +385,17 @@ void StructuralSimulation::initializeAllContacts()
         int body_2 = time_dep_contacting_body_pairs_list_[i].first[1];
         initializeContactBetweenTwoBodies(body_1, body_2); // vector with first element being array with indices
     }
+    // the broad phase skips the contact between bodies far from each other
+    RealBodyVector all_bodies = {};
+    for (size_t i = 0; i < solid_body_list_.size(); i++)
+    {
+        all_bodies.push_back(solid_body_list_[i]->getSolidBodyFromMesh());
+    }
+    contact_broad_phase_ = makeShared<ContactBroadPhase>(all_bodies);
+    for (size_t i = 0; i < contact_list_.size(); i++)
+    {
+        contact_broad_phase_->subscribeRelation(*contact_list_[i]);
+    }
 }
 
 void StructuralSimulation::initializeGravity()
@@ -663,6 +674,9 @@ void StructuralSimulation::executeContactDensitySummation()
     size_t number_of_general_contacts = contacting_body_pairs_list_.size();
     for (size_t i = 0; i < contact_density_list_.size(); i++)
     {
+        if (!contact_list_[i]->hasActiveContact())
+            continue;
+
         if (i < number_of_general_contacts)
         {
             contact_density_list_[i]->exec();
@@ -688,6 +702,9 @@ void StructuralSimulation::executeContactForce()
     size_t number_of_general_contacts = contacting_body_pairs_list_.size();
     for (size_t i = 0; i < contact_force_list_.size(); i++)
     {
+        if (!contact_list_[i]->hasActiveContact())
+            continue;
+
         if (i < number_of_general_contacts)
         {
             contact_force_list_[i]->exec();
@@ -791,6 +808,7 @@ void StructuralSimulation::executeContactUpdateConfiguration()
 {
     // number of contacts that are not time dependent: contact pairs * 2
     size_t number_of_general_contacts = contacting_body_pairs_list_.size();
+    contact_broad_phase_->update();
     for (size_t i = 0; i < contact_list_.size(); i++)
     {
         // general contacts = contacting_bodies * 2
@@ -207,6 +207,7 @@ class StructuralSimulation
     StdVec<SharedPtr<SurfaceContactRelation>> contact_list_;
     StdVec<SharedPtr<InteractionDynamics<solid_dynamics::ContactDensitySummation>>> contact_density_list_;
     StdVec<SharedPtr<InteractionDynamics<solid_dynamics::ContactForce>>> contact_force_list_;
+    SharedPtr<ContactBroadPhase> contact_broad_phase_;
 
     // for initializeATimeStep
     StdVec<Gravity> gravity_list_;
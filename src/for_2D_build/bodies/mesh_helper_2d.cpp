@@ -1,6 +1,8 @@
 #include "mesh_helper.h"
 
 #include "base_particle_dynamics.h"
+#include "particle_functors.h"
+#include "particle_iterators.h"
 namespace SPH
 {
 //=================================================================================================//
@@ -152,43 +154,18 @@ size_t MeshFileHelpers::findBoundaryType(std::string &text_line, size_t boundary
 //=================================================================================================//
 Vecd MeshFileHelpers::nodeIndex(std::string &text_line)
 {
-    /*--- find the node1 between two cells ---*/
-    std::string node1_string_copy = text_line;
-    size_t first_divide_position = text_line.find_first_of(" ", 0);
-    std::string node1_index_string = node1_string_copy.erase(first_divide_position);
-    size_t node1_index_decimal = stoi(node1_index_string, nullptr, 16) - 1;
-
-    /*--- find the node2 between two cells---*/
-    std::string node2_string = text_line;
-    node2_string = node2_string.erase(0, first_divide_position + 1);
-    size_t second_divide_position = node2_string.find_first_of(" ", 0);
-    node2_string.erase(second_divide_position);
-    size_t node2_index_decimal = stoi(node2_string, nullptr, 16) - 1;
-    Vecd nodes = Vecd(node1_index_decimal, node2_index_decimal);
-    return nodes;
+    /*--- the two nodes between two cells ---*/
+    size_t values[4] = {0, 0, 0, 0};
+    hexIntegers(text_line, values, 4);
+    return Vecd(values[0] - 1, values[1] - 1);
 }
 //=================================================================================================//
 Vec2d MeshFileHelpers::cellIndex(std::string &text_line)
 {
-
-    /*--- find the cell1---*/
-    std::string cell1_string = text_line;
-    size_t first_divide_position = text_line.find_first_of(" ", 0);
-    cell1_string = cell1_string.erase(0, first_divide_position + 1);
-    size_t second_divide_position = cell1_string.find_first_of(" ", 0);
-    cell1_string = cell1_string.erase(0, second_divide_position + 1);
-    size_t third_divide_position = cell1_string.find_first_of(" ", 0);
-    cell1_string.erase(third_divide_position);
-    size_t cell1_index_decimal = std::stoi(cell1_string, nullptr, 16);
-
-    /*--- find the cell2---*/
-    std::string cell2_string = text_line;
-    cell2_string = cell2_string.erase(0, first_divide_position + 1);
-    cell2_string = cell2_string.erase(0, second_divide_position + 1);
-    cell2_string.erase(0, third_divide_position + 1);
-    size_t cell2_index_decimal = stoi(cell2_string, nullptr, 16);
-    Vecd cells = Vecd(cell1_index_decimal, cell2_index_decimal);
-    return cells;
+    /*--- the two cells sharing the face ---*/
+    size_t values[4] = {0, 0, 0, 0};
+    hexIntegers(text_line, values, 4);
+    return Vec2d(values[2], values[3]);
 }
 //=================================================================================================//
 void MeshFileHelpers::updateElementsNodesConnection(StdLargeVec<StdVec<size_t>> &elements_nodes_connection_,
@@ -329,26 +306,23 @@ void MeshFileHelpers::elementVolume(StdLargeVec<StdVec<size_t>> &elements_nodes_
     elements_volumes_[element] = element_volume;
 }
 //=================================================================================================//
-void MeshFileHelpers::minimumDistance(StdVec<Real> &all_data_of_distance_between_nodes,
-                                      StdLargeVec<Real> &elements_volumes_, StdVec<StdVec<StdVec<size_t>>> &mesh_topology_,
+Real MeshFileHelpers::minimumDistance(StdLargeVec<Real> &elements_volumes_, StdVec<StdVec<StdVec<size_t>>> &mesh_topology_,
                                       StdLargeVec<Vecd> &node_coordinates_)
 {
-
-    for (size_t element_index = 0; element_index != elements_volumes_.size(); ++element_index)
-    {
-
-        for (std::size_t neighbor = 0; neighbor != mesh_topology_[element_index].size(); ++neighbor)
+    return particle_reduce(
+        ParallelPolicy(), IndexRange(0, elements_volumes_.size()), ReduceMin().reference_, ReduceMin(),
+        [&](size_t element_index) -> Real
         {
-
-            size_t interface_node1_index = mesh_topology_[element_index][neighbor][2];
-            size_t interface_node2_index = mesh_topology_[element_index][neighbor][3];
-            Vecd node1_position = node_coordinates_[interface_node1_index];
-            Vecd node2_position = node_coordinates_[interface_node2_index];
-            Vecd interface_area_vector = node1_position - node2_position;
-            Real interface_area_size = interface_area_vector.norm();
-            all_data_of_distance_between_nodes.push_back(interface_area_size);
-        }
-    }
+            Real element_minimum = MaxReal;
+            for (std::size_t neighbor = 0; neighbor != mesh_topology_[element_index].size(); ++neighbor)
+            {
+                size_t interface_node1_index = mesh_topology_[element_index][neighbor][2];
+                size_t interface_node2_index = mesh_topology_[element_index][neighbor][3];
+                Vecd interface_area_vector = node_coordinates_[interface_node1_index] - node_coordinates_[interface_node2_index];
+                element_minimum = SMIN(element_minimum, interface_area_vector.norm());
+            }
+            return element_minimum;
+        });
 }
 //=================================================================================================//
 } // namespace SPH
@@ -13,6 +13,21 @@ ANSYSMesh::ANSYSMesh(const std::string &full_path)
     getMinimumDistanceBetweenNodes();
 }
 //=================================================================================================//
+ANSYSMesh::ANSYSMesh(SPHSystem &sph_system, const std::string &full_path)
+{
+    if (sph_system.MeshCache() && sph_system.hasIOEnvironment())
+    {
+        mesh_cache_folder_ = sph_system.getIOEnvironment().cache_folder_ + "/mesh";
+        if (readMeshCache(full_path))
+            return;
+    }
+
+    getDataFromMeshFile(full_path);
+    getElementCenterCoordinates();
+    getMinimumDistanceBetweenNodes();
+    writeMeshCache(full_path);
+}
+//=================================================================================================//
 void ANSYSMesh::getDataFromMeshFile(const std::string &full_path)
 {
     std::ifstream mesh_file; /*!< \brief File object for the Ansys ASCII mesh file. */
@@ -115,18 +130,12 @@ void ANSYSMesh::getElementCenterCoordinates()
 //=================================================================================================//
 void ANSYSMesh::getMinimumDistanceBetweenNodes()
 {
-    StdVec<Real> all_data_of_distance_between_nodes;
-    all_data_of_distance_between_nodes.resize(0);
-    MeshFileHelpers::minimumDistance(all_data_of_distance_between_nodes, elements_volumes_, mesh_topology_, node_coordinates_);
-    auto min_distance_iter = std::min_element(all_data_of_distance_between_nodes.begin(), all_data_of_distance_between_nodes.end());
-    if (min_distance_iter != all_data_of_distance_between_nodes.end())
-    {
-        min_distance_between_nodes_ = *min_distance_iter;
-    }
-    else
+    if (elements_volumes_.empty())
     {
         std::cout << "The array of all distance between nodes is empty " << std::endl;
+        return;
     }
+    min_distance_between_nodes_ = MeshFileHelpers::minimumDistance(elements_volumes_, mesh_topology_, node_coordinates_);
 }
 //=================================================================================================//
 void BaseInnerRelationInFVM::resetNeighborhoodCurrentSize()
@@ -227,6 +236,7 @@ void InnerRelationInFVM::updateConfiguration()
     searchNeighborsByParticles(base_particles_.TotalRealParticles(),
                                base_particles_, inner_configuration_,
                                get_particle_index_, get_inner_neighbor_);
+    updateFaceList();
 }
 //=============================================================================================//
 } // namespace SPH
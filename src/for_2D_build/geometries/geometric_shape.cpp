@@ -1,5 +1,7 @@
 #include "geometric_shape.h"
 
+#include "data_hash.h"
+
 namespace SPH
 {
 //=================================================================================================//
@@ -31,6 +33,11 @@ BoundingBox GeometricShapeBox::findBounds()
     return BoundingBox(-halfsize_, halfsize_);
 }
 //=================================================================================================//
+uint64_t GeometricShapeBox::getGeometryHash()
+{
+    return DataHash().add(std::string("GeometricShapeBox")).add(halfsize_).Value();
+}
+//=================================================================================================//
 GeometricShapeBall::GeometricShapeBall(const Vec2d &center, Real radius,
                                        const std::string &shape_name)
     : Shape(shape_name), center_(center), radius_(radius) {}
@@ -55,4 +62,9 @@ BoundingBox GeometricShapeBall::findBounds()
     return BoundingBox(center_ - shift, center_ + shift);
 }
 //=================================================================================================//
+uint64_t GeometricShapeBall::getGeometryHash()
+{
+    return DataHash().add(std::string("GeometricShapeBall")).add(center_).add(radius_).Value();
+}
+//=================================================================================================//
 } // namespace SPH
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "multi_polygon_shape.h"
 
+#include "data_hash.h"
+
 using namespace boost::geometry;
 
 namespace SPH
@@ -284,4 +286,29 @@ BoundingBox MultiPolygonShape::findBounds()
     return multi_polygon_.findBounds();
 }
 //=================================================================================================//
+uint64_t MultiPolygonShape::getGeometryHash()
+{
+    DataHash geometry_hash;
+    geometry_hash.add(std::string("MultiPolygonShape"));
+    auto add_ring = [&](const boost_poly::ring_type &ring)
+    {
+        geometry_hash.add(ring.size());
+        for (const auto &point : ring)
+        {
+            geometry_hash.add(Vec2d(point.x(), point.y()));
+        }
+    };
+
+    for (const auto &polygon : multi_polygon_.getBoostMultiPoly())
+    {
+        add_ring(polygon.outer());
+        geometry_hash.add(polygon.inners().size());
+        for (const auto &inner_ring : polygon.inners())
+        {
+            add_ring(inner_ring);
+        }
+    }
+    return geometry_hash.Value();
+}
+//=================================================================================================//
 } // namespace SPH
\ No newline at end of file
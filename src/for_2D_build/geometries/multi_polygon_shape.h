@@ -109,6 +109,8 @@ class MultiPolygonShape : public Shape
     virtual bool isValid() override;
     virtual bool checkContain(const Vecd &probe_point, bool BOUNDARY_INCLUDED = true) override;
     virtual Vecd findClosestPoint(const Vecd &probe_point) override;
+    /** hashed from the points of all rings of the polygons */
+    virtual uint64_t getGeometryHash() override;
 
   protected:
     MultiPolygon multi_polygon_;
@@ -17,15 +17,19 @@
 namespace SPH
 {
 //=================================================================================================//
-template <class DynamicsRange, typename GetSearchDepth, typename GetNeighborRelation>
+template <class DynamicsRange, typename GetSearchDepth, typename GetNeighborRelation, typename CheckSearchCandidate>
 void CellLinkedList::searchNeighborsByParticles(
     DynamicsRange &dynamics_range, ParticleConfiguration &particle_configuration,
-    GetSearchDepth &get_search_depth, GetNeighborRelation &get_neighbor_relation)
+    GetSearchDepth &get_search_depth, GetNeighborRelation &get_neighbor_relation,
+    CheckSearchCandidate &check_search_candidate)
 {
     StdLargeVec<Vecd> &pos = dynamics_range.getBaseParticles().ParticlePositions();
     particle_for(execution::ParallelPolicy(), dynamics_range.LoopRange(),
                  [&](size_t index_i)
                  {
+                     if (!check_search_candidate(index_i, pos[index_i]))
+                         return;
+
                      int search_depth = get_search_depth(index_i);
                      Array2i target_cell_index = CellIndexFromPosition(pos[index_i]);
 
@@ -44,4 +48,21 @@ void CellLinkedList::searchNeighborsByParticles(
                  });
 }
 //=================================================================================================//
+template <typename FunctionOnListData>
+void CellLinkedList::searchNeighborsByPosition(const Vecd &position, int search_depth,
+                                               const FunctionOnListData &function_on_list_data)
+{
+    Array2i target_cell_index = CellIndexFromPosition(position);
+    mesh_for_each(
+        Array2i::Zero().max(target_cell_index - search_depth * Array2i::Ones()),
+        all_cells_.min(target_cell_index + (search_depth + 1) * Array2i::Ones()),
+        [&](int l, int m)
+        {
+            for (const ListData &list_data : cell_data_lists_[l][m])
+            {
+                function_on_list_data(list_data);
+            }
+        });
+}
+//=================================================================================================//
 } // namespace SPH
@@ -30,8 +30,10 @@
 #define ALL_PARTICLE_GENERATORS_2D_H
 
 #include "base_particle_generator.hpp"
+#include "particle_generator_cached.h"
 #include "particle_generator_lattice.h"
 #include "particle_generator_mesh.h"
 #include "particle_generator_reserve.h"
+#include "particle_generator_shared.h"
 
 #endif // ALL_PARTICLE_GENERATORS_2D_H
\ No newline at end of file
@@ -9,25 +9,6 @@
 namespace SPH
 {
 //=================================================================================================//
-void ParticleGenerator<BaseParticles, Lattice>::prepareGeometricData()
-{
-    BaseMesh mesh(domain_bounds_, lattice_spacing_, 0);
-    Real particle_volume = lattice_spacing_ * lattice_spacing_;
-    Arrayi number_of_lattices = mesh.AllCellsFromAllGridPoints(mesh.AllGridPoints());
-    for (int i = 0; i < number_of_lattices[0]; ++i)
-        for (int j = 0; j < number_of_lattices[1]; ++j)
-        {
-            Vecd particle_position = mesh.CellPositionFromIndex(Arrayi(i, j));
-            if (initial_shape_.checkNotFar(particle_position, lattice_spacing_))
-            {
-                if (initial_shape_.checkContain(particle_position))
-                {
-                    addPositionAndVolumetricMeasure(particle_position, particle_volume);
-                }
-            }
-        }
-}
-//=================================================================================================//
 void ParticleGenerator<SurfaceParticles, Lattice>::prepareGeometricData()
 {
     // Calculate the total volume and
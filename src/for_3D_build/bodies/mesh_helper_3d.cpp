@@ -2,6 +2,8 @@
 #include "unstructured_mesh.h"
 
 #include "base_particle_dynamics.h"
+#include "particle_functors.h"
+#include "particle_iterators.h"
 namespace SPH
 {
 
@@ -161,59 +163,19 @@ size_t MeshFileHelpers::findBoundaryType(std::string &text_line, size_t boundary
 }
 
 Vecd MeshFileHelpers::nodeIndex(std::string &text_line)
-
 {
-    /*--- find the node1 between two cells ---*/
-    std::string node1_string_copy = text_line;
-    size_t first_devide_position = text_line.find_first_of(" ", 0);
-    std::string node1_index_string = node1_string_copy.erase(first_devide_position);
-    size_t node1_index_decimal = stoi(node1_index_string, nullptr, 16) - 1;
-
-    /*--- find the node2 between two cells---*/
-    std::string node2_string = text_line;
-    std::string node3_string = text_line;
-    node2_string = node2_string.erase(0, first_devide_position + 1);
-    node3_string = node2_string;
-    size_t second_devide_position = node2_string.find_first_of(" ", 0);
-    node2_string.erase(second_devide_position);
-    size_t node2_index_decimal = stoi(node2_string, nullptr, 16) - 1;
-
-    /*--- find the node3 between two cells---*/
-    node3_string = node3_string.erase(0, second_devide_position + 1);
-    size_t third_devide_position = node3_string.find_first_of(" ", 0);
-    node3_string.erase(third_devide_position);
-    size_t node3_index_decimal = stoi(node3_string, nullptr, 16) - 1;
-
-    Vecd nodes = Vecd(node1_index_decimal, node2_index_decimal, node3_index_decimal);
-    return nodes;
+    /*--- the three nodes between two cells ---*/
+    size_t values[5] = {0, 0, 0, 0, 0};
+    hexIntegers(text_line, values, 5);
+    return Vecd(values[0] - 1, values[1] - 1, values[2] - 1);
 }
 
 Vec2d MeshFileHelpers::cellIndex(std::string &text_line)
 {
-
-    /*--- find the cell1---*/
-    std::string cell1_string = text_line;
-    std::string cell2_string = text_line;
-    std::string cell3_string = text_line;
-    size_t first_devide_position = text_line.find_first_of(" ", 0);
-    cell1_string = cell1_string.erase(0, first_devide_position + 1);
-    size_t second_devide_position = cell1_string.find_first_of(" ", 0);
-    cell2_string = cell1_string.erase(0, second_devide_position + 1);
-    size_t third_devide_position = cell2_string.find_first_of(" ", 0);
-    cell3_string = cell2_string.erase(0, third_devide_position + 1);
-    size_t fourth_devide_position = cell3_string.find_first_of(" ", 0);
-    cell3_string.erase(fourth_devide_position);
-    size_t cell1_index_decimal = stoi(cell3_string, nullptr, 16);
-
-    /*--- find the cell2---*/
-    std::string cell4_string = text_line;
-    cell4_string = cell4_string.erase(0, first_devide_position + 1);
-    cell4_string = cell4_string.erase(0, second_devide_position + 1);
-    cell4_string = cell4_string.erase(0, third_devide_position + 1);
-    cell4_string.erase(0, fourth_devide_position + 1);
-    size_t cell2_index_decimal = stoi(cell4_string, nullptr, 16);
-    Vec2d cells = Vec2d(cell1_index_decimal, cell2_index_decimal);
-    return cells;
+    /*--- the two cells sharing the face ---*/
+    size_t values[5] = {0, 0, 0, 0, 0};
+    hexIntegers(text_line, values, 5);
+    return Vec2d(values[3], values[4]);
 }
 
 void MeshFileHelpers::updateElementsNodesConnection(StdLargeVec<StdVec<size_t>> &elements_nodes_connection_, Vecd nodes, Vec2d cells,
@@ -377,30 +339,27 @@ void MeshFileHelpers::elementVolume(StdLargeVec<StdVec<size_t>> &elements_nodes_
     elements_volumes_[element] = element_volume;
 }
 
-void MeshFileHelpers::minimumDistance(StdVec<Real> &all_data_of_distance_between_nodes, StdLargeVec<Real> &elements_volumes_, StdVec<StdVec<StdVec<size_t>>> &mesh_topology_,
+Real MeshFileHelpers::minimumDistance(StdLargeVec<Real> &elements_volumes_, StdVec<StdVec<StdVec<size_t>>> &mesh_topology_,
                                       StdLargeVec<Vecd> &node_coordinates_)
 {
-
-    for (size_t element_index = 0; element_index != elements_volumes_.size(); ++element_index)
-    {
-
-        for (std::size_t neighbor = 0; neighbor != mesh_topology_[element_index].size(); ++neighbor)
+    return particle_reduce(
+        ParallelPolicy(), IndexRange(0, elements_volumes_.size()), ReduceMin().reference_, ReduceMin(),
+        [&](size_t element_index) -> Real
         {
-
-            size_t interface_node1_index = mesh_topology_[element_index][neighbor][2];
-            size_t interface_node2_index = mesh_topology_[element_index][neighbor][3];
-            size_t interface_node3_index = mesh_topology_[element_index][neighbor][4];
-            Vecd node1_position = node_coordinates_[interface_node1_index];
-            Vecd node2_position = node_coordinates_[interface_node2_index];
-            Vecd node3_position = node_coordinates_[interface_node3_index];
-            Vecd interface_area_vector1 = node2_position - node1_position;
-            Vecd interface_area_vector2 = node3_position - node1_position;
-            Vecd area_vector = interface_area_vector1.cross(interface_area_vector2);
-            Real triangle_area = 0.5 * area_vector.norm();
-            Real distance = sqrt(triangle_area);
-            all_data_of_distance_between_nodes.push_back(distance);
-        }
-    }
+            Real element_minimum = MaxReal;
+            for (std::size_t neighbor = 0; neighbor != mesh_topology_[element_index].size(); ++neighbor)
+            {
+                size_t interface_node1_index = mesh_topology_[element_index][neighbor][2];
+                size_t interface_node2_index = mesh_topology_[element_index][neighbor][3];
+                size_t interface_node3_index = mesh_topology_[element_index][neighbor][4];
+                Vecd node1_position = node_coordinates_[interface_node1_index];
+                Vecd interface_area_vector1 = node_coordinates_[interface_node2_index] - node1_position;
+                Vecd interface_area_vector2 = node_coordinates_[interface_node3_index] - node1_position;
+                Real triangle_area = 0.5 * interface_area_vector1.cross(interface_area_vector2).norm();
+                element_minimum = SMIN(element_minimum, sqrt(triangle_area));
+            }
+            return element_minimum;
+        });
 }
 
 void MeshFileHelpers::vtuFileHeader(std::ofstream &out_file)
@@ -1,5 +1,7 @@
 #include "geometric_shape.h"
 
+#include "data_hash.h"
+
 namespace SPH
 {
 //=================================================================================================//
@@ -57,6 +59,11 @@ BoundingBox GeometricShapeBox::findBounds()
     return BoundingBox(-halfsize_, halfsize_);
 }
 //=================================================================================================//
+uint64_t GeometricShapeBox::getGeometryHash()
+{
+    return DataHash().add(std::string("GeometricShapeBox")).add(halfsize_).Value();
+}
+//=================================================================================================//
 GeometricShapeBall::
     GeometricShapeBall(const Vecd &center, const Real &radius, const std::string &shape_name)
     : GeometricShape(shape_name), center_(center), sphere_(radius)
@@ -85,4 +92,10 @@ BoundingBox GeometricShapeBall::findBounds()
     return BoundingBox(center_ - shift, center_ + shift);
 }
 //=================================================================================================//
+uint64_t GeometricShapeBall::getGeometryHash()
+{
+    Real radius = sphere_.getRadius();
+    return DataHash().add(std::string("GeometricShapeBall")).add(center_).add(radius).Value();
+}
+//=================================================================================================//
 } // namespace SPH
\ No newline at end of file
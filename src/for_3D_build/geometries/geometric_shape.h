@@ -61,6 +61,7 @@ class GeometricShapeBox : public GeometricShape
 
     virtual bool checkContain(const Vec3d &probe_point, bool BOUNDARY_INCLUDED = true) override;
     virtual Vec3d findClosestPoint(const Vec3d &probe_point) override;
+    virtual uint64_t getGeometryHash() override;
 
   protected:
     Vecd halfsize_;
@@ -81,6 +82,7 @@ class GeometricShapeBall : public GeometricShape
 
     virtual bool checkContain(const Vec3d &probe_point, bool BOUNDARY_INCLUDED = true) override;
     virtual Vec3d findClosestPoint(const Vec3d &probe_point) override;
+    virtual uint64_t getGeometryHash() override;
 
   protected:
     virtual BoundingBox findBounds() override;
@@ -2,6 +2,8 @@
 
 #include "image_shape.h"
 
+#include "data_hash.h"
+
 namespace SPH
 {
 //=================================================================================================//
@@ -34,6 +36,16 @@ BoundingBox ImageShape::findBounds()
     return image_->findBounds();
 }
 //=================================================================================================//
+uint64_t ImageShape::getGeometryHash()
+{
+    BoundingBox bounds = image_->findBounds();
+    DataHash geometry_hash;
+    geometry_hash.add(std::string("ImageShape")).add(bounds.first_).add(bounds.second_);
+    geometry_hash.add(translation_).add(rotation_).add(image_->get_size());
+    geometry_hash.addBytes(image_->get_data(), sizeof(float) * image_->get_size());
+    return geometry_hash.Value();
+}
+//=================================================================================================//
 ImageShapeFromFile::
     ImageShapeFromFile(const std::string &file_path_name, const std::string &shape_name)
     : ImageShape(shape_name)
@@ -41,6 +53,17 @@ ImageShapeFromFile::
     image_.reset(new ImageMHD<float, 3>(file_path_name));
 }
 //=================================================================================================//
+ImageShapeFromSegmentation::
+    ImageShapeFromSegmentation(const std::string &file_path_name, int label, const std::string &shape_name)
+    : ImageShape(shape_name)
+{
+    image_.reset(new ImageMHD<float, 3>(file_path_name));
+    if (label == 0)
+        image_->convertMaskToSignedDistance(0.5);
+    else
+        image_->convertLabelToSignedDistance(float(label));
+}
+//=================================================================================================//
 ImageShapeSphere::
     ImageShapeSphere(Real radius, Vecd spacings, Vecd center, const std::string &shape_name)
     : ImageShape(shape_name)
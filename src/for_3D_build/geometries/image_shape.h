@@ -51,6 +51,8 @@ class ImageShape : public Shape
 
     virtual bool checkContain(const Vecd &probe_point, bool BOUNDARY_INCLUDED = true) override;
     virtual Vecd findClosestPoint(const Vecd &probe_point) override;
+    /** hashed from the image data and its placement */
+    virtual uint64_t getGeometryHash() override;
 
   protected:
     Vecd translation_;
@@ -70,6 +72,20 @@ class ImageShapeFromFile : public ImageShape
     virtual ~ImageShapeFromFile(){};
 };
 
+/**
+ * @class ImageShapeFromSegmentation
+ * @brief Shape from a segmentation (binary mask or label) image,
+ * which is converted into a signed-distance image by an exact Euclidean distance transform.
+ * With the default label 0, all non-zero voxels are taken as inside.
+ */
+class ImageShapeFromSegmentation : public ImageShape
+{
+  public:
+    explicit ImageShapeFromSegmentation(const std::string &file_path_name, int label = 0,
+                                        const std::string &shape_name = "ImageShapeFromSegmentation");
+    virtual ~ImageShapeFromSegmentation(){};
+};
+
 class ImageShapeSphere : public ImageShape
 {
   public:
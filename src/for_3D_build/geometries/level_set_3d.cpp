@@ -13,13 +13,18 @@ LevelSet::LevelSet(BoundingBox tentative_bounds, Real data_spacing,
                    Shape &shape, SPHAdaptation &sph_adaptation)
     : LevelSet(tentative_bounds, data_spacing, 4, shape, sph_adaptation)
 {
-    mesh_parallel_for(MeshRange(Arrayi::Zero(), all_cells_),
-                      [&](size_t i, size_t j, size_t k)
-                      {
-                          initializeDataInACell(Arrayi(i, j, k));
-                      });
+    initializeCacheKey("Coarsest");
+    if (!readFromCache())
+    {
+        mesh_parallel_for(MeshRange(Arrayi::Zero(), all_cells_),
+                          [&](size_t i, size_t j, size_t k)
+                          {
+                              initializeDataInACell(Arrayi(i, j, k));
+                          });
 
-    finishDataPackages();
+        finishDataPackages();
+        writeToCache();
+    }
 }
 //=================================================================================================//
 void LevelSet::initializeDataForSingularPackage(const size_t package_index, Real far_field_level_set)
@@ -57,11 +62,7 @@ void LevelSet::finishDataPackages()
     initializeDataForSingularPackage(0, -far_field_distance);
     initializeDataForSingularPackage(1, far_field_distance);
 
-    package_parallel_for(
-        [&](size_t package_index)
-        {
-            initializeBasicDataForAPackage(meta_data_cell_[package_index].first, package_index, shape_);
-        });
+    initializeBasicDataForPackages(shape_);
 
     updateLevelSetGradient();
     updateKernelIntegrals();
@@ -243,17 +244,55 @@ void LevelSet::markNearInterface(Real small_shift_factor)
         });
 }
 //=================================================================================================//
-void LevelSet::initializeBasicDataForAPackage(const Arrayi &cell_index, const size_t package_index, Shape &shape)
+void LevelSet::initializeBasicDataForPackages(Shape &shape)
 {
-    auto &phi = phi_.DataField()[package_index];
-    auto &near_interface_id = near_interface_id_.DataField()[package_index];
-    for_each_cell_data(
-        [&](int i, int j, int k)
-        {
-            Vec3d position = DataPositionFromIndex(cell_index, Array3i(i, j, k));
-            phi[i][j][k] = shape.findSignedDistance(position);
-            near_interface_id[i][j][k] = phi[i][j][k] < 0.0 ? -2 : 2;
-        });
+    // batch queries on chunks of packages, which bounds the memory for the probe positions
+    const size_t chunk_size = 4096;
+    const size_t package_data_size = pkg_size * pkg_size * pkg_size;
+    StdVec<Vecd> positions;
+    StdVec<Real> signed_distances;
+    for (size_t chunk_begin = 2; chunk_begin < num_grid_pkgs_; chunk_begin += chunk_size)
+    {
+        size_t chunk_end = SMIN(chunk_begin + chunk_size, num_grid_pkgs_);
+        positions.resize((chunk_end - chunk_begin) * package_data_size);
+        parallel_for(
+            IndexRange(chunk_begin, chunk_end),
+            [&](const IndexRange &r)
+            {
+                for (size_t package_index = r.begin(); package_index != r.end(); ++package_index)
+                {
+                    Arrayi cell_index = meta_data_cell_[package_index].first;
+                    size_t data_index = (package_index - chunk_begin) * package_data_size;
+                    for_each_cell_data(
+                        [&](int i, int j, int k)
+                        {
+                            positions[data_index++] = DataPositionFromIndex(cell_index, Array3i(i, j, k));
+                        });
+                }
+            },
+            ap);
+
+        shape.findSignedDistances(positions, signed_distances);
+
+        parallel_for(
+            IndexRange(chunk_begin, chunk_end),
+            [&](const IndexRange &r)
+            {
+                for (size_t package_index = r.begin(); package_index != r.end(); ++package_index)
+                {
+                    auto &phi = phi_.DataField()[package_index];
+                    auto &near_interface_id = near_interface_id_.DataField()[package_index];
+                    size_t data_index = (package_index - chunk_begin) * package_data_size;
+                    for_each_cell_data(
+                        [&](int i, int j, int k)
+                        {
+                            phi[i][j][k] = signed_distances[data_index++];
+                            near_interface_id[i][j][k] = phi[i][j][k] < 0.0 ? -2 : 2;
+                        });
+                }
+            },
+            ap);
+    }
 }
 //=================================================================================================//
 void LevelSet::redistanceInterfaceForAPackage(const size_t package_index)
@@ -505,13 +544,18 @@ RefinedLevelSet::RefinedLevelSet(BoundingBox tentative_bounds, LevelSet &coarse_
                                  Shape &shape, SPHAdaptation &sph_adaptation)
     : RefinedMesh(tentative_bounds, coarse_level_set, 4, shape, sph_adaptation)
 {
-    mesh_parallel_for(MeshRange(Arrayi::Zero(), all_cells_),
-                      [&](size_t i, size_t j, size_t k)
-                      {
-                          initializeDataInACellFromCoarse(Arrayi(i, j, k));
-                      });
+    initializeCacheKey(coarse_level_set.CacheKey());
+    if (!readFromCache())
+    {
+        mesh_parallel_for(MeshRange(Arrayi::Zero(), all_cells_),
+                          [&](size_t i, size_t j, size_t k)
+                          {
+                              initializeDataInACellFromCoarse(Arrayi(i, j, k));
+                          });
 
-    finishDataPackages();
+        finishDataPackages();
+        writeToCache();
+    }
 }
 //=============================================================================================//
 } // namespace SPH
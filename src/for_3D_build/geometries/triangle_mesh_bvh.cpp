@@ -0,0 +1,498 @@
+#include "triangle_mesh_bvh.h"
+
+#include <algorithm>
+#include <array>
+#include <map>
+
+namespace SPH
+{
+//=================================================================================================//
+void TriangleMeshBVH::build(const StdVec<Vec3d> &vertices, const StdVec<Array3i> &faces)
+{
+    size_t number_of_faces = faces.size();
+    nodes_.clear();
+    faces_.clear();
+    face_indices_.clear();
+    face_normals_.clear();
+    is_closed_ = false;
+    // no hierarchy for an empty mesh, as its root would have inverted bounds
+    if (number_of_faces == 0)
+        return;
+
+    StdVec<Vec3d> face_lower(number_of_faces), face_upper(number_of_faces), face_centroid(number_of_faces);
+    face_indices_.resize(number_of_faces);
+    for (size_t i = 0; i != number_of_faces; ++i)
+    {
+        const Vec3d &a = vertices[faces[i][0]];
+        const Vec3d &b = vertices[faces[i][1]];
+        const Vec3d &c = vertices[faces[i][2]];
+        face_lower[i] = a.cwiseMin(b).cwiseMin(c);
+        face_upper[i] = a.cwiseMax(b).cwiseMax(c);
+        face_centroid[i] = (a + b + c) / 3.0;
+        face_indices_[i] = (int)i;
+    }
+
+    // a binary tree with n leaves has 2n-1 nodes at most
+    nodes_.reserve(2 * number_of_faces + 1);
+    nodes_.push_back(Node{Vec3d::Zero(), Vec3d::Zero(), 0, number_of_faces});
+    StdVec<std::pair<size_t, size_t>> building_stack; // node index and depth
+    building_stack.push_back(std::make_pair(0, 0));
+    // limit the depth so that the traversal stack of the queries has a fixed size
+    const size_t max_depth = 48;
+
+    while (!building_stack.empty())
+    {
+        size_t node_index = building_stack.back().first;
+        size_t depth = building_stack.back().second;
+        building_stack.pop_back();
+        size_t first = nodes_[node_index].first_;
+        size_t number = nodes_[node_index].number_;
+
+        Vec3d lower = MaxReal * Vec3d::Ones();
+        Vec3d upper = -MaxReal * Vec3d::Ones();
+        Vec3d centroid_lower = MaxReal * Vec3d::Ones();
+        Vec3d centroid_upper = -MaxReal * Vec3d::Ones();
+        for (size_t i = first; i != first + number; ++i)
+        {
+            int face = face_indices_[i];
+            lower = lower.cwiseMin(face_lower[face]);
+            upper = upper.cwiseMax(face_upper[face]);
+            centroid_lower = centroid_lower.cwiseMin(face_centroid[face]);
+            centroid_upper = centroid_upper.cwiseMax(face_centroid[face]);
+        }
+        nodes_[node_index].lower_ = lower;
+        nodes_[node_index].upper_ = upper;
+        if (number <= max_leaf_size_ || depth >= max_depth)
+            continue;
+
+        // binned surface area heuristic
+        Real best_cost = MaxReal;
+        int best_axis = -1;
+        size_t best_split = 0;
+        Vec3d centroid_extent = centroid_upper - centroid_lower;
+        for (int axis = 0; axis != 3; ++axis)
+        {
+            if (centroid_extent[axis] <= TinyReal)
+                continue;
+
+            size_t bin_count[number_of_bins_] = {0};
+            Vec3d bin_lower[number_of_bins_], bin_upper[number_of_bins_];
+            for (size_t b = 0; b != number_of_bins_; ++b)
+            {
+                bin_lower[b] = MaxReal * Vec3d::Ones();
+                bin_upper[b] = -MaxReal * Vec3d::Ones();
+            }
+            Real bin_scale = (Real)number_of_bins_ / centroid_extent[axis];
+            for (size_t i = first; i != first + number; ++i)
+            {
+                int face = face_indices_[i];
+                size_t b = SMIN(number_of_bins_ - 1,
+                                (size_t)((face_centroid[face][axis] - centroid_lower[axis]) * bin_scale));
+                bin_count[b]++;
+                bin_lower[b] = bin_lower[b].cwiseMin(face_lower[face]);
+                bin_upper[b] = bin_upper[b].cwiseMax(face_upper[face]);
+            }
+
+            // sweep from the right to get the cost of the right side of each split
+            Real right_cost[number_of_bins_] = {0};
+            Vec3d sweep_lower = MaxReal * Vec3d::Ones();
+            Vec3d sweep_upper = -MaxReal * Vec3d::Ones();
+            size_t sweep_count = 0;
+            for (size_t b = number_of_bins_ - 1; b != 0; --b)
+            {
+                sweep_count += bin_count[b];
+                sweep_lower = sweep_lower.cwiseMin(bin_lower[b]);
+                sweep_upper = sweep_upper.cwiseMax(bin_upper[b]);
+                right_cost[b] = sweep_count == 0 ? 0.0 : SurfaceArea(sweep_lower, sweep_upper) * (Real)sweep_count;
+            }
+            sweep_lower = MaxReal * Vec3d::Ones();
+            sweep_upper = -MaxReal * Vec3d::Ones();
+            sweep_count = 0;
+            for (size_t b = 0; b != number_of_bins_ - 1; ++b)
+            {
+                sweep_count += bin_count[b];
+                sweep_lower = sweep_lower.cwiseMin(bin_lower[b]);
+                sweep_upper = sweep_upper.cwiseMax(bin_upper[b]);
+                if (sweep_count == 0 || sweep_count == number)
+                    continue;
+                Real cost = SurfaceArea(sweep_lower, sweep_upper) * (Real)sweep_count + right_cost[b + 1];
+                if (cost < best_cost)
+                {
+                    best_cost = cost;
+                    best_axis = axis;
+                    best_split = b + 1;
+                }
+            }
+        }
+
+        // all centroids coincide, the faces are kept in one leaf
+        if (best_axis < 0)
+            continue;
+        // a leaf is cheaper than the best split if it is small enough
+        Real leaf_cost = SurfaceArea(lower, upper) * (Real)number;
+        if (best_cost >= leaf_cost && number <= 4 * max_leaf_size_)
+            continue;
+
+        Real bin_scale = (Real)number_of_bins_ / centroid_extent[best_axis];
+        auto middle = std::partition(
+            face_indices_.begin() + first, face_indices_.begin() + first + number,
+            [&](int face)
+            {
+                size_t b = SMIN(number_of_bins_ - 1,
+                                (size_t)((face_centroid[face][best_axis] - centroid_lower[best_axis]) * bin_scale));
+                return b < best_split;
+            });
+        size_t left_number = middle - (face_indices_.begin() + first);
+
+        size_t left_child = nodes_.size();
+        nodes_.push_back(Node{Vec3d::Zero(), Vec3d::Zero(), first, left_number});
+        nodes_.push_back(Node{Vec3d::Zero(), Vec3d::Zero(), first + left_number, number - left_number});
+        nodes_[node_index].first_ = left_child;
+        nodes_[node_index].number_ = 0;
+        building_stack.push_back(std::make_pair(left_child, depth + 1));
+        building_stack.push_back(std::make_pair(left_child + 1, depth + 1));
+    }
+
+    faces_.resize(number_of_faces);
+    for (size_t i = 0; i != number_of_faces; ++i)
+    {
+        const Array3i &face = faces[face_indices_[i]];
+        faces_[i].a_ = vertices[face[0]];
+        faces_[i].ab_ = vertices[face[1]] - vertices[face[0]];
+        faces_[i].ac_ = vertices[face[2]] - vertices[face[0]];
+    }
+
+    face_normals_.resize(number_of_faces);
+    for (size_t i = 0; i != number_of_faces; ++i)
+    {
+        const Array3i &face = faces[i];
+        Vec3d normal = (vertices[face[1]] - vertices[face[0]]).cross(vertices[face[2]] - vertices[face[0]]);
+        face_normals_[i] = normal / (normal.norm() + TinyReal);
+    }
+    is_closed_ = checkClosed(vertices, faces);
+    if (!is_closed_)
+    {
+        std::cout << "\n The triangle mesh is not closed, "
+                  << "containment is found by the side of the closest face." << std::endl;
+    }
+
+    // slightly tilted directions avoid rays running along mesh edges of axis-aligned geometries
+    ray_directions_ = {Vec3d(0.8151, 0.4210, 0.3978).normalized(),
+                       Vec3d(-0.3119, 0.8834, 0.3497).normalized(),
+                       Vec3d(-0.2711, -0.3358, 0.9021).normalized()};
+}
+//=================================================================================================//
+Real TriangleMeshBVH::SurfaceArea(const Vec3d &lower, const Vec3d &upper)
+{
+    Vec3d extent = upper - lower;
+    return extent[0] * extent[1] + extent[1] * extent[2] + extent[2] * extent[0];
+}
+//=================================================================================================//
+Real TriangleMeshBVH::SquaredDistanceToBox(const Vec3d &point, const Vec3d &lower, const Vec3d &upper)
+{
+    Vec3d outside = (lower - point).cwiseMax(point - upper).cwiseMax(Vec3d::Zero());
+    return outside.squaredNorm();
+}
+//=================================================================================================//
+Vec3d TriangleMeshBVH::closestPointOnTriangle(const Triangle &triangle, const Vec3d &point)
+{
+    // Ericson, Real-Time Collision Detection, section 5.1.5
+    const Vec3d &a = triangle.a_;
+    const Vec3d &ab = triangle.ab_;
+    const Vec3d &ac = triangle.ac_;
+    Vec3d ap = point - a;
+    Real d1 = ab.dot(ap);
+    Real d2 = ac.dot(ap);
+    if (d1 <= 0.0 && d2 <= 0.0)
+        return a;
+
+    Vec3d bp = ap - ab;
+    Real d3 = ab.dot(bp);
+    Real d4 = ac.dot(bp);
+    if (d3 >= 0.0 && d4 <= d3)
+        return a + ab;
+
+    Real vc = d1 * d4 - d3 * d2;
+    if (vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0)
+        return a + d1 / (d1 - d3) * ab;
+
+    Vec3d cp = ap - ac;
+    Real d5 = ab.dot(cp);
+    Real d6 = ac.dot(cp);
+    if (d6 >= 0.0 && d5 <= d6)
+        return a + ac;
+
+    Real vb = d5 * d2 - d1 * d6;
+    if (vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0)
+        return a + d2 / (d2 - d6) * ac;
+
+    Real va = d3 * d6 - d5 * d4;
+    if (va <= 0.0 && (d4 - d3) >= 0.0 && (d5 - d6) >= 0.0)
+        return a + ab + (d4 - d3) / ((d4 - d3) + (d5 - d6)) * (ac - ab);
+
+    Real denominator = 1.0 / (va + vb + vc);
+    return a + ab * vb * denominator + ac * vc * denominator;
+}
+//=================================================================================================//
+Vec3d TriangleMeshBVH::findClosestPoint(const Vec3d &probe_point, int &face_index)
+{
+    Real squared_distance_min = MaxReal;
+    Vec3d closest_point = probe_point;
+    face_index = -1;
+    if (faces_.empty())
+        return closest_point;
+
+    size_t traversal_stack[64];
+    size_t stack_size = 0;
+    traversal_stack[stack_size++] = 0;
+    while (stack_size != 0)
+    {
+        const Node &node = nodes_[traversal_stack[--stack_size]];
+        if (SquaredDistanceToBox(probe_point, node.lower_, node.upper_) >= squared_distance_min)
+            continue;
+
+        if (node.number_ != 0)
+        {
+            for (size_t i = node.first_; i != node.first_ + node.number_; ++i)
+            {
+                Vec3d point_on_face = closestPointOnTriangle(faces_[i], probe_point);
+                Real squared_distance = (point_on_face - probe_point).squaredNorm();
+                if (squared_distance < squared_distance_min)
+                {
+                    squared_distance_min = squared_distance;
+                    closest_point = point_on_face;
+                    face_index = face_indices_[i];
+                }
+            }
+        }
+        else
+        {
+            // the nearer child is pushed last so that it is visited first
+            const Node &left = nodes_[node.first_];
+            const Node &right = nodes_[node.first_ + 1];
+            Real left_distance = SquaredDistanceToBox(probe_point, left.lower_, left.upper_);
+            Real right_distance = SquaredDistanceToBox(probe_point, right.lower_, right.upper_);
+            size_t near_child = left_distance <= right_distance ? node.first_ : node.first_ + 1;
+            size_t far_child = left_distance <= right_distance ? node.first_ + 1 : node.first_;
+            Real far_distance = SMAX(left_distance, right_distance);
+            Real near_distance = SMIN(left_distance, right_distance);
+            if (far_distance < squared_distance_min)
+                traversal_stack[stack_size++] = far_child;
+            if (near_distance < squared_distance_min)
+                traversal_stack[stack_size++] = near_child;
+        }
+    }
+    return closest_point;
+}
+//=================================================================================================//
+Vec3d TriangleMeshBVH::findClosestPoint(const Vec3d &probe_point)
+{
+    int face_index = -1;
+    return findClosestPoint(probe_point, face_index);
+}
+//=================================================================================================//
+bool TriangleMeshBVH::checkRayIntersectBox(const Vec3d &origin, const Vec3d &inverse_direction,
+                                           const Vec3d &lower, const Vec3d &upper)
+{
+    Vec3d t_lower = (lower - origin).cwiseProduct(inverse_direction);
+    Vec3d t_upper = (upper - origin).cwiseProduct(inverse_direction);
+    Real t_enter = t_lower.cwiseMin(t_upper).maxCoeff();
+    Real t_exit = t_lower.cwiseMax(t_upper).minCoeff();
+    return t_exit >= SMAX(t_enter, Real(0));
+}
+//=================================================================================================//
+bool TriangleMeshBVH::checkRayIntersectTriangle(const Triangle &triangle, const Vec3d &origin, const Vec3d &direction)
+{
+    // Moller-Trumbore algorithm
+    Vec3d p = direction.cross(triangle.ac_);
+    Real determinant = triangle.ab_.dot(p);
+    if (fabs(determinant) < TinyReal)
+        return false;
+
+    Real inverse_determinant = 1.0 / determinant;
+    Vec3d s = origin - triangle.a_;
+    Real u = s.dot(p) * inverse_determinant;
+    if (u < 0.0 || u > 1.0)
+        return false;
+
+    Vec3d q = s.cross(triangle.ab_);
+    Real v = direction.dot(q) * inverse_determinant;
+    if (v < 0.0 || u + v > 1.0)
+        return false;
+
+    return triangle.ac_.dot(q) * inverse_determinant > 0.0;
+}
+//=================================================================================================//
+size_t TriangleMeshBVH::countRayIntersections(const Vec3d &origin, const Vec3d &direction)
+{
+    Vec3d inverse_direction = direction.cwiseInverse();
+    size_t number_of_intersections = 0;
+    if (faces_.empty())
+        return number_of_intersections;
+
+    size_t traversal_stack[64];
+    size_t stack_size = 0;
+    traversal_stack[stack_size++] = 0;
+    while (stack_size != 0)
+    {
+        const Node &node = nodes_[traversal_stack[--stack_size]];
+        if (!checkRayIntersectBox(origin, inverse_direction, node.lower_, node.upper_))
+            continue;
+
+        if (node.number_ != 0)
+        {
+            for (size_t i = node.first_; i != node.first_ + node.number_; ++i)
+            {
+                if (checkRayIntersectTriangle(faces_[i], origin, direction))
+                    number_of_intersections++;
+            }
+        }
+        else
+        {
+            traversal_stack[stack_size++] = node.first_;
+            traversal_stack[stack_size++] = node.first_ + 1;
+        }
+    }
+    return number_of_intersections;
+}
+//=================================================================================================//
+bool TriangleMeshBVH::checkClosed(const StdVec<Vec3d> &vertices, const StdVec<Array3i> &faces)
+{
+    // vertices at the same position up to round-off are merged,
+    // as meshes from stl files repeat them for each face
+    Vec3d lower = nodes_[0].lower_;
+    Real merge_spacing = 1.0e-8 * (nodes_[0].upper_ - lower).norm() + TinyReal;
+    std::map<std::array<int64_t, 3>, int> merged_indices;
+    StdVec<int> vertex_ids(vertices.size());
+    for (size_t i = 0; i != vertices.size(); ++i)
+    {
+        Vec3d scaled_position = (vertices[i] - lower) / merge_spacing;
+        std::array<int64_t, 3> position = {std::llround(scaled_position[0]),
+                                           std::llround(scaled_position[1]),
+                                           std::llround(scaled_position[2])};
+        vertex_ids[i] = merged_indices.emplace(position, (int)merged_indices.size()).first->second;
+    }
+
+    StdVec<std::pair<int, int>> edges;
+    edges.reserve(3 * faces.size());
+    for (const Array3i &face : faces)
+    {
+        Array3i ids(vertex_ids[face[0]], vertex_ids[face[1]], vertex_ids[face[2]]);
+        // faces collapsed to a line or a point, e.g. at the poles of a sphere, do not count
+        if (ids[0] == ids[1] || ids[1] == ids[2] || ids[2] == ids[0])
+            continue;
+        for (int k = 0; k != 3; ++k)
+        {
+            int a = ids[k];
+            int b = ids[(k + 1) % 3];
+            edges.push_back(std::make_pair(SMIN(a, b), SMAX(a, b)));
+        }
+    }
+    std::sort(edges.begin(), edges.end());
+
+    size_t i = 0;
+    while (i != edges.size())
+    {
+        size_t j = i;
+        while (j != edges.size() && edges[j] == edges[i])
+            ++j;
+        if (j - i != 2)
+            return false;
+        i = j;
+    }
+    return !edges.empty();
+}
+//=================================================================================================//
+bool TriangleMeshBVH::checkContainByClosestFace(const Vec3d &probe_point)
+{
+    int face_index = -1;
+    Vec3d closest_point = findClosestPoint(probe_point, face_index);
+    Vec3d from_face_to_point = probe_point - closest_point;
+    Real distance_to_point = from_face_to_point.norm();
+    const Vec3d &face_normal = face_normals_[face_index];
+    Real cosine_angle = face_normal.dot(from_face_to_point / (distance_to_point + TinyReal));
+
+    int ite = 0;
+    while (fabs(cosine_angle) < Eps)
+    {
+        Vec3d jittered = probe_point;
+        for (int l = 0; l != 3; ++l)
+            jittered[l] = probe_point[l] + rand_uniform(-0.5, 0.5) * (SqrtEps + distance_to_point * 0.1);
+        Vec3d from_face_to_jittered = jittered - closest_point;
+        cosine_angle = face_normal.dot(from_face_to_jittered / (from_face_to_jittered.norm() + TinyReal));
+
+        ite++;
+        if (ite > 100)
+        {
+            std::cout << "\n Error: TriangleMeshBVH::checkContainByClosestFace not able to achieve!  " << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+    }
+    return cosine_angle < 0.0;
+}
+//=================================================================================================//
+bool TriangleMeshBVH::checkContain(const Vec3d &probe_point)
+{
+    if (faces_.empty())
+        return false;
+    if (!is_closed_)
+        return checkContainByClosestFace(probe_point);
+
+    const Node &root = nodes_[0];
+    if (SquaredDistanceToBox(probe_point, root.lower_, root.upper_) > 0.0)
+        return false;
+
+    // majority vote of the ray parities, robust for a ray grazing an edge or a vertex
+    int inside_votes = 0;
+    for (const Vec3d &direction : ray_directions_)
+    {
+        inside_votes += countRayIntersections(probe_point, direction) % 2;
+    }
+    return inside_votes >= 2;
+}
+//=================================================================================================//
+void TriangleMeshBVH::findClosestPoints(const StdVec<Vec3d> &probe_points, StdVec<Vec3d> &closest_points)
+{
+    closest_points.resize(probe_points.size());
+    parallel_for(
+        IndexRange(0, probe_points.size()),
+        [&](const IndexRange &r)
+        {
+            for (size_t i = r.begin(); i != r.end(); ++i)
+            {
+                closest_points[i] = findClosestPoint(probe_points[i]);
+            }
+        });
+}
+//=================================================================================================//
+void TriangleMeshBVH::checkContains(const StdVec<Vec3d> &probe_points, StdVec<int> &is_contained)
+{
+    is_contained.resize(probe_points.size());
+    parallel_for(
+        IndexRange(0, probe_points.size()),
+        [&](const IndexRange &r)
+        {
+            for (size_t i = r.begin(); i != r.end(); ++i)
+            {
+                is_contained[i] = checkContain(probe_points[i]) ? 1 : 0;
+            }
+        });
+}
+//=================================================================================================//
+void TriangleMeshBVH::findSignedDistances(const StdVec<Vec3d> &probe_points, StdVec<Real> &signed_distances)
+{
+    signed_distances.resize(probe_points.size());
+    parallel_for(
+        IndexRange(0, probe_points.size()),
+        [&](const IndexRange &r)
+        {
+            for (size_t i = r.begin(); i != r.end(); ++i)
+            {
+                Real distance = (probe_points[i] - findClosestPoint(probe_points[i])).norm();
+                signed_distances[i] = checkContain(probe_points[i]) ? -distance : distance;
+            }
+        });
+}
+//=================================================================================================//
+} // namespace SPH
@@ -0,0 +1,105 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	  triangle_mesh_bvh.h
+ * @brief   Bounding volume hierarchy for closest point and containment queries on triangle meshes.
+ * @details The hierarchy is built with the surface area heuristic (SAH) on binned triangle centroids.
+ *          Leaves hold a few triangles stored contiguously so that they are tested together.
+ *          Containment is found by ray parity along three directions with majority vote,
+ *          which is robust for rays passing exactly through edges or vertices.
+ * @author	Chi Zhang and Xiangyu Hu
+ */
+
+#ifndef TRIANGLE_MESH_BVH_H
+#define TRIANGLE_MESH_BVH_H
+
+#include "base_data_package.h"
+
+namespace SPH
+{
+/**
+ * @class TriangleMeshBVH
+ * @brief SAH-built bounding volume hierarchy over the triangles of a mesh.
+ * All queries are read-only and can be called concurrently.
+ * An empty mesh has no hierarchy: nothing is contained in it
+ * and the closest point found is the probe point itself, with face index -1.
+ */
+class TriangleMeshBVH
+{
+  public:
+    TriangleMeshBVH(){};
+    virtual ~TriangleMeshBVH(){};
+
+    void build(const StdVec<Vec3d> &vertices, const StdVec<Array3i> &faces);
+    bool isBuilt() { return !nodes_.empty(); };
+    size_t NumberOfFaces() { return faces_.size(); };
+    /** closed, i.e. watertight, if each edge is shared by exactly two faces */
+    bool isClosed() { return is_closed_; };
+    /** closest point on the mesh surface, with the original index of the face found */
+    Vec3d findClosestPoint(const Vec3d &probe_point, int &face_index);
+    Vec3d findClosestPoint(const Vec3d &probe_point);
+    /** by the majority vote of ray parities for a closed mesh,
+     *  otherwise by the side of the closest face as for open surfaces */
+    bool checkContain(const Vec3d &probe_point);
+    /** batch queries on many probe points in parallel,
+     *  without affinity partitioner as they may be called within other parallel loops */
+    void findClosestPoints(const StdVec<Vec3d> &probe_points, StdVec<Vec3d> &closest_points);
+    void checkContains(const StdVec<Vec3d> &probe_points, StdVec<int> &is_contained);
+    void findSignedDistances(const StdVec<Vec3d> &probe_points, StdVec<Real> &signed_distances);
+
+  protected:
+    /** interior nodes have their children at first_ and first_ + 1,
+     *  leaves hold number_ faces starting from first_. */
+    struct Node
+    {
+        Vec3d lower_, upper_;
+        size_t first_;
+        size_t number_;
+    };
+    /** triangle stored by one vertex and two edges, as used by the closest point and ray tests */
+    struct Triangle
+    {
+        Vec3d a_, ab_, ac_;
+    };
+
+    static constexpr size_t max_leaf_size_ = 4;
+    static constexpr size_t number_of_bins_ = 12;
+    StdVec<Node> nodes_;
+    StdVec<Triangle> faces_;    /**< faces reordered by the hierarchy */
+    StdVec<int> face_indices_;  /**< original indices of the reordered faces */
+    StdVec<Vec3d> face_normals_; /**< unit normals of the faces by their original indices */
+    bool is_closed_ = false;
+    StdVec<Vec3d> ray_directions_;
+
+    Real SurfaceArea(const Vec3d &lower, const Vec3d &upper);
+    Real SquaredDistanceToBox(const Vec3d &point, const Vec3d &lower, const Vec3d &upper);
+    Vec3d closestPointOnTriangle(const Triangle &triangle, const Vec3d &point);
+    bool checkRayIntersectBox(const Vec3d &origin, const Vec3d &inverse_direction,
+                              const Vec3d &lower, const Vec3d &upper);
+    bool checkRayIntersectTriangle(const Triangle &triangle, const Vec3d &origin, const Vec3d &direction);
+    size_t countRayIntersections(const Vec3d &origin, const Vec3d &direction);
+    bool checkClosed(const StdVec<Vec3d> &vertices, const StdVec<Array3i> &faces);
+    bool checkContainByClosestFace(const Vec3d &probe_point);
+};
+} // namespace SPH
+#endif // TRIANGLE_MESH_BVH_H
@@ -1,5 +1,7 @@
 #include "triangle_mesh_shape.h"
 
+#include "data_hash.h"
+
 namespace SPH
 {
 //=================================================================================================//
@@ -15,6 +17,21 @@ SimTK::ContactGeometry::TriangleMesh *TriangleMeshShape::generateTriangleMesh(co
     }
     std::cout << "num of faces:" << triangle_mesh->getNumFaces() << std::endl;
 
+    StdVec<Vec3d> vertices(triangle_mesh->getNumVertices());
+    for (int i = 0; i != triangle_mesh->getNumVertices(); ++i)
+        vertices[i] = SimTKToEigen(triangle_mesh->getVertexPosition(i));
+    StdVec<Array3i> faces(triangle_mesh->getNumFaces());
+    for (int i = 0; i != triangle_mesh->getNumFaces(); ++i)
+        faces[i] = Array3i(triangle_mesh->getFaceVertex(i, 0),
+                           triangle_mesh->getFaceVertex(i, 1), triangle_mesh->getFaceVertex(i, 2));
+    bvh_.build(vertices, faces);
+
+    DataHash mesh_hash;
+    mesh_hash.add(std::string("TriangleMeshShape")).add(vertices.size()).add(faces.size());
+    mesh_hash.addBytes(vertices.data(), sizeof(Vec3d) * vertices.size());
+    mesh_hash.addBytes(faces.data(), sizeof(Array3i) * faces.size());
+    mesh_hash_ = mesh_hash.Value();
+
     return triangle_mesh;
 }
 //=================================================================================================//
@@ -31,52 +48,22 @@ SimTK::ContactGeometry::TriangleMesh *TriangleMeshShape::getTriangleMesh()
 //=================================================================================================//
 bool TriangleMeshShape::checkContain(const Vec3d &probe_point, bool BOUNDARY_INCLUDED)
 {
-    SimTKVec2 uv_coordinate;
-    bool inside = false; // note that direct prediction is not reliable sometime.
-    int face_id;
-
-    SimTKVec3 closest_pnt = triangle_mesh_->findNearestPoint(EigenToSimTK(probe_point), inside, face_id, uv_coordinate);
-    Vec3d from_face_to_pnt = probe_point - SimTKToEigen(closest_pnt);
-    Real distance_to_pnt = from_face_to_pnt.norm();
-    Vec3d direction_to_pnt = from_face_to_pnt / (distance_to_pnt + TinyReal);
-    Vec3d face_normal = SimTKToEigen(triangle_mesh_->getFaceNormal(face_id));
-    Real cosine_angle = face_normal.dot(direction_to_pnt);
-
-    int ite = 0;
-    while (fabs(cosine_angle) < Eps)
-    {
-        Vec3d jittered = probe_point; // jittering
-        for (int l = 0; l != probe_point.size(); ++l)
-            jittered[l] = probe_point[l] + rand_uniform(-0.5, 0.5) * (SqrtEps + distance_to_pnt * 0.1);
-        Vec3d from_face_to_jittered = jittered - SimTKToEigen(closest_pnt);
-        Vec3d direction_to_jittered = from_face_to_jittered / (from_face_to_jittered.norm() + TinyReal);
-        cosine_angle = face_normal.dot(direction_to_jittered);
-
-        ite++;
-        if (ite > 100)
-        {
-            std::cout << "\n Error: TriangleMeshShape::checkContain not able to achieve!  " << std::endl;
-            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
-            exit(1);
-        }
-    }
-
-    return cosine_angle < 0.0 ? true : false;
+    return bvh_.checkContain(probe_point);
 }
 //=================================================================================================//
 Vecd TriangleMeshShape::findClosestPoint(const Vecd &probe_point)
 {
-    bool inside = false;
-    int face_id;
-    SimTKVec2 norm;
-    SimTKVec3 closest_pnt = triangle_mesh_->findNearestPoint(SimTKVec3(probe_point[0], probe_point[1], probe_point[2]), inside, face_id, norm);
-    if (face_id < 0 && face_id > triangle_mesh_->getNumFaces())
-    {
-        std::cout << "\n Error the nearest point is not valid" << std::endl;
-        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
-        throw;
-    }
-    return Vecd(closest_pnt[0], closest_pnt[1], closest_pnt[2]);
+    return bvh_.findClosestPoint(probe_point);
+}
+//=================================================================================================//
+void TriangleMeshShape::checkContains(const StdVec<Vec3d> &probe_points, StdVec<int> &is_contained)
+{
+    bvh_.checkContains(probe_points, is_contained);
+}
+//=================================================================================================//
+void TriangleMeshShape::findClosestPoints(const StdVec<Vec3d> &probe_points, StdVec<Vec3d> &closest_points)
+{
+    bvh_.findClosestPoints(probe_points, closest_points);
 }
 //=================================================================================================//
 BoundingBox TriangleMeshShape::findBounds()
@@ -32,6 +32,7 @@
 
 #include "all_simbody.h"
 #include "base_geometry.h"
+#include "triangle_mesh_bvh.h"
 
 #include <filesystem>
 #include <fstream>
@@ -52,21 +53,26 @@ class TriangleMeshShape : public Shape
 
   public:
     explicit TriangleMeshShape(const std::string &shape_name, const SimTK::PolygonalMesh *mesh = nullptr)
-        : Shape(shape_name), triangle_mesh_(nullptr)
+        : Shape(shape_name), triangle_mesh_(nullptr), mesh_hash_(0)
     {
         if (mesh)
             triangle_mesh_ = generateTriangleMesh(*mesh);
     };
-    /** Only reliable when the probe point is close to the shape surface.
-     * Need to be combined with level set shape and sign correction to avoid artifacts
-     * when probe distance is far from the surface. */
+    /** Found by ray parity for a closed mesh. For an open or non-watertight mesh,
+     *  by the side of the closest face, which is reliable only near the surface. */
     virtual bool checkContain(const Vec3d &probe_point, bool BOUNDARY_INCLUDED = true) override;
     virtual Vec3d findClosestPoint(const Vec3d &probe_point) override;
+    virtual void checkContains(const StdVec<Vec3d> &probe_points, StdVec<int> &is_contained) override;
+    virtual void findClosestPoints(const StdVec<Vec3d> &probe_points, StdVec<Vec3d> &closest_points) override;
+    /** hashed from the vertices and faces of the mesh */
+    virtual uint64_t getGeometryHash() override { return mesh_hash_; };
 
     SimTK::ContactGeometry::TriangleMesh *getTriangleMesh();
 
   protected:
     SimTK::ContactGeometry::TriangleMesh *triangle_mesh_;
+    TriangleMeshBVH bvh_; /**< bounding volume hierarchy for the geometric queries */
+    uint64_t mesh_hash_;
 
     /** generate triangle mesh from polygon mesh */
     SimTK::ContactGeometry::TriangleMesh *generateTriangleMesh(const SimTK::PolygonalMesh &poly_mesh);
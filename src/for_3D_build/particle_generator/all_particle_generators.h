@@ -31,9 +31,11 @@
 
 #include "base_particle_generator.hpp"
 #include "line_particle_generator.h"
+#include "particle_generator_cached.h"
 #include "particle_generator_lattice.h"
 #include "particle_generator_mesh.h"
 #include "particle_generator_network.h"
 #include "particle_generator_reserve.h"
+#include "particle_generator_shared.h"
 
 #endif // ALL_PARTICLE_GENERATORS_3D_H
\ No newline at end of file
@@ -62,6 +62,7 @@ class SPHAdaptation
     Real spacing_min_;             /**< minimum particle spacing determined by local refinement level */
     Real Vol_min_;                 /**< minimum particle volume measure determined by local refinement level */
     Real h_ratio_max_;             /**< the ratio between the reference smoothing length to the minimum smoothing length */
+    std::string level_set_cache_folder_; /**< folder for caching level set data, empty if not cached */
 
   public:
     explicit SPHAdaptation(Real resolution_ref, Real h_spacing_ratio = 1.3, Real system_refinement_ratio = 1.0);
@@ -78,6 +79,8 @@ class SPHAdaptation
     virtual Real SmoothingLengthRatio(size_t particle_index_i) { return 1.0; };
     void resetAdaptationRatios(Real h_spacing_ratio, Real new_system_refinement_ratio = 1.0);
     virtual void initializeAdaptationVariables(BaseParticles &base_particles) {};
+    void setLevelSetCacheFolder(const std::string &folder) { level_set_cache_folder_ = folder; };
+    std::string LevelSetCacheFolder() { return level_set_cache_folder_; };
 
     virtual UniquePtr<BaseCellLinkedList> createCellLinkedList(const BoundingBox &domain_bounds);
     virtual UniquePtr<BaseLevelSet> createLevelSet(Shape &shape, Real refinement_ratio);
@@ -42,6 +42,7 @@
 #include "base_particle_generator.h"
 #include "base_particles.h"
 #include "cell_linked_list.h"
+#include "particle_relaxation_cache.h"
 #include "particle_sorting.h"
 #include "sph_data_containers.h"
 #include "sph_system.h"
@@ -67,15 +68,17 @@ class SPHBody
     UniquePtrKeeper<SPHAdaptation> sph_adaptation_ptr_keeper_;
     UniquePtrKeeper<BaseParticles> base_particles_ptr_keeper_;
     UniquePtrKeeper<BaseMaterial> base_material_ptr_keeper_;
+    UniquePtrKeeper<ParticleRelaxationCache> relaxation_cache_ptr_keeper_;
 
   protected:
     SPHSystem &sph_system_;
     std::string body_name_;
-    bool newly_updated_;            /**< whether this body is in a newly updated state */
-    BaseParticles *base_particles_; /**< Base particles for dynamic cast DataDelegate  */
-    bool is_bound_set_;             /**< whether the bounding box is set */
-    BoundingBox bound_;             /**< bounding box of the body */
-    Shape *initial_shape_;          /**< initial volumetric geometry enclosing the body */
+    bool newly_updated_;                        /**< whether this body is in a newly updated state */
+    BaseParticles *base_particles_;             /**< Base particles for dynamic cast DataDelegate  */
+    bool is_bound_set_;                         /**< whether the bounding box is set */
+    BoundingBox bound_;                         /**< bounding box of the body */
+    Shape *initial_shape_;                      /**< initial volumetric geometry enclosing the body */
+    ParticleRelaxationCache *relaxation_cache_; /**< relaxed particles cached on disk, nullptr if not defined */
 
   public:
     SPHAdaptation *sph_adaptation_;        /**< numerical adaptation policy */
@@ -106,6 +109,7 @@ class SPHBody
     void setSPHBodyBounds(const BoundingBox &bound);
     BoundingBox getSPHBodyBounds();
     BoundingBox getSPHSystemBounds();
+    ParticleRelaxationCache *getRelaxationCache() { return relaxation_cache_; };
     //----------------------------------------------------------------------
     //		Object factory template functions
     //----------------------------------------------------------------------
@@ -135,6 +139,13 @@ class SPHBody
         return level_set_shape;
     };
 
+    ParticleRelaxationCache *defineRelaxationCache(const std::string &relaxation_method, uint64_t generator_hash = 0)
+    {
+        relaxation_cache_ = relaxation_cache_ptr_keeper_.createPtr<ParticleRelaxationCache>(
+            *this, relaxation_method, generator_hash);
+        return relaxation_cache_;
+    };
+
     template <class MaterialType>
     void assignMaterial(MaterialType *material)
     {
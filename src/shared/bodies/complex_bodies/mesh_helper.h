@@ -30,6 +30,8 @@
 
 #include "unstructured_mesh.h"
 
+#include <cctype>
+#include <charconv>
 #include <filesystem>
 #include <fstream>
 #include <iomanip>
@@ -51,6 +53,25 @@ class MeshFileHelpers
     static void dataStruct(StdVec<StdVec<StdVec<size_t>>> &mesh_topology_, StdLargeVec<StdVec<size_t>> &elements_nodes_connection_,
                            size_t number_of_elements, size_t mesh_type, size_t dimension);
     static size_t findBoundaryType(std::string &text_line, size_t boundary_type);
+    /** Parse space-separated hexadecimal integers in a line without creating substrings,
+     * returns the number of integers parsed. */
+    static size_t hexIntegers(const std::string &text_line, size_t *values, size_t max_number)
+    {
+        const char *current = text_line.data();
+        const char *end = current + text_line.size();
+        size_t number = 0;
+        while (number != max_number)
+        {
+            while (current != end && std::isspace(static_cast<unsigned char>(*current)))
+                ++current;
+            std::from_chars_result result = std::from_chars(current, end, values[number], 16);
+            if (result.ec != std::errc())
+                break;
+            current = result.ptr;
+            ++number;
+        }
+        return number;
+    };
     static Vecd nodeIndex(std::string &text_line);
     static Vec2d cellIndex(std::string &text_line);
     static void updateElementsNodesConnection(StdLargeVec<StdVec<size_t>> &elements_nodes_connection_, Vecd nodes, Vec2d cells,
@@ -63,8 +84,8 @@ class MeshFileHelpers
                                       StdLargeVec<Vecd> &node_coordinates_, StdLargeVec<Vecd> &elements_center_coordinates_, Vecd &center_coordinate);
     static void elementVolume(StdLargeVec<StdVec<size_t>> &elements_nodes_connection_, std::size_t &element,
                               StdLargeVec<Vecd> &node_coordinates_, StdLargeVec<Real> &elements_volumes_);
-    static void minimumDistance(StdVec<Real> &all_data_of_distance_between_nodes, StdLargeVec<Real> &elements_volumes_,
-                                StdVec<StdVec<StdVec<size_t>>> &mesh_topology_, StdLargeVec<Vecd> &node_coordinates_);
+    static Real minimumDistance(StdLargeVec<Real> &elements_volumes_, StdVec<StdVec<StdVec<size_t>>> &mesh_topology_,
+                                StdLargeVec<Vecd> &node_coordinates_);
     static void vtuFileHeader(std::ofstream &out_file);
     static void vtuFileNodeCoordinates(std::ofstream &out_file, StdLargeVec<Vecd> &nodes_coordinates_,
                                        StdLargeVec<StdVec<size_t>> &elements_nodes_connection_, SPHBody &bounds_, Real &range_max);
@@ -2,10 +2,176 @@
 #include "unstructured_mesh.h"
 
 #include "base_particle_dynamics.h"
+#include "data_hash.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+namespace fs = std::filesystem;
 
 namespace SPH
 {
 //=================================================================================================//
+template <class ContainerType>
+static void writeMeshCacheData(std::ofstream &cache_file, const ContainerType &data)
+{
+    size_t size = data.size();
+    cache_file.write(reinterpret_cast<const char *>(&size), sizeof(size_t));
+    cache_file.write(reinterpret_cast<const char *>(data.data()), sizeof(typename ContainerType::value_type) * size);
+}
+//=================================================================================================//
+template <class ContainerType>
+static bool readMeshCacheData(std::ifstream &cache_file, ContainerType &data, size_t remaining_bytes)
+{
+    size_t size = 0;
+    cache_file.read(reinterpret_cast<char *>(&size), sizeof(size_t));
+    if (!cache_file || size > remaining_bytes / sizeof(typename ContainerType::value_type))
+        return false;
+    data.resize(size);
+    cache_file.read(reinterpret_cast<char *>(data.data()), sizeof(typename ContainerType::value_type) * size);
+    return bool(cache_file);
+}
+//=================================================================================================//
+template <class NestedContainerType>
+static void writeMeshCacheRows(std::ofstream &cache_file, const NestedContainerType &rows)
+{
+    StdVec<size_t> row_offsets(1, 0);
+    StdVec<typename NestedContainerType::value_type::value_type> entries;
+    for (const auto &row : rows)
+    {
+        entries.insert(entries.end(), row.begin(), row.end());
+        row_offsets.push_back(entries.size());
+    }
+    writeMeshCacheData(cache_file, row_offsets);
+    writeMeshCacheData(cache_file, entries);
+}
+//=================================================================================================//
+template <class NestedContainerType>
+static bool readMeshCacheRows(std::ifstream &cache_file, NestedContainerType &rows, size_t remaining_bytes)
+{
+    StdVec<size_t> row_offsets;
+    StdVec<typename NestedContainerType::value_type::value_type> entries;
+    if (!readMeshCacheData(cache_file, row_offsets, remaining_bytes) || row_offsets.empty() ||
+        !readMeshCacheData(cache_file, entries, remaining_bytes) || row_offsets.back() != entries.size())
+        return false;
+
+    rows.resize(row_offsets.size() - 1);
+    for (size_t i = 0; i != rows.size(); ++i)
+    {
+        if (row_offsets[i] > row_offsets[i + 1])
+            return false;
+        rows[i].assign(entries.begin() + row_offsets[i], entries.begin() + row_offsets[i + 1]);
+    }
+    return true;
+}
+//=================================================================================================//
+std::string ANSYSMesh::MeshCacheFilePath(const std::string &full_path)
+{
+    return mesh_cache_folder_ + "/" + fs::path(full_path).stem().string() + "_" + mesh_cache_key_ + ".bin";
+}
+//=================================================================================================//
+bool ANSYSMesh::readMeshCache(const std::string &full_path)
+{
+    if (mesh_cache_folder_.empty())
+        return false;
+
+    std::error_code error_code;
+    fs::path mesh_file_path = fs::canonical(full_path, error_code);
+    if (error_code)
+        return false;
+
+    DataHash cache_hash;
+    cache_hash.add(std::string("ANSYSMesh_v1")).add(Dimensions).add(sizeof(Real));
+    cache_hash.add(mesh_file_path.string()).add(static_cast<uint64_t>(fs::file_size(mesh_file_path)));
+    cache_hash.add(static_cast<int64_t>(fs::last_write_time(mesh_file_path).time_since_epoch().count()));
+    mesh_cache_key_ = cache_hash.HexString();
+
+    std::string cache_file_path = MeshCacheFilePath(full_path);
+    if (!fs::exists(cache_file_path))
+        return false;
+
+    size_t remaining_bytes = fs::file_size(cache_file_path);
+    std::ifstream cache_file(cache_file_path, std::ios::binary);
+    size_t key_size = 0;
+    cache_file.read(reinterpret_cast<char *>(&key_size), sizeof(size_t));
+    std::string key_in_file(key_size < 64 ? key_size : 0, ' ');
+    cache_file.read(&key_in_file[0], key_in_file.size());
+
+    // the topology is stored as element offsets into a compressed list of faces
+    StdVec<size_t> element_offsets;
+    StdVec<StdVec<size_t>> faces;
+    bool is_complete = cache_file && key_in_file == mesh_cache_key_ &&
+                       readMeshCacheData(cache_file, types_of_boundary_condition_, remaining_bytes) &&
+                       readMeshCacheData(cache_file, node_coordinates_, remaining_bytes) &&
+                       readMeshCacheData(cache_file, elements_centroids_, remaining_bytes) &&
+                       readMeshCacheData(cache_file, elements_volumes_, remaining_bytes) &&
+                       readMeshCacheRows(cache_file, elements_nodes_connection_, remaining_bytes) &&
+                       readMeshCacheData(cache_file, element_offsets, remaining_bytes) &&
+                       readMeshCacheRows(cache_file, faces, remaining_bytes) &&
+                       !element_offsets.empty() && element_offsets.back() == faces.size();
+    cache_file.read(reinterpret_cast<char *>(&min_distance_between_nodes_), sizeof(double));
+    if (!is_complete || !cache_file)
+    {
+        std::cout << "\n Warning: mesh cache file " << cache_file_path
+                  << " does not match, the mesh file will be parsed again." << std::endl;
+        types_of_boundary_condition_.clear();
+        node_coordinates_.clear();
+        elements_centroids_.clear();
+        elements_volumes_.clear();
+        elements_nodes_connection_.clear();
+        return false;
+    }
+
+    mesh_topology_.resize(element_offsets.size() - 1);
+    for (size_t i = 0; i != mesh_topology_.size(); ++i)
+    {
+        mesh_topology_[i].assign(std::make_move_iterator(faces.begin() + element_offsets[i]),
+                                 std::make_move_iterator(faces.begin() + element_offsets[i + 1]));
+    }
+    std::cout << "\n Mesh data of " << full_path << " is loaded from " << cache_file_path << std::endl;
+    return true;
+}
+//=================================================================================================//
+void ANSYSMesh::writeMeshCache(const std::string &full_path)
+{
+    if (mesh_cache_key_.empty())
+        return;
+
+    std::string cache_file_path = MeshCacheFilePath(full_path);
+    fs::path cache_folder = fs::path(cache_file_path).parent_path();
+    if (!fs::exists(cache_folder))
+    {
+        fs::create_directories(cache_folder);
+    }
+
+    StdVec<size_t> element_offsets(1, 0);
+    StdVec<StdVec<size_t>> faces;
+    for (const auto &element_faces : mesh_topology_)
+    {
+        faces.insert(faces.end(), element_faces.begin(), element_faces.end());
+        element_offsets.push_back(faces.size());
+    }
+
+    // write to a temporary file first so that a partially written file is never read
+    std::string temporary_file_path =
+        cache_file_path + "." + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+    {
+        std::ofstream cache_file(temporary_file_path, std::ios::binary | std::ios::trunc);
+        size_t key_size = mesh_cache_key_.size();
+        cache_file.write(reinterpret_cast<const char *>(&key_size), sizeof(size_t));
+        cache_file.write(mesh_cache_key_.data(), key_size);
+        writeMeshCacheData(cache_file, types_of_boundary_condition_);
+        writeMeshCacheData(cache_file, node_coordinates_);
+        writeMeshCacheData(cache_file, elements_centroids_);
+        writeMeshCacheData(cache_file, elements_volumes_);
+        writeMeshCacheRows(cache_file, elements_nodes_connection_);
+        writeMeshCacheData(cache_file, element_offsets);
+        writeMeshCacheRows(cache_file, faces);
+        cache_file.write(reinterpret_cast<const char *>(&min_distance_between_nodes_), sizeof(double));
+    }
+    fs::rename(temporary_file_path, cache_file_path);
+}
+//=================================================================================================//
 BaseInnerRelationInFVM::BaseInnerRelationInFVM(RealBody &real_body, ANSYSMesh &ansys_mesh)
     : BaseInnerRelation(real_body), real_body_(&real_body),
       node_coordinates_(ansys_mesh.node_coordinates_),
@@ -15,5 +181,82 @@ BaseInnerRelationInFVM::BaseInnerRelationInFVM(RealBody &real_body, ANSYSMesh &a
     subscribeToBody();
     inner_configuration_.resize(base_particles_.RealParticlesBound(), Neighborhood());
 };
-//=============================================================================================//
+//=================================================================================================//
+void BaseInnerRelationInFVM::updateFaceList()
+{
+    face_list_.buildFromConfiguration(inner_configuration_, base_particles_.TotalRealParticles(), Vol_);
+}
+//=================================================================================================//
+void FaceListInFVM::buildFromConfiguration(ParticleConfiguration &inner_configuration,
+                                           size_t total_real_cells, StdLargeVec<Real> &Vol)
+{
+    StdVec<size_t> owner, neighbor;
+    StdVec<Vecd> normal;
+    StdVec<Real> area;
+    for (size_t index_i = 0; index_i != total_real_cells; ++index_i)
+    {
+        Neighborhood &neighborhood = inner_configuration[index_i];
+        for (size_t n = 0; n != neighborhood.current_size_; ++n)
+        {
+            size_t index_j = neighborhood.j_[n];
+            if (index_i < index_j) // interfaces between real cells are taken from the smaller index
+            {
+                owner.push_back(index_i);
+                neighbor.push_back(index_j);
+                normal.push_back(neighborhood.e_ij_[n]);
+                area.push_back(-2.0 * neighborhood.dW_ij_[n] * Vol[index_i] * Vol[index_j]);
+            }
+        }
+    }
+
+    // greedy coloring, the smallest color not used by the real cells of the face
+    size_t number_of_faces = owner.size();
+    StdVec<uint64_t> used_colors(total_real_cells, 0);
+    StdVec<size_t> face_color(number_of_faces);
+    size_t number_of_colors = 0;
+    for (size_t f = 0; f != number_of_faces; ++f)
+    {
+        uint64_t occupied = used_colors[owner[f]];
+        if (neighbor[f] < total_real_cells)
+            occupied |= used_colors[neighbor[f]];
+        size_t color = 0;
+        while (color < 64 && (occupied >> color) & 1)
+            ++color;
+        if (color == 64)
+        {
+            std::cout << "\n Error: too many faces share a cell for face coloring!" << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+        used_colors[owner[f]] |= uint64_t(1) << color;
+        if (neighbor[f] < total_real_cells)
+            used_colors[neighbor[f]] |= uint64_t(1) << color;
+        face_color[f] = color;
+        number_of_colors = SMAX(number_of_colors, color + 1);
+    }
+
+    // counting sort by color, keeping the owner order within each color
+    StdVec<size_t> color_offset(number_of_colors + 1, 0);
+    for (size_t f = 0; f != number_of_faces; ++f)
+        color_offset[face_color[f] + 1]++;
+    for (size_t c = 0; c != number_of_colors; ++c)
+        color_offset[c + 1] += color_offset[c];
+    color_ranges_.clear();
+    for (size_t c = 0; c != number_of_colors; ++c)
+        color_ranges_.push_back(IndexRange(color_offset[c], color_offset[c + 1]));
+
+    owner_.resize(number_of_faces);
+    neighbor_.resize(number_of_faces);
+    normal_.resize(number_of_faces);
+    area_.resize(number_of_faces);
+    for (size_t f = 0; f != number_of_faces; ++f)
+    {
+        size_t sorted = color_offset[face_color[f]]++;
+        owner_[sorted] = owner[f];
+        neighbor_[sorted] = neighbor[f];
+        normal_[sorted] = normal[f];
+        area_[sorted] = area[f];
+    }
+}
+//=================================================================================================//
 } // namespace SPH
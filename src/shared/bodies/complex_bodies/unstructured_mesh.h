@@ -35,11 +35,16 @@ namespace SPH
 /**
  * @class ANSYSMesh
  * @brief ANASYS mesh.file parser class
+ * @details When constructed with a SPH system whose mesh cache is switched on,
+ * the parsed mesh data is written into a binary file in the cache folder of the IO environment,
+ * which is keyed by the path, size and modification time of the mesh file.
+ * Later runs with the same mesh file read the cache instead of parsing the ASCII file again.
  */
 class ANSYSMesh
 {
   public:
-    ANSYSMesh(const std::string &full_path);
+    explicit ANSYSMesh(const std::string &full_path);
+    ANSYSMesh(SPHSystem &sph_system, const std::string &full_path);
     virtual ~ANSYSMesh(){};
 
     StdVec<size_t> types_of_boundary_condition_;
@@ -56,6 +61,37 @@ class ANSYSMesh
     void getDataFromMeshFile(const std::string &full_path);
     void getElementCenterCoordinates();
     void getMinimumDistanceBetweenNodes();
+
+    std::string mesh_cache_folder_;
+    std::string mesh_cache_key_;
+    std::string MeshCacheFilePath(const std::string &full_path);
+    bool readMeshCache(const std::string &full_path);
+    void writeMeshCache(const std::string &full_path);
+};
+
+/**
+ * @class FaceListInFVM
+ * @brief List of cell interfaces, each evaluated once in face-based flux computation.
+ * @details The owner is the real cell the face normal points into and
+ * the neighbor is the cell on the other side, which may be a ghost cell.
+ * The faces are colored so that faces of the same color share no real cell,
+ * and stored color by color so that each color is a contiguous index range.
+ */
+class FaceListInFVM
+{
+  public:
+    StdLargeVec<size_t> owner_;
+    StdLargeVec<size_t> neighbor_;
+    StdLargeVec<Vecd> normal_;
+    StdLargeVec<Real> area_;
+    StdVec<IndexRange> color_ranges_;
+
+    FaceListInFVM(){};
+    virtual ~FaceListInFVM(){};
+    size_t size() { return owner_.size(); };
+    /** Build from the inner configuration, in which each interface appears from both sides. */
+    void buildFromConfiguration(ParticleConfiguration &inner_configuration,
+                                size_t total_real_cells, StdLargeVec<Real> &Vol);
 };
 
 /**
@@ -71,10 +107,13 @@ class BaseInnerRelationInFVM : public BaseInnerRelation
 
     explicit BaseInnerRelationInFVM(RealBody &real_body, ANSYSMesh &ansys_mesh);
     virtual ~BaseInnerRelationInFVM(){};
+    FaceListInFVM &getFaceList() { return face_list_; };
 
   protected:
     StdLargeVec<Real> &Vol_;
+    FaceListInFVM face_list_;
     virtual void resetNeighborhoodCurrentSize() override;
+    void updateFaceList();
 };
 
 /**
@@ -32,6 +32,7 @@
 #include "base_body_relation.h"
 #include "complex_body_relation.h"
 #include "contact_body_relation.h"
+#include "device_configuration.h"
 #include "inner_body_relation.h"
 
 #endif // ALL_BODY_RELATIONS_H
@@ -26,6 +26,15 @@ BaseInnerRelation::BaseInnerRelation(RealBody &real_body)
 {
     subscribeToBody();
     inner_configuration_.resize(base_particles_.RealParticlesBound(), Neighborhood());
+    footprint_entry_ = MemoryFootprint::recordDynamic(
+        sph_body_.getName(), "InnerConfiguration", "ParticleConfiguration",
+        [this]()
+        { return ParticleConfigurationBytes(inner_configuration_); });
+}
+//=================================================================================================//
+BaseInnerRelation::~BaseInnerRelation()
+{
+    MemoryFootprint::release(footprint_entry_);
 }
 //=================================================================================================//
 void BaseInnerRelation::resetNeighborhoodCurrentSize()
@@ -43,13 +52,26 @@ void BaseInnerRelation::resetNeighborhoodCurrentSize()
 }
 //=================================================================================================//
 BaseContactRelation::BaseContactRelation(SPHBody &sph_body, RealBodyVector contact_sph_bodies)
-    : SPHRelation(sph_body), contact_bodies_(contact_sph_bodies)
+    : SPHRelation(sph_body), is_contact_active_(contact_sph_bodies.size(), true),
+      had_active_contact_(true), contact_bodies_(contact_sph_bodies)
 {
     subscribeToBody();
     contact_configuration_.resize(contact_bodies_.size());
     for (size_t k = 0; k != contact_bodies_.size(); ++k)
     {
         contact_configuration_[k].resize(base_particles_.RealParticlesBound(), Neighborhood());
+        footprint_entries_.push_back(MemoryFootprint::recordDynamic(
+            sph_body_.getName(), "ContactConfiguration_" + contact_bodies_[k]->getName(), "ParticleConfiguration",
+            [this, k]()
+            { return ParticleConfigurationBytes(contact_configuration_[k]); }));
+    }
+}
+//=================================================================================================//
+BaseContactRelation::~BaseContactRelation()
+{
+    for (size_t entry : footprint_entries_)
+    {
+        MemoryFootprint::release(entry);
     }
 }
 //=================================================================================================//
@@ -70,4 +92,16 @@ void BaseContactRelation::resetNeighborhoodCurrentSize()
     }
 }
 //=================================================================================================//
+void BaseContactRelation::setActiveContacts(const StdVec<bool> &is_contact_active)
+{
+    had_active_contact_ = std::find(is_contact_active_.begin(), is_contact_active_.end(), true) != is_contact_active_.end();
+    is_contact_active_ = is_contact_active;
+}
+//=================================================================================================//
+bool BaseContactRelation::hasActiveContact()
+{
+    return had_active_contact_ ||
+           std::find(is_contact_active_.begin(), is_contact_active_.end(), true) != is_contact_active_.end();
+}
+//=================================================================================================//
 } // namespace SPH
@@ -126,13 +126,14 @@ class SPHRelation
 class BaseInnerRelation : public SPHRelation
 {
   protected:
+    size_t footprint_entry_; /**< entry of the configuration in the memory footprint. */
     virtual void resetNeighborhoodCurrentSize();
 
   public:
     RealBody *real_body_;
     ParticleConfiguration inner_configuration_; /**< inner configuration for the neighbor relations. */
     explicit BaseInnerRelation(RealBody &real_body);
-    virtual ~BaseInnerRelation(){};
+    virtual ~BaseInnerRelation();
     BaseInnerRelation &getRelation() { return *this; };
 };
 
@@ -143,6 +144,9 @@ class BaseInnerRelation : public SPHRelation
 class BaseContactRelation : public SPHRelation
 {
   protected:
+    StdVec<bool> is_contact_active_; /**< whether a contact body may be in contact, given by a broad phase. */
+    bool had_active_contact_;        /**< whether any contact body was active before the last broad phase. */
+    StdVec<size_t> footprint_entries_; /**< entries of the configurations in the memory footprint. */
     virtual void resetNeighborhoodCurrentSize();
 
   public:
@@ -152,8 +156,13 @@ class BaseContactRelation : public SPHRelation
     BaseContactRelation(SPHBody &sph_body, RealBodyVector contact_bodies);
     BaseContactRelation(SPHBody &sph_body, BodyPartVector contact_body_parts)
         : BaseContactRelation(sph_body, BodyPartsToRealBodies(contact_body_parts)){};
-    virtual ~BaseContactRelation(){};
+    virtual ~BaseContactRelation();
     BaseContactRelation &getRelation() { return *this; };
+    bool isContactActive(size_t k) { return is_contact_active_[k]; };
+    void setActiveContacts(const StdVec<bool> &is_contact_active);
+    /** Whether the contact dynamics should be executed. It is also the case
+     * just after all contacts become inactive, so that the contact forces are cleared. */
+    bool hasActiveContact();
 };
 } // namespace SPH
 #endif // BASE_BODY_RELATION_H
\ No newline at end of file
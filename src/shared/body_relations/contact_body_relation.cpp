@@ -2,13 +2,54 @@
 #include "all_particles.h"
 #include "base_particle_dynamics.h"
 #include "cell_linked_list.hpp"
+#include "level_set_shape.h"
 #include <numeric>
 
 namespace SPH
 {
 //=================================================================================================//
+SearchCandidateByLevelSet::
+    SearchCandidateByLevelSet(LevelSetShape &level_set_shape, CellLinkedList &target_cell_linked_list, Real threshold)
+    : level_set_shape_(level_set_shape), target_cell_linked_list_(target_cell_linked_list),
+      threshold_(threshold), all_cells_(target_cell_linked_list.AllCells())
+{
+    Real half_cell_diagonal = 0.5 * sqrt(Real(Dimensions)) * target_cell_linked_list.GridSpacing();
+    size_t total_cells = all_cells_.prod();
+    cell_states_.resize(total_cells);
+    parallel_for(
+        IndexRange(0, total_cells),
+        [&](const IndexRange &r)
+        {
+            for (size_t i = r.begin(); i != r.end(); ++i)
+            {
+                Vecd cell_position = target_cell_linked_list_.CellPositionFromIndex(
+                    target_cell_linked_list_.transfer1DtoMeshIndex(all_cells_, i));
+                Real phi = level_set_shape_.probeSignedDistance(cell_position);
+                cell_states_[i] = phi > threshold_ + half_cell_diagonal
+                                      ? FarCell
+                                      : (phi < threshold_ - half_cell_diagonal ? NearCell : ProbeCell);
+            }
+        },
+        ap);
+}
+//=================================================================================================//
+bool SearchCandidateByLevelSet::operator()(size_t index_i, const Vecd &position)
+{
+    Arrayi cell_index = target_cell_linked_list_.CellIndexFromPosition(position);
+    Vecd relative_position = position - target_cell_linked_list_.CellLowerCorner(cell_index);
+    bool is_in_cell = relative_position.minCoeff() >= 0.0 &&
+                      relative_position.maxCoeff() <= target_cell_linked_list_.GridSpacing();
+    char cell_state = is_in_cell
+                          ? cell_states_[target_cell_linked_list_.transferMeshIndexTo1D(all_cells_, cell_index)]
+                          : char(ProbeCell);
+    if (cell_state != ProbeCell)
+        return cell_state == NearCell;
+    return level_set_shape_.probeSignedDistance(position) <= threshold_;
+}
+//=================================================================================================//
 ContactRelation::ContactRelation(SPHBody &sph_body, RealBodyVector contact_bodies)
-    : ContactRelationCrossResolution(sph_body, contact_bodies)
+    : ContactRelationCrossResolution(sph_body, contact_bodies),
+      search_candidates_by_level_set_(contact_bodies.size(), nullptr)
 {
     for (size_t k = 0; k != contact_bodies_.size(); ++k)
     {
@@ -18,11 +59,42 @@ ContactRelation::ContactRelation(SPHBody &sph_body, RealBodyVector contact_bodie
     }
 }
 //=================================================================================================//
+void ContactRelation::useLevelSetFilter(RealBody &static_contact_body)
+{
+    auto contact_body = std::find(contact_bodies_.begin(), contact_bodies_.end(), &static_contact_body);
+    if (contact_body == contact_bodies_.end())
+    {
+        std::cout << "\n Error: " << static_contact_body.getName() << " is not a contact body of "
+                  << sph_body_.getName() << "!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+    size_t k = contact_body - contact_bodies_.begin();
+    LevelSetShape &level_set_shape =
+        DynamicCast<LevelSetShape>(this, static_contact_body.getInitialShape());
+    // a margin of one particle spacing accounts for the discretization of the level set
+    Real threshold = SMAX(sph_body_.sph_adaptation_->getKernel()->CutOffRadius(),
+                          static_contact_body.sph_adaptation_->getKernel()->CutOffRadius()) +
+                     static_contact_body.sph_adaptation_->ReferenceSpacing();
+    search_candidates_by_level_set_[k] = search_candidate_ptrs_keeper_.createPtr<SearchCandidateByLevelSet>(
+        level_set_shape, *target_cell_linked_lists_[k], threshold);
+}
+//=================================================================================================//
 void ContactRelation::updateConfiguration()
 {
     resetNeighborhoodCurrentSize();
     for (size_t k = 0; k != contact_bodies_.size(); ++k)
     {
+        if (!is_contact_active_[k])
+            continue;
+
+        if (search_candidates_by_level_set_[k] != nullptr)
+        {
+            target_cell_linked_lists_[k]->searchNeighborsByParticles(
+                sph_body_, contact_configuration_[k],
+                *get_search_depths_[k], *get_contact_neighbors_[k], *search_candidates_by_level_set_[k]);
+            continue;
+        }
         target_cell_linked_lists_[k]->searchNeighborsByParticles(
             sph_body_, contact_configuration_[k],
             *get_search_depths_[k], *get_contact_neighbors_[k]);
@@ -59,6 +131,9 @@ void SurfaceContactRelation::updateConfiguration()
     resetNeighborhoodCurrentSize();
     for (size_t k = 0; k != contact_bodies_.size(); ++k)
     {
+        if (!is_contact_active_[k])
+            continue;
+
         target_cell_linked_lists_[k]->searchNeighborsByParticles(
             *body_surface_layer_, contact_configuration_[k],
             *get_search_depths_[k], *get_contact_neighbors_[k]);
@@ -36,6 +36,8 @@
 
 namespace SPH
 {
+class LevelSetShape;
+
 /**
  * @class ContactRelationCrossResolution
  * @brief The relation between a SPH body and its contact SPH bodies
@@ -67,6 +69,34 @@ class ContactRelationCrossResolution : public BaseContactRelation
     StdVec<SearchDepthContact *> get_search_depths_;
 };
 
+/**
+ * @class SearchCandidateByLevelSet
+ * @brief Check whether a particle is close enough to a static contact body with level-set shape
+ * to have neighbors in it. Particles farther than the threshold outside the shape are not searched.
+ * @details The signed distance is probed once for all cells of the target cell linked list.
+ * Only particles in the cells crossed by the threshold distance probe the level set themselves.
+ */
+class SearchCandidateByLevelSet
+{
+  public:
+    SearchCandidateByLevelSet(LevelSetShape &level_set_shape, CellLinkedList &target_cell_linked_list, Real threshold);
+    virtual ~SearchCandidateByLevelSet(){};
+    bool operator()(size_t index_i, const Vecd &position);
+
+  protected:
+    enum CellState : char
+    {
+        FarCell = 0,
+        NearCell = 1,
+        ProbeCell = 2
+    };
+    LevelSetShape &level_set_shape_;
+    CellLinkedList &target_cell_linked_list_;
+    Real threshold_;
+    Arrayi all_cells_;
+    StdLargeVec<char> cell_states_;
+};
+
 /**
  * @class ContactRelation
  * @brief The relation between a SPH body and its contact SPH bodies
@@ -75,14 +105,19 @@ class ContactRelation : public ContactRelationCrossResolution
 {
   protected:
     UniquePtrsKeeper<NeighborBuilderContact> neighbor_builder_contact_ptrs_keeper_;
+    UniquePtrsKeeper<SearchCandidateByLevelSet> search_candidate_ptrs_keeper_;
 
   public:
     ContactRelation(SPHBody &sph_body, RealBodyVector contact_bodies);
     virtual ~ContactRelation(){};
     virtual void updateConfiguration() override;
+    /** Skip the search in a static contact body, such as a fixed wall with level-set shape,
+     * for the particles beyond the cutoff radius from its surface. */
+    void useLevelSetFilter(RealBody &static_contact_body);
 
   protected:
     StdVec<NeighborBuilderContact *> get_contact_neighbors_;
+    StdVec<SearchCandidateByLevelSet *> search_candidates_by_level_set_;
 };
 
 /**
@@ -267,6 +267,9 @@ class BaseTransform
         : rotation_(MatType::Identity()), inv_rotation_(rotation_.transpose()), translation_(translation){};
     BaseTransform() : BaseTransform(VecType::Zero()){};
 
+    MatType getRotationMatrix() const { return rotation_; };
+    VecType getTranslation() const { return translation_; };
+
     /** Forward rotation. */
     VecType xformFrameVecToBase(const VecType &origin)
     {
@@ -0,0 +1,99 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file    data_hash.h
+ * @brief   Hashing of geometric and numerical parameters
+ *          used to identify data cached on disk between runs.
+ * @author  Xiangyu Hu
+ */
+
+#ifndef DATA_HASH_H
+#define DATA_HASH_H
+
+#include "base_data_type.h"
+
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+namespace SPH
+{
+/**
+ * @class DataHash
+ * @brief 64-bit FNV-1a hash accumulated from raw data.
+ * @details Unlike std::hash, the result does not depend on the standard library implementation,
+ * so that it can be used as a key for files reused across runs and builds.
+ */
+class DataHash
+{
+    static constexpr uint64_t offset_basis_ = 14695981039346656037ULL;
+    static constexpr uint64_t prime_ = 1099511628211ULL;
+    uint64_t hash_;
+
+  public:
+    DataHash() : hash_(offset_basis_){};
+
+    DataHash &addBytes(const void *data, size_t size)
+    {
+        const unsigned char *bytes = static_cast<const unsigned char *>(data);
+        for (size_t i = 0; i != size; ++i)
+        {
+            hash_ ^= static_cast<uint64_t>(bytes[i]);
+            hash_ *= prime_;
+        }
+        return *this;
+    };
+
+    template <typename DataType>
+    DataHash &add(const DataType &data)
+    {
+        static_assert(std::is_trivially_copyable<DataType>::value, "DataHash only accepts trivially copyable data!");
+        return addBytes(&data, sizeof(DataType));
+    };
+
+    template <typename ScalarType, int Rows, int Cols, int Options, int MaxRows, int MaxCols>
+    DataHash &add(const Eigen::Matrix<ScalarType, Rows, Cols, Options, MaxRows, MaxCols> &data)
+    {
+        return addBytes(data.data(), sizeof(ScalarType) * data.size());
+    };
+
+    template <typename ScalarType, int Rows, int Cols, int Options, int MaxRows, int MaxCols>
+    DataHash &add(const Eigen::Array<ScalarType, Rows, Cols, Options, MaxRows, MaxCols> &data)
+    {
+        return addBytes(data.data(), sizeof(ScalarType) * data.size());
+    };
+
+    DataHash &add(const std::string &data) { return addBytes(data.data(), data.size()); };
+
+    uint64_t Value() const { return hash_; };
+
+    std::string HexString() const
+    {
+        std::stringstream hex_string;
+        hex_string << std::hex << std::setw(16) << std::setfill('0') << hash_;
+        return hex_string.str();
+    };
+};
+} // namespace SPH
+#endif // DATA_HASH_H
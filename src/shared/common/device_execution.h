@@ -0,0 +1,149 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file    device_execution.h
+ * @brief   The SYCL queue and the device-resident copies of particle data
+ *          for the execution with ParallelDevicePolicy.
+ * @details With SPHINXSYS_USE_SYCL, the device memory is allocated as USM device memory
+ *          and the data are copied explicitly between host and device,
+ *          so that the same data path is used for the CPU device and accelerators.
+ *          Without SYCL, the device memory is a separate host allocation,
+ *          so that code using the device data runs, and can be tested, in both builds.
+ *          The functions executed on the device should capture the device data by value.
+ * @author  Xiangyu Hu
+ */
+
+#ifndef DEVICE_EXECUTION_H
+#define DEVICE_EXECUTION_H
+
+#include "base_data_package.h"
+#include "sph_data_containers.h"
+
+#if SPHINXSYS_USE_SYCL
+#include <sycl/sycl.hpp>
+#endif
+
+namespace SPH
+{
+#if SPHINXSYS_USE_SYCL
+namespace execution
+{
+/**
+ * @class ExecutionQueue
+ * @brief The queue for device execution, which is on the SYCL CPU device.
+ */
+class ExecutionQueue
+{
+  public:
+    static ExecutionQueue &getInstance()
+    {
+        static ExecutionQueue instance;
+        return instance;
+    };
+    sycl::queue &getQueue() { return sycl_queue_; };
+
+  private:
+    sycl::queue sycl_queue_;
+    ExecutionQueue() : sycl_queue_(sycl::cpu_selector_v){};
+};
+} // namespace execution
+#endif // SPHINXSYS_USE_SYCL
+
+template <typename DataType>
+DataType *allocateDeviceData(size_t size)
+{
+#if SPHINXSYS_USE_SYCL
+    return sycl::malloc_device<DataType>(size, execution::ExecutionQueue::getInstance().getQueue());
+#else
+    return new DataType[size];
+#endif
+}
+
+template <typename DataType>
+void freeDeviceData(DataType *device_data)
+{
+#if SPHINXSYS_USE_SYCL
+    sycl::free(device_data, execution::ExecutionQueue::getInstance().getQueue());
+#else
+    delete[] device_data;
+#endif
+}
+
+template <typename DataType>
+void copyToDevice(const DataType *host_data, DataType *device_data, size_t size)
+{
+#if SPHINXSYS_USE_SYCL
+    execution::ExecutionQueue::getInstance().getQueue().memcpy(device_data, host_data, size * sizeof(DataType)).wait();
+#else
+    std::copy(host_data, host_data + size, device_data);
+#endif
+}
+
+template <typename DataType>
+void copyFromDevice(DataType *host_data, const DataType *device_data, size_t size)
+{
+#if SPHINXSYS_USE_SYCL
+    execution::ExecutionQueue::getInstance().getQueue().memcpy(host_data, device_data, size * sizeof(DataType)).wait();
+#else
+    std::copy(device_data, device_data + size, host_data);
+#endif
+}
+
+/**
+ * @class DeviceVariable
+ * @brief The device-resident copy of a particle variable.
+ * The device memory follows the capacity of the host data.
+ */
+template <typename DataType>
+class DeviceVariable
+{
+  public:
+    explicit DeviceVariable(StdLargeVec<DataType> &host_data)
+        : host_data_(host_data), capacity_(host_data.size()),
+          device_data_(allocateDeviceData<DataType>(capacity_)){};
+    DeviceVariable(const DeviceVariable &) = delete;
+    DeviceVariable &operator=(const DeviceVariable &) = delete;
+    ~DeviceVariable() { freeDeviceData(device_data_); };
+
+    DataType *DeviceData() { return device_data_; };
+
+    void copyToDevice(size_t size)
+    {
+        if (host_data_.size() > capacity_)
+        {
+            freeDeviceData(device_data_);
+            capacity_ = host_data_.size();
+            device_data_ = allocateDeviceData<DataType>(capacity_);
+        }
+        SPH::copyToDevice(host_data_.data(), device_data_, size);
+    };
+
+    void copyFromDevice(size_t size) { SPH::copyFromDevice(host_data_.data(), device_data_, size); };
+
+  protected:
+    StdLargeVec<DataType> &host_data_;
+    size_t capacity_;
+    DataType *device_data_;
+};
+} // namespace SPH
+#endif // DEVICE_EXECUTION_H
@@ -85,6 +85,7 @@ class ImageMHD
     void set_transformMatrix(Mat3d transformMatrix)
     {
         transformMatrix_ = transformMatrix;
+        inverseTransformMatrix_ = transformMatrix.inverse();
     };
     void set_offset(Vec3d offset)
     {
@@ -124,8 +125,21 @@ class ImageMHD
 
     Vec3d findClosestPoint(const Vec3d &probe_point);
     BoundingBox findBounds();
+    /** Trilinear interpolation from the 8 voxels surrounding the probe point, no heap allocation. */
     Real findValueAtPoint(const Vec3d &probe_point);
+    Vec3d findGradientAtPoint(const Vec3d &probe_point);
     Vec3d findNormalAtPoint(const Vec3d &probe_point);
+    /** Batched probes, evaluated in parallel. The output vectors are resized to the number of probes. */
+    void findValuesAtPoints(const StdVec<Vec3d> &probe_points, StdVec<Real> &values);
+    void findNormalsAtPoints(const StdVec<Vec3d> &probe_points, StdVec<Vec3d> &normals);
+    /**
+     * Replace the image data by the signed distance (negative inside) to the region
+     * given by a binary mask (voxel value > threshold) or a label (voxel value == label).
+     * An exact Euclidean distance transform is used, which works on separable passes along
+     * the three image axes and is executed in parallel for all lines of each pass.
+     */
+    void convertMaskToSignedDistance(Real threshold = 0.5);
+    void convertLabelToSignedDistance(T label);
 
     void write(std::string filename, Output_Mode = BINARY);
 
@@ -136,6 +150,7 @@ class ImageMHD
     bool binaryDataByteOrderMSB_;
     bool compressedData_;
     Mat3d transformMatrix_;
+    Mat3d inverseTransformMatrix_;
     Vec3d offset_;
     Vec3d centerOfRotation_;
     Vec3d elementSpacing_;
@@ -151,11 +166,21 @@ class ImageMHD
     Real max_value_;
     T *data_;
 
-    std::vector<int> findNeighbors(const Vec3d &probe_point, Array3i &this_cell);
-    Vec3d computeGradientAtCell(int i);
-    Vec3d computeNormalAtCell(int i);
-    T getValueAtCell(int i);
+    /** find the lower corner voxel of the interpolation stencil and the local coordinates within it. */
+    bool findStencil(const Vec3d &probe_point, Array3i &lower_cell, Vec3d &fraction);
+    /** the stencil voxel at the given offset from the lower corner, kept within a singleton axis of the image. */
+    Array3i stencilCell(const Array3i &lower_cell, const Array3i &offset) { return (lower_cell + offset).min(dimSize_ - 1); };
+    Vec3d computeGradientAtCell(const Array3i &cell);
+    int cellIndex(const Array3i &cell) { return (cell[2] * height_ + cell[1]) * width_ + cell[0]; };
+    T getValueAtCell(const Array3i &cell) { return data_[cellIndex(cell)]; };
+    Vec3d convertToImageSpace(const Vec3d &position);
     Vec3d convertToPhysicalSpace(Vec3d p);
+    void updateValueRange();
+    template <typename ElementType>
+    void readRawData(std::ifstream &raw_file);
+    template <typename InsideFunction>
+    void computeSignedDistance(const InsideFunction &is_inside);
+    void computeSquaredDistance(StdLargeVec<Real> &squared_distance);
     void split(const std::string &s, char delim, std::vector<std::string> &elems);
 };
 
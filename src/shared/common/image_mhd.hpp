@@ -23,6 +23,7 @@ ImageMHD<T, nDims>::ImageMHD(std::string full_path_to_file)
       binaryDataByteOrderMSB_(false),
       compressedData_(false),
       transformMatrix_(Matd::Identity()),
+      inverseTransformMatrix_(Matd::Identity()),
       offset_(Vecd::Zero()),
       centerOfRotation_(Vecd::Zero()),
       elementSpacing_(Vecd::Ones()),
@@ -67,6 +68,7 @@ ImageMHD<T, nDims>::ImageMHD(std::string full_path_to_file)
                     transformMatrix_(2, 0) = std::stof(values[6]);
                     transformMatrix_(2, 1) = std::stof(values[7]);
                     transformMatrix_(2, 2) = std::stof(values[8]);
+                    inverseTransformMatrix_ = transformMatrix_.inverse();
                 }
                 else if (elements[0].compare("Offset") == 0)
                 {
@@ -98,6 +100,15 @@ ImageMHD<T, nDims>::ImageMHD(std::string full_path_to_file)
                     if (data_ == nullptr)
                         data_ = new T[dimSize_[0] * dimSize_[1] * dimSize_[2]];
                 }
+                else if (elements[0].compare("ElementType") == 0)
+                {
+                    if (elements[1].compare("MET_UCHAR") == 0)
+                        elementType_ = MET_UCHAR;
+                    else if (elements[1].compare("MET_LONG") == 0)
+                        elementType_ = MET_LONG;
+                    else
+                        elementType_ = MET_FLOAT;
+                }
                 else if (elements[0].compare("ElementDataFile") == 0)
                 {
                     full_path_to_file = full_path_to_file.substr(0, full_path_to_file.find_last_of("\\/"));
@@ -118,18 +129,14 @@ ImageMHD<T, nDims>::ImageMHD(std::string full_path_to_file)
 
     if (dataFileRaw.is_open())
     {
-        dataFileRaw.read((char *)data_, sizeof(T) * size_);
-        T distance = 0;
-        for (int index = 0; index < size_; index++)
-        {
-            distance = data_[index];
-            data_[index] = distance;
-            // std::cout <<index <<" "<< distance << '\n';
-            if (distance < min_value_)
-                min_value_ = distance;
-            if (distance > max_value_)
-                max_value_ = distance;
-        }
+        //- the voxel values are converted to the image data type, e.g. for label images
+        if (elementType_ == MET_UCHAR)
+            readRawData<unsigned char>(dataFileRaw);
+        else if (elementType_ == MET_LONG)
+            readRawData<int32_t>(dataFileRaw);
+        else
+            readRawData<float>(dataFileRaw);
+        updateValueRange();
     }
     dataFileRaw.close();
 
@@ -143,6 +150,7 @@ ImageMHD<T, nDims>::ImageMHD(Real radius, Array3i NxNyNz, Vec3d spacings)
       binaryDataByteOrderMSB_(false),
       compressedData_(false),
       transformMatrix_(Matd::Identity()),
+      inverseTransformMatrix_(Matd::Identity()),
       offset_(Vecd(-0.5 * NxNyNz[0] * spacings[0], -0.5 * NxNyNz[1] * spacings[1], -0.5 * NxNyNz[2] * spacings[2])),
       centerOfRotation_(Vecd::Zero()),
       elementSpacing_(spacings),
@@ -162,23 +170,20 @@ ImageMHD<T, nDims>::ImageMHD(Real radius, Array3i NxNyNz, Vec3d spacings)
         data_ = new float[size_];
 
     Vecd center(0.5 * width_, 0.5 * height_, 0.5 * depth_);
-
-    for (int z = 0; z < depth_; z++)
-    {
-        for (int y = 0; y < height_; y++)
+    parallel_for(
+        IndexRange(0, depth_),
+        [&](const IndexRange &r)
         {
-            for (int x = 0; x < width_; x++)
-            {
-                int index = z * width_ * height_ + y * width_ + x;
-                Real distance = (Vecd(x, y, z) - center).norm() - radius;
-                if (distance < min_value_)
-                    min_value_ = distance;
-                if (distance > max_value_)
-                    max_value_ = distance;
-                data_[index] = float(distance);
-            }
-        }
-    }
+            for (size_t z = r.begin(); z != r.end(); ++z)
+                for (int y = 0; y < height_; y++)
+                    for (int x = 0; x < width_; x++)
+                    {
+                        Real distance = (Vecd(x, y, z) - center).norm() - radius;
+                        data_[cellIndex(Array3i(x, y, int(z)))] = float(distance);
+                    }
+        },
+        ap);
+    updateValueRange();
     write(std::string("sphere"), BINARY);
 }
 
@@ -187,148 +192,91 @@ ImageMHD<T, nDims>::~ImageMHD()
 {
     if (data_)
     {
-        delete data_;
+        delete[] data_;
         data_ = nullptr;
     }
 }
 
 //=================================================================================================//
 template <typename T, int nDims>
-std::vector<int> ImageMHD<T, nDims>::findNeighbors(const Vec3d &probe_point, Array3i &this_cell)
+template <typename ElementType>
+void ImageMHD<T, nDims>::readRawData(std::ifstream &raw_file)
 {
-    std::vector<int> neighbors;
-
-    Vec3d image_coord = transformMatrix_.inverse() * (probe_point - offset_);
-    // std::cout <<"findNeighbor of " << probe_point << " ........... " << image_coord << std::endl;
-
-    int z = int(floor(image_coord[2]));
-    int y = int(floor(image_coord[1]));
-    int x = int(floor(image_coord[0]));
-
-    //- cannot count cells in buffer zone
-    if (x < 0 || x > width_ - 1 || y < 0 || y > height_ - 1 || z < 0 || z > depth_ - 1)
-        return neighbors;
-
-    for (int k = z - 1; k < z + 2; k = k + 2)
+    if (std::is_same<ElementType, T>::value)
     {
-        for (int j = y - 1; j < y + 2; j = j + 2)
-        {
-            for (int i = x - 1; i < x + 2; i = i + 2)
-            {
-                if (i < 0 || i > width_ - 1 || j < 0 || j > height_ - 1 || k < 0 || k > depth_)
-                    continue;
-                int index = z * width_ * height_ + y * width_ + x;
-                neighbors.push_back(index);
-            }
-        }
+        raw_file.read((char *)data_, sizeof(T) * size_);
+        return;
     }
 
-    return neighbors;
+    StdVec<ElementType> raw_data(size_);
+    raw_file.read((char *)raw_data.data(), sizeof(ElementType) * size_);
+    for (int index = 0; index < size_; index++)
+    {
+        data_[index] = T(raw_data[index]);
+    }
+    elementType_ = MET_FLOAT;
 }
 //=================================================================================================//
 template <typename T, int nDims>
-Vec3d ImageMHD<T, nDims>::computeGradientAtCell(int i)
+void ImageMHD<T, nDims>::updateValueRange()
 {
-    //- translate 1D index to 3D index
-    int width = width_;
-    int height = height_;
-    int depth = depth_;
-    int sliceSize = width * height;
-    int z = i / sliceSize;
-    int y = (i % sliceSize) / width;
-    int x = (i % sliceSize) % width;
-
-    Real grad_x = 0.0;
-    Real grad_y = 0.0;
-    Real grad_z = 0.0;
-    //- cds (if inner cell)
-    //- otherwise back/forward scheme
-    if (x == 0)
-    {
-        int indexHigh = z * sliceSize + y * width + (x + 1);
-        grad_x = (getValueAtCell(indexHigh) - getValueAtCell(i));
-    }
-    else if (x == width - 1)
-    {
-        int indexLow = z * sliceSize + y * width + (x - 1);
-        grad_x = -(getValueAtCell(indexLow) - getValueAtCell(i));
-    }
-    else if (x > 0 && x < width_ - 1)
-    {
-        int indexHigh = z * sliceSize + y * width + (x + 1);
-        int indexLow = z * sliceSize + y * width + (x - 1);
-        grad_x = (getValueAtCell(indexHigh) - getValueAtCell(indexLow)) / 2.0;
-    }
-
-    if (y == 0)
-    {
-        int indexHigh = z * sliceSize + (y + 1) * width + x;
-        grad_y = (getValueAtCell(indexHigh) - getValueAtCell(i));
-    }
-    else if (y == height - 1)
-    {
-        int indexLow = z * sliceSize + (y - 1) * width + x;
-        grad_y = -(getValueAtCell(indexLow) - getValueAtCell(i));
-    }
-    else if (y > 0 && y < height_ - 1)
-    {
-        int indexHigh = z * sliceSize + (y + 1) * width + x;
-        int indexLow = z * sliceSize + (y - 1) * width + x;
-        grad_y = (getValueAtCell(indexHigh) - getValueAtCell(indexLow)) / 2.0;
-    }
-
-    if (z == 0)
+    min_value_ = MaxReal;
+    max_value_ = MinReal;
+    for (int index = 0; index < size_; index++)
     {
-        int indexHigh = (z + 1) * sliceSize + y * width + x;
-        grad_z = (getValueAtCell(indexHigh) - getValueAtCell(i));
+        Real value = data_[index];
+        min_value_ = SMIN(min_value_, value);
+        max_value_ = SMAX(max_value_, value);
     }
-    else if (z == depth - 1)
-    {
-        int indexLow = (z - 1) * sliceSize + y * width + x;
-        grad_z = -(getValueAtCell(indexLow) - getValueAtCell(i));
-    }
-    else if (z > 0 && z < depth_ - 1)
-    {
-        int indexHigh = (z + 1) * sliceSize + y * width + x;
-        int indexLow = (z - 1) * sliceSize + y * width + x;
-        grad_z = (getValueAtCell(indexHigh) - getValueAtCell(indexLow)) / 2.0;
-    }
-    grad_x = grad_x / elementSpacing_[0];
-    grad_y = grad_y / elementSpacing_[1];
-    grad_z = grad_z / elementSpacing_[2];
-    return Vec3d(grad_x, grad_y, grad_z);
 }
 //=================================================================================================//
 template <typename T, int nDims>
-Vec3d ImageMHD<T, nDims>::computeNormalAtCell(int i)
+Vec3d ImageMHD<T, nDims>::convertToImageSpace(const Vec3d &position)
 {
-    Vec3d grad_phi = computeGradientAtCell(i);
-    Vec3d n = grad_phi.normalized();
-    return n;
+    return (inverseTransformMatrix_ * (position - offset_)).cwiseQuotient(elementSpacing_);
 }
-
+//=================================================================================================//
 template <typename T, int nDims>
-T ImageMHD<T, nDims>::getValueAtCell(int i)
+bool ImageMHD<T, nDims>::findStencil(const Vec3d &probe_point, Array3i &lower_cell, Vec3d &fraction)
 {
-    if (i < 0 || i > size_)
+    Vec3d image_coord = convertToImageSpace(probe_point);
+    for (int d = 0; d != 3; ++d)
     {
-        return float(max_value_);
+        //- cannot probe outside of the voxel centers
+        if (image_coord[d] < 0.0 || image_coord[d] > Real(dimSize_[d] - 1))
+            return false;
+
+        lower_cell[d] = SMAX(SMIN(int(floor(image_coord[d])), dimSize_[d] - 2), 0);
+        fraction[d] = image_coord[d] - Real(lower_cell[d]);
     }
-    else
+    return true;
+}
+//=================================================================================================//
+template <typename T, int nDims>
+Vec3d ImageMHD<T, nDims>::computeGradientAtCell(const Array3i &cell)
+{
+    //- cds (if inner cell)
+    //- otherwise back/forward scheme
+    Vec3d gradient = Vec3d::Zero();
+    for (int d = 0; d != 3; ++d)
     {
-        return data_[i];
+        if (dimSize_[d] < 2)
+            continue;
+
+        Array3i cell_low = cell;
+        Array3i cell_high = cell;
+        cell_low[d] = SMAX(cell[d] - 1, 0);
+        cell_high[d] = SMIN(cell[d] + 1, dimSize_[d] - 1);
+        Real difference = Real(getValueAtCell(cell_high)) - Real(getValueAtCell(cell_low));
+        gradient[d] = difference / (Real(cell_high[d] - cell_low[d]) * elementSpacing_[d]);
     }
+    return gradient;
 }
 //=================================================================================================//
 template <typename T, int nDims>
 Vec3d ImageMHD<T, nDims>::convertToPhysicalSpace(Vec3d p)
 {
-    Vec3d position = transformMatrix_ * p + offset_;
-    for (int i = 0; i < position.size(); i++)
-    {
-        position[i] = position[i] * elementSpacing_[i];
-    }
-    return position;
+    return transformMatrix_ * p.cwiseProduct(elementSpacing_) + offset_;
 }
 //=================================================================================================//
 template <typename T, int nDims>
@@ -347,43 +295,31 @@ void ImageMHD<T, nDims>::split(const std::string &s, char delim,
 template <typename T, int nDims>
 Vec3d ImageMHD<T, nDims>::findClosestPoint(const Vec3d &probe_point)
 {
-    Array3i this_cell = Array3i::Zero();
-    std::vector<int> neighbors = findNeighbors(probe_point, this_cell);
-    Vec3d n_sum = Vecd::Zero();
-    Real weight_sum = 0.0;
-    Real d_sum = 0.0;
-    for (const int &i : neighbors)
-    {
-        // checkIndexBound(i);
-        Vec3d nCj = computeNormalAtCell(i);
-        Real dCj = float(getValueAtCell(i));
-        Real weight_Cj = 1.0 / (fabs(dCj) + Eps);
-        n_sum = n_sum + weight_Cj * nCj;
-        weight_sum = weight_sum + weight_Cj;
-        d_sum = d_sum + dCj;
-    }
-    Vec3d n = n_sum / (weight_sum + Eps);
-    Real d = d_sum / (weight_sum + Eps);
+    Array3i lower_cell = Array3i::Zero();
+    Vec3d fraction = Vec3d::Zero();
+    if (!findStencil(probe_point, lower_cell, fraction))
+        return probe_point;
 
-    Vec3d p_image = Vec3d(this_cell[0], this_cell[1], this_cell[2]) + n.normalized() * d;
-    Vec3d p = convertToPhysicalSpace(p_image);
-    return p;
+    Real phi = findValueAtPoint(probe_point);
+    Vec3d n = findNormalAtPoint(probe_point);
+    return probe_point - phi * n;
 }
-
+//=================================================================================================//
 template <typename T, int nDims>
 BoundingBox ImageMHD<T, nDims>::findBounds()
 {
     // initial reference values
     Vec3d lower_bound = MaxReal * Vec3d::Ones();
-    Vec3d upper_bound = MinReal * Vec3d::Ones();
+    Vec3d upper_bound = -MaxReal * Vec3d::Ones();
 
-    for (int z = 0; z < depth_ + 1; z++)
+    //- the mapping is affine, so that the corners of the image give the bounds
+    for (int z = 0; z < 2; z++)
     {
-        for (int y = 0; y < height_ + 1; y++)
+        for (int y = 0; y < 2; y++)
         {
-            for (int x = 0; x < width_ + 1; x++)
+            for (int x = 0; x < 2; x++)
             {
-                Vec3d p_image = Vec3d(x, y, z);
+                Vec3d p_image = Vec3d(x * width_, y * height_, z * depth_);
                 Vec3d vertex_position = convertToPhysicalSpace(p_image);
                 for (int j = 0; j != 3; ++j)
                 {
@@ -395,61 +331,214 @@ BoundingBox ImageMHD<T, nDims>::findBounds()
     }
     return BoundingBox(lower_bound, upper_bound);
 }
-
+//=================================================================================================//
 template <typename T, int nDims>
 Real ImageMHD<T, nDims>::findValueAtPoint(const Vec3d &probe_point)
 {
-    Array3i this_cell;
-    std::vector<int> neighbors = findNeighbors(probe_point, this_cell);
-    Real weight_sum = 0.0;
-    Real d_sum = 0.0;
-    if (neighbors.size() > 0)
-    {
-        for (const int &i : neighbors)
-        {
-            // checkIndexBound(i);
-            Real dCj = float(getValueAtCell(i));
-            Real weight_Cj = 1.0 / (fabs(dCj) + Eps);
-            weight_sum = weight_sum + weight_Cj;
-            d_sum = d_sum + dCj;
-        }
-        return d_sum / (weight_sum + Eps);
-    }
-    else
-    {
+    Array3i lower_cell = Array3i::Zero();
+    Vec3d fraction = Vec3d::Zero();
+    if (!findStencil(probe_point, lower_cell, fraction))
         return max_value_;
-    }
+
+    Real value = 0.0;
+    for (int k = 0; k < 2; k++)
+        for (int j = 0; j < 2; j++)
+            for (int i = 0; i < 2; i++)
+            {
+                Real weight = (i == 0 ? 1.0 - fraction[0] : fraction[0]) *
+                              (j == 0 ? 1.0 - fraction[1] : fraction[1]) *
+                              (k == 0 ? 1.0 - fraction[2] : fraction[2]);
+                value += weight * Real(getValueAtCell(stencilCell(lower_cell, Array3i(i, j, k))));
+            }
+    return value;
+}
+//=================================================================================================//
+template <typename T, int nDims>
+Vec3d ImageMHD<T, nDims>::findGradientAtPoint(const Vec3d &probe_point)
+{
+    Array3i lower_cell = Array3i::Zero();
+    Vec3d fraction = Vec3d::Zero();
+    if (!findStencil(probe_point, lower_cell, fraction))
+        return Vec3d::Zero();
+
+    Vec3d gradient = Vec3d::Zero();
+    for (int k = 0; k < 2; k++)
+        for (int j = 0; j < 2; j++)
+            for (int i = 0; i < 2; i++)
+            {
+                Real weight = (i == 0 ? 1.0 - fraction[0] : fraction[0]) *
+                              (j == 0 ? 1.0 - fraction[1] : fraction[1]) *
+                              (k == 0 ? 1.0 - fraction[2] : fraction[2]);
+                gradient += weight * computeGradientAtCell(stencilCell(lower_cell, Array3i(i, j, k)));
+            }
+    return gradient;
 }
 //=================================================================================================//
 template <typename T, int nDims>
 Vec3d ImageMHD<T, nDims>::findNormalAtPoint(const Vec3d &probe_point)
 {
-    Array3i this_cell = Array3i::Zero();
-    std::vector<int> neighbors = findNeighbors(probe_point, this_cell);
-    Vec3d n_sum = Vecd::Zero();
-    Real weight_sum = 0.0;
-    Real d_sum = 0.0;
-    if (neighbors.size() > 0)
-    {
-        for (const int &i : neighbors)
+    Vec3d gradient = findGradientAtPoint(probe_point);
+    Real gradient_norm = gradient.norm();
+    return gradient_norm > Eps ? Vec3d(gradient / gradient_norm) : Vec3d(Vec3d::Ones().normalized());
+}
+//=================================================================================================//
+template <typename T, int nDims>
+void ImageMHD<T, nDims>::findValuesAtPoints(const StdVec<Vec3d> &probe_points, StdVec<Real> &values)
+{
+    values.resize(probe_points.size());
+    parallel_for(
+        IndexRange(0, probe_points.size()),
+        [&](const IndexRange &r)
         {
-            // checkIndexBound(i);
-            Vec3d nCj = computeNormalAtCell(i);
-            Real dCj = float(getValueAtCell(i));
-            Real weight_Cj = 1.0 / (fabs(dCj) + Eps);
-            n_sum = n_sum + weight_Cj * nCj;
-            weight_sum = weight_sum + weight_Cj;
-            d_sum = d_sum + dCj;
-        }
-        Vec3d n = n_sum / (weight_sum + Eps);
-        return n.normalized();
+            for (size_t i = r.begin(); i != r.end(); ++i)
+                values[i] = findValueAtPoint(probe_points[i]);
+        },
+        ap);
+}
+//=================================================================================================//
+template <typename T, int nDims>
+void ImageMHD<T, nDims>::findNormalsAtPoints(const StdVec<Vec3d> &probe_points, StdVec<Vec3d> &normals)
+{
+    normals.resize(probe_points.size());
+    parallel_for(
+        IndexRange(0, probe_points.size()),
+        [&](const IndexRange &r)
+        {
+            for (size_t i = r.begin(); i != r.end(); ++i)
+                normals[i] = findNormalAtPoint(probe_points[i]);
+        },
+        ap);
+}
+//=================================================================================================//
+template <typename T, int nDims>
+void ImageMHD<T, nDims>::convertMaskToSignedDistance(Real threshold)
+{
+    computeSignedDistance([&](T value)
+                          { return Real(value) > threshold; });
+}
+//=================================================================================================//
+template <typename T, int nDims>
+void ImageMHD<T, nDims>::convertLabelToSignedDistance(T label)
+{
+    computeSignedDistance([&](T value)
+                          { return value == label; });
+}
+//=================================================================================================//
+template <typename T, int nDims>
+template <typename InsideFunction>
+void ImageMHD<T, nDims>::computeSignedDistance(const InsideFunction &is_inside)
+{
+    Real infinity = std::numeric_limits<Real>::infinity();
+    StdLargeVec<Real> distance_outside(size_);
+    StdLargeVec<Real> distance_inside(size_);
+    bool has_inside = false;
+    bool has_outside = false;
+    for (int index = 0; index < size_; index++)
+    {
+        bool inside = is_inside(data_[index]);
+        has_inside = has_inside || inside;
+        has_outside = has_outside || !inside;
+        distance_outside[index] = inside ? 0.0 : infinity;
+        distance_inside[index] = inside ? infinity : 0.0;
     }
-    else
+
+    if (!has_inside || !has_outside)
     {
-        return Vec3d::Ones();
+        std::cout << "\n Error: the image has no interface between inside and outside voxels!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
     }
+
+    computeSquaredDistance(distance_outside);
+    computeSquaredDistance(distance_inside);
+
+    //- the interface is located halfway between the inside and outside voxel centers
+    Real half_spacing = 0.5 * elementSpacing_.minCoeff();
+    parallel_for(
+        IndexRange(0, size_),
+        [&](const IndexRange &r)
+        {
+            for (size_t index = r.begin(); index != r.end(); ++index)
+            {
+                Real phi = distance_outside[index] > 0.0
+                               ? sqrt(distance_outside[index]) - half_spacing
+                               : half_spacing - sqrt(distance_inside[index]);
+                data_[index] = T(phi);
+            }
+        },
+        ap);
+    elementType_ = MET_FLOAT;
+    updateValueRange();
 }
+//=================================================================================================//
+template <typename T, int nDims>
+void ImageMHD<T, nDims>::computeSquaredDistance(StdLargeVec<Real> &squared_distance)
+{
+    Real infinity = std::numeric_limits<Real>::infinity();
+    int max_length = dimSize_.maxCoeff();
+    for (int axis = 0; axis != 3; ++axis)
+    {
+        int length = dimSize_[axis];
+        int stride = axis == 0 ? 1 : (axis == 1 ? width_ : width_ * height_);
+        int number_of_lines = size_ / length;
+        Real spacing = elementSpacing_[axis];
+        parallel_for(
+            IndexRange(0, number_of_lines),
+            [&](const IndexRange &r)
+            {
+                //- work arrays are allocated once for a range of lines
+                StdVec<Real> f(max_length), parabola_bound(max_length + 1);
+                StdVec<int> parabola_vertex(max_length);
+                for (size_t line = r.begin(); line != r.end(); ++line)
+                {
+                    int start = axis == 0 ? int(line) * width_
+                                          : (axis == 1 ? (int(line) / width_) * width_ * height_ + int(line) % width_
+                                                       : int(line));
+                    for (int q = 0; q < length; q++)
+                        f[q] = squared_distance[start + q * stride];
+
+                    //- lower envelope of the parabolas rooted at the voxel centers
+                    int k = -1;
+                    for (int q = 0; q < length; q++)
+                    {
+                        if (f[q] == infinity)
+                            continue;
+                        Real position = Real(q) * spacing;
+                        Real s = -infinity;
+                        while (k >= 0)
+                        {
+                            Real vertex_position = Real(parabola_vertex[k]) * spacing;
+                            s = ((f[q] + position * position) -
+                                 (f[parabola_vertex[k]] + vertex_position * vertex_position)) /
+                                (2.0 * (position - vertex_position));
+                            if (s > parabola_bound[k])
+                                break;
+                            k--;
+                            s = -infinity;
+                        }
+                        k++;
+                        parabola_vertex[k] = q;
+                        parabola_bound[k] = s;
+                        parabola_bound[k + 1] = infinity;
+                    }
+
+                    if (k < 0)
+                        continue; // no finite distance along this line yet
 
+                    k = 0;
+                    for (int q = 0; q < length; q++)
+                    {
+                        Real position = Real(q) * spacing;
+                        while (parabola_bound[k + 1] < position)
+                            k++;
+                        Real offset = position - Real(parabola_vertex[k]) * spacing;
+                        squared_distance[start + q * stride] = offset * offset + f[parabola_vertex[k]];
+                    }
+                }
+            },
+            ap);
+    }
+}
 //=================================================================================================//
 template <typename T, int nDims>
 void ImageMHD<T, nDims>::write(std::string filename, Output_Mode mode)
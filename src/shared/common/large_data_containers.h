@@ -42,7 +42,8 @@
 namespace SPH
 {
 
-static tbb::affinity_partitioner ap;
+/** One partitioner per thread, as loops may be started concurrently from tasks, e.g. by SPHSystem. */
+static thread_local tbb::affinity_partitioner ap;
 typedef tbb::blocked_range<size_t> IndexRange;
 typedef tbb::blocked_range2d<size_t> IndexRange2d;
 typedef tbb::blocked_range3d<size_t> IndexRange3d;
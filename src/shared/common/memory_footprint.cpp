@@ -0,0 +1,145 @@
+#include "memory_footprint.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <vector>
+
+namespace SPH
+{
+//=================================================================================================//
+MemoryFootprint::Registry &MemoryFootprint::getRegistry()
+{
+    static Registry *registry = new Registry;
+    return *registry;
+}
+//=================================================================================================//
+size_t MemoryFootprint::record(const std::string &owner, const std::string &name,
+                               const std::string &subsystem, size_t bytes)
+{
+    Registry &registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex_);
+    size_t entry_id = registry.next_entry_id_++;
+    registry.entries_[entry_id] = Entry{owner, name, subsystem, bytes, nullptr};
+    registry.fixed_bytes_ += bytes;
+    registry.peak_bytes_ = std::max(registry.peak_bytes_, registry.fixed_bytes_);
+    return entry_id;
+}
+//=================================================================================================//
+size_t MemoryFootprint::recordDynamic(const std::string &owner, const std::string &name,
+                                      const std::string &subsystem, const std::function<size_t()> &evaluate_bytes)
+{
+    Registry &registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex_);
+    size_t entry_id = registry.next_entry_id_++;
+    registry.entries_[entry_id] = Entry{owner, name, subsystem, 0, evaluate_bytes};
+    return entry_id;
+}
+//=================================================================================================//
+void MemoryFootprint::release(size_t entry_id)
+{
+    if (entry_id == NoEntry)
+        return;
+
+    Registry &registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex_);
+    auto entry = registry.entries_.find(entry_id);
+    if (entry != registry.entries_.end())
+    {
+        if (!entry->second.evaluate_bytes_)
+            registry.fixed_bytes_ -= entry->second.bytes_;
+        registry.entries_.erase(entry);
+    }
+}
+//=================================================================================================//
+size_t MemoryFootprint::updateLiveBytes(Registry &registry)
+{
+    size_t live_bytes = registry.fixed_bytes_;
+    for (auto &entry : registry.entries_)
+    {
+        if (entry.second.evaluate_bytes_)
+        {
+            entry.second.bytes_ = entry.second.evaluate_bytes_();
+            live_bytes += entry.second.bytes_;
+        }
+    }
+    registry.peak_bytes_ = std::max(registry.peak_bytes_, live_bytes);
+    return live_bytes;
+}
+//=================================================================================================//
+size_t MemoryFootprint::LiveBytes()
+{
+    Registry &registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex_);
+    return updateLiveBytes(registry);
+}
+//=================================================================================================//
+size_t MemoryFootprint::PeakBytes()
+{
+    Registry &registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex_);
+    updateLiveBytes(registry);
+    return registry.peak_bytes_;
+}
+//=================================================================================================//
+void MemoryFootprint::writeReport(std::ostream &out)
+{
+    Registry &registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex_);
+    size_t live_bytes = updateLiveBytes(registry);
+
+    std::map<std::string, size_t> subsystem_bytes;
+    std::map<std::string, size_t> owner_bytes;
+    std::vector<const Entry *> entries;
+    for (const auto &entry : registry.entries_)
+    {
+        subsystem_bytes[entry.second.subsystem_] += entry.second.bytes_;
+        owner_bytes[entry.second.owner_] += entry.second.bytes_;
+        entries.push_back(&entry.second);
+    }
+    std::sort(entries.begin(), entries.end(),
+              [](const Entry *a, const Entry *b)
+              { return a->bytes_ > b->bytes_; });
+
+    auto megabytes = [](size_t bytes)
+    { return double(bytes) / (1024.0 * 1024.0); };
+
+    out << "\n Memory footprint: live " << std::fixed << std::setprecision(2) << megabytes(live_bytes)
+        << " MB, peak " << megabytes(registry.peak_bytes_) << " MB." << std::endl;
+    out << " By subsystem:" << std::endl;
+    for (const auto &subsystem : subsystem_bytes)
+    {
+        out << "  " << std::setw(24) << std::left << subsystem.first << std::right
+            << std::setw(12) << megabytes(subsystem.second) << " MB" << std::endl;
+    }
+    out << " By owner:" << std::endl;
+    for (const auto &owner : owner_bytes)
+    {
+        out << "  " << std::setw(24) << std::left << (owner.first.empty() ? "(unnamed)" : owner.first)
+            << std::right << std::setw(12) << megabytes(owner.second) << " MB" << std::endl;
+    }
+    out << " By allocation:" << std::endl;
+    for (const Entry *entry : entries)
+    {
+        out << "  " << std::setw(24) << std::left << (entry->owner_.empty() ? "(unnamed)" : entry->owner_)
+            << std::setw(32) << entry->name_ << std::setw(24) << entry->subsystem_ << std::right
+            << std::setw(12) << megabytes(entry->bytes_) << " MB" << std::endl;
+    }
+    out << std::defaultfloat;
+}
+//=================================================================================================//
+void MemoryFootprint::writeReportAtExit()
+{
+    Registry &registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex_);
+    if (!registry.is_report_at_exit_)
+    {
+        registry.is_report_at_exit_ = true;
+        std::atexit([]()
+                    { std::cout << "\n Memory footprint: peak " << std::fixed << std::setprecision(2)
+                                << double(MemoryFootprint::PeakBytes()) / (1024.0 * 1024.0)
+                                << " MB." << std::defaultfloat << std::endl; });
+    }
+}
+//=================================================================================================//
+} // namespace SPH
@@ -0,0 +1,91 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file    memory_footprint.h
+ * @brief   Accounting of the memory allocated for particle, configuration and mesh data.
+ * @details Each allocation is recorded with its owner (usually a body), name and subsystem.
+ *          Allocations with fixed size are accounted when recorded and released.
+ *          Allocations growing at run time, such as particle configurations,
+ *          are recorded with a function evaluating their current size,
+ *          which is called only when the live total is computed.
+ *          Therefore, the peak total is only updated at those moments.
+ * @author  Xiangyu Hu
+ */
+
+#ifndef MEMORY_FOOTPRINT_H
+#define MEMORY_FOOTPRINT_H
+
+#include <functional>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace SPH
+{
+/**
+ * @class MemoryFootprint
+ * @brief Global registry of the tagged allocations.
+ */
+class MemoryFootprint
+{
+  public:
+    /** entry id returned for no recorded allocation, releasing it does nothing. */
+    static constexpr size_t NoEntry = 0;
+
+    static size_t record(const std::string &owner, const std::string &name,
+                         const std::string &subsystem, size_t bytes);
+    static size_t recordDynamic(const std::string &owner, const std::string &name,
+                                const std::string &subsystem, const std::function<size_t()> &evaluate_bytes);
+    static void release(size_t entry_id);
+    static size_t LiveBytes();
+    static size_t PeakBytes();
+    static void writeReport(std::ostream &out = std::cout);
+    /** write the peak to the standard output when the program exits. */
+    static void writeReportAtExit();
+
+  private:
+    struct Entry
+    {
+        std::string owner_, name_, subsystem_;
+        size_t bytes_;
+        std::function<size_t()> evaluate_bytes_;
+    };
+
+    struct Registry
+    {
+        std::mutex mutex_;
+        std::map<size_t, Entry> entries_;
+        size_t next_entry_id_ = 1;
+        size_t fixed_bytes_ = 0;
+        size_t peak_bytes_ = 0;
+        bool is_report_at_exit_ = false;
+    };
+
+    /** never destroyed, so that entries can be released at any time before the program exits */
+    static Registry &getRegistry();
+    /** update the sizes of dynamic entries and the peak, the registry should be locked */
+    static size_t updateLiveBytes(Registry &registry);
+};
+} // namespace SPH
+#endif // MEMORY_FOOTPRINT_H
@@ -38,6 +38,9 @@ namespace SPH
 class Base;             // Indicating base class
 class Adaptive;         // Indicating with adaptive resolution
 class Lattice;          // Indicating with lattice points
+class Split;            // Indicating with splitting particles of a coarser body
+class Cached;           // Indicating with reusing data cached from previous runs
+class Shared;           // Indicating with reusing data shared by other bodies in the same run
 class UnstructuredMesh; // Indicating with unstructured mesh
 class BaseMaterial;
 class SPHBody;
@@ -1,5 +1,7 @@
 #include "base_geometry.h"
 
+#include "data_hash.h"
+
 namespace SPH
 {
 //=================================================================================================//
@@ -46,11 +48,88 @@ Vecd Shape::findNormalDirection(const Vecd &probe_point)
     return is_contain ? direction_to_surface : -1.0 * direction_to_surface;
 }
 //=================================================================================================//
+uint64_t Shape::getGeometryHash()
+{
+    BoundingBox bounds = getBounds();
+    DataHash geometry_hash;
+    geometry_hash.add(bounds.first_).add(bounds.second_);
+
+    const size_t samples_per_axis = 9;
+    Vecd sample_spacing = (bounds.second_ - bounds.first_) / Real(samples_per_axis - 1);
+    size_t total_samples = (size_t)pow(samples_per_axis, Dimensions);
+    for (size_t n = 0; n != total_samples; ++n)
+    {
+        Vecd sample_point = bounds.first_;
+        size_t remainder = n;
+        for (int axis = 0; axis != Dimensions; ++axis)
+        {
+            sample_point[axis] += Real(remainder % samples_per_axis) * sample_spacing[axis];
+            remainder /= samples_per_axis;
+        }
+        geometry_hash.add(findSignedDistance(sample_point));
+    }
+    return geometry_hash.Value();
+}
+//=================================================================================================//
+void Shape::checkContains(const StdVec<Vecd> &probe_points, StdVec<int> &is_contained)
+{
+    is_contained.resize(probe_points.size());
+    parallel_for(
+        IndexRange(0, probe_points.size()),
+        [&](const IndexRange &r)
+        {
+            for (size_t i = r.begin(); i != r.end(); ++i)
+            {
+                is_contained[i] = checkContain(probe_points[i]) ? 1 : 0;
+            }
+        });
+}
+//=================================================================================================//
+void Shape::findClosestPoints(const StdVec<Vecd> &probe_points, StdVec<Vecd> &closest_points)
+{
+    closest_points.resize(probe_points.size());
+    parallel_for(
+        IndexRange(0, probe_points.size()),
+        [&](const IndexRange &r)
+        {
+            for (size_t i = r.begin(); i != r.end(); ++i)
+            {
+                closest_points[i] = findClosestPoint(probe_points[i]);
+            }
+        });
+}
+//=================================================================================================//
+void Shape::findSignedDistances(const StdVec<Vecd> &probe_points, StdVec<Real> &signed_distances)
+{
+    StdVec<int> is_contained;
+    StdVec<Vecd> closest_points;
+    checkContains(probe_points, is_contained);
+    findClosestPoints(probe_points, closest_points);
+
+    signed_distances.resize(probe_points.size());
+    for (size_t i = 0; i != probe_points.size(); ++i)
+    {
+        Real distance_to_surface = (probe_points[i] - closest_points[i]).norm();
+        signed_distances[i] = is_contained[i] ? -distance_to_surface : distance_to_surface;
+    }
+}
+//=================================================================================================//
 bool BinaryShapes::isValid()
 {
     return sub_shapes_and_ops_.size() == 0 ? false : true;
 }
 //=================================================================================================//
+uint64_t BinaryShapes::getGeometryHash()
+{
+    DataHash geometry_hash;
+    geometry_hash.add(std::string("BinaryShapes"));
+    for (auto &sub_shape_and_op : sub_shapes_and_ops_)
+    {
+        geometry_hash.add(sub_shape_and_op.first->getGeometryHash()).add(sub_shape_and_op.second);
+    }
+    return geometry_hash.Value();
+}
+//=================================================================================================//
 BoundingBox BinaryShapes::findBounds()
 {
     // initial reference values
@@ -127,6 +206,57 @@ Vecd BinaryShapes::findClosestPoint(const Vecd &probe_point)
     return pnt_closest;
 }
 //=================================================================================================//
+void BinaryShapes::checkContains(const StdVec<Vecd> &probe_points, StdVec<int> &is_contained)
+{
+    is_contained.assign(probe_points.size(), 0);
+    StdVec<int> is_contained_by_sub_shape;
+    for (auto &sub_shape_and_op : sub_shapes_and_ops_)
+    {
+        sub_shape_and_op.first->checkContains(probe_points, is_contained_by_sub_shape);
+        switch (sub_shape_and_op.second)
+        {
+        case ShapeBooleanOps::add:
+        {
+            for (size_t i = 0; i != probe_points.size(); ++i)
+                is_contained[i] = is_contained[i] || is_contained_by_sub_shape[i];
+            break;
+        }
+        case ShapeBooleanOps::sub:
+        {
+            for (size_t i = 0; i != probe_points.size(); ++i)
+                is_contained[i] = is_contained[i] && !is_contained_by_sub_shape[i];
+            break;
+        }
+        default:
+        {
+            std::cout << "\n FAILURE: the boolean operation is not applicable!" << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            throw;
+        }
+        }
+    }
+}
+//=================================================================================================//
+void BinaryShapes::findClosestPoints(const StdVec<Vecd> &probe_points, StdVec<Vecd> &closest_points)
+{
+    closest_points.assign(probe_points.size(), Vecd::Zero());
+    StdVec<Real> distance_min(probe_points.size(), MaxReal);
+    StdVec<Vecd> closest_points_on_sub_shape;
+    for (auto &sub_shape_and_op : sub_shapes_and_ops_)
+    {
+        sub_shape_and_op.first->findClosestPoints(probe_points, closest_points_on_sub_shape);
+        for (size_t i = 0; i != probe_points.size(); ++i)
+        {
+            Real distance = (probe_points[i] - closest_points_on_sub_shape[i]).norm();
+            if (distance <= distance_min[i])
+            {
+                distance_min[i] = distance;
+                closest_points[i] = closest_points_on_sub_shape[i];
+            }
+        }
+    }
+}
+//=================================================================================================//
 SubShapeAndOp *BinaryShapes::getSubShapeAndOpByName(const std::string &name)
 {
     for (auto &sub_shape_and_op : sub_shapes_and_ops_)
@@ -81,6 +81,16 @@ class Shape
     Real findSignedDistance(const Vecd &probe_point);
     /** Normal direction point toward outside of the shape. */
     Vecd findNormalDirection(const Vecd &probe_point);
+    /** Batch queries on many probe points, answered in parallel point by point by default.
+     *  Shapes with spatial acceleration structures override them for efficiency. */
+    virtual void checkContains(const StdVec<Vecd> &probe_points, StdVec<int> &is_contained);
+    virtual void findClosestPoints(const StdVec<Vecd> &probe_points, StdVec<Vecd> &closest_points);
+    void findSignedDistances(const StdVec<Vecd> &probe_points, StdVec<Real> &signed_distances);
+    /** Hash identifying the geometry, used as the key of data cached on disk.
+     *  Shapes override it to hash their defining data, e.g. parameters or mesh vertices.
+     *  The default, the bounds and the signed distances on a coarse lattice,
+     *  may miss changes between lattice points. */
+    virtual uint64_t getGeometryHash();
 
   protected:
     std::string name_;
@@ -124,6 +134,9 @@ class BinaryShapes : public Shape
     virtual bool isValid() override;
     virtual bool checkContain(const Vecd &pnt, bool BOUNDARY_INCLUDED = true) override;
     virtual Vecd findClosestPoint(const Vecd &probe_point) override;
+    virtual void checkContains(const StdVec<Vecd> &probe_points, StdVec<int> &is_contained) override;
+    virtual void findClosestPoints(const StdVec<Vecd> &probe_points, StdVec<Vecd> &closest_points) override;
+    virtual uint64_t getGeometryHash() override;
     Shape *getSubShapeByName(const std::string &name);
     SubShapeAndOp *getSubShapeAndOpByName(const std::string &name);
     size_t getSubShapeIndexByName(const std::string &name);
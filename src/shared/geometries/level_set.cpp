@@ -2,6 +2,11 @@
 
 #include "adaptation.h"
 #include "base_kernel.h"
+#include "data_hash.h"
+
+#include <chrono>
+#include <filesystem>
+namespace fs = std::filesystem;
 
 namespace SPH
 {
@@ -39,7 +44,10 @@ LevelSet::LevelSet(BoundingBox tentative_bounds, Real data_spacing, size_t buffe
       phi_gradient_(*registerMeshVariable<Vecd>("LevelsetGradient")),
       kernel_weight_(*registerMeshVariable<Real>("KernelWeight")),
       kernel_gradient_(*registerMeshVariable<Vecd>("KernelGradient")),
-      kernel_(*sph_adaptation.getKernel()) {}
+      kernel_(*sph_adaptation.getKernel())
+{
+    setMeshDataOwner(Name());
+}
 //=================================================================================================//
 void LevelSet::updateLevelSetGradient()
 {
@@ -110,20 +118,30 @@ void LevelSet::redistanceInterface()
 //=================================================================================================//
 void LevelSet::cleanInterface(Real small_shift_factor)
 {
-    markNearInterface(small_shift_factor);
-    redistanceInterface();
-    reinitializeLevelSet();
-    updateLevelSetGradient();
-    updateKernelIntegrals();
+    updateCacheKey("CleanInterface", small_shift_factor);
+    if (!readFromCache())
+    {
+        markNearInterface(small_shift_factor);
+        redistanceInterface();
+        reinitializeLevelSet();
+        updateLevelSetGradient();
+        updateKernelIntegrals();
+        writeToCache();
+    }
 }
 //=============================================================================================//
 void LevelSet::correctTopology(Real small_shift_factor)
 {
-    markNearInterface(small_shift_factor);
-    for (size_t i = 0; i != 10; ++i)
-        diffuseLevelSetSign();
-    updateLevelSetGradient();
-    updateKernelIntegrals();
+    updateCacheKey("CorrectTopology", small_shift_factor);
+    if (!readFromCache())
+    {
+        markNearInterface(small_shift_factor);
+        for (size_t i = 0; i != 10; ++i)
+            diffuseLevelSetSign();
+        updateLevelSetGradient();
+        updateKernelIntegrals();
+        writeToCache();
+    }
 }
 //=================================================================================================//
 bool LevelSet::probeIsWithinMeshBound(const Vecd &position)
@@ -189,6 +207,78 @@ Real LevelSet::upwindDifference(Real sign, Real df_p, Real df_n)
     return df;
 }
 //=============================================================================================//
+void LevelSet::initializeCacheKey(const std::string &parent_key)
+{
+    std::string cache_folder = sph_adaptation_.LevelSetCacheFolder();
+    if (cache_folder.empty())
+        return;
+
+    DataHash cache_hash;
+    cache_hash.add(std::string("LevelSet_v1")).add(parent_key);
+    cache_hash.add(Dimensions).add(sizeof(Real)).add(shape_.getGeometryHash());
+    cache_hash.add(mesh_lower_bound_).add(grid_spacing_).add(all_cells_).add(buffer_width_);
+    cache_hash.add(data_spacing_).add(global_h_ratio_);
+    cache_hash.add(kernel_.Name()).add(kernel_.SmoothingLength());
+    cache_key_ = cache_hash.HexString();
+}
+//=============================================================================================//
+void LevelSet::updateCacheKey(const std::string &operation, Real parameter)
+{
+    if (cache_key_.empty())
+        return;
+
+    DataHash cache_hash;
+    cache_hash.add(cache_key_).add(operation).add(parameter);
+    cache_key_ = cache_hash.HexString();
+}
+//=============================================================================================//
+std::string LevelSet::CacheFilePath()
+{
+    return sph_adaptation_.LevelSetCacheFolder() + "/" + name_ + "_" + cache_key_ + ".bin";
+}
+//=============================================================================================//
+bool LevelSet::readFromCache()
+{
+    if (cache_key_.empty() || !fs::exists(CacheFilePath()))
+        return false;
+
+    std::ifstream cache_file(CacheFilePath(), std::ios::binary);
+    size_t key_size = 0;
+    cache_file.read(reinterpret_cast<char *>(&key_size), sizeof(size_t));
+    std::string key_in_file(key_size < 64 ? key_size : 0, ' ');
+    cache_file.read(&key_in_file[0], key_in_file.size());
+    if (!cache_file || key_in_file != cache_key_ || !readMeshDataFromBinary(cache_file))
+    {
+        std::cout << "\n Warning: level set cache file " << CacheFilePath()
+                  << " does not match, the level set will be rebuilt." << std::endl;
+        return false;
+    }
+    return true;
+}
+//=============================================================================================//
+void LevelSet::writeToCache()
+{
+    if (cache_key_.empty())
+        return;
+
+    std::string cache_folder = sph_adaptation_.LevelSetCacheFolder();
+    if (!fs::exists(cache_folder))
+    {
+        fs::create_directories(cache_folder);
+    }
+    // write to a temporary file first so that a partially written file is never read
+    std::string temporary_file_path =
+        CacheFilePath() + "." + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+    {
+        std::ofstream cache_file(temporary_file_path, std::ios::binary | std::ios::trunc);
+        size_t key_size = cache_key_.size();
+        cache_file.write(reinterpret_cast<const char *>(&key_size), sizeof(size_t));
+        cache_file.write(cache_key_.data(), key_size);
+        writeMeshDataToBinary(cache_file);
+    }
+    fs::rename(temporary_file_path, CacheFilePath());
+}
+//=============================================================================================//
 void RefinedLevelSet::initializeDataInACellFromCoarse(const Arrayi &cell_index)
 {
     Vecd cell_position = CellPositionFromIndex(cell_index);
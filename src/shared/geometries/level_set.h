@@ -100,6 +100,7 @@ class LevelSet : public MeshWithGridDataPackages<4>,
     bool isWithinCorePackage(Vecd position);
     Real computeKernelIntegral(const Vecd &position);
     Vecd computeKernelGradientIntegral(const Vecd &position);
+    std::string CacheKey() { return cache_key_; };
 
   protected:
     MeshVariable<Real> &phi_;
@@ -108,9 +109,13 @@ class LevelSet : public MeshWithGridDataPackages<4>,
     MeshVariable<Real> &kernel_weight_;
     MeshVariable<Vecd> &kernel_gradient_;
     Kernel &kernel_;
+    /** key identifying the level set data in the cache folder,
+     *  empty if the level set cache is not used. */
+    std::string cache_key_;
 
     void initializeDataForSingularPackage(const size_t package_index, Real far_field_level_set);
-    void initializeBasicDataForAPackage(const Arrayi &cell_index, const size_t package_index, Shape &shape);
+    /** initialize level set and interface indicator with batch queries on the shape */
+    void initializeBasicDataForPackages(Shape &shape);
     void redistanceInterfaceForAPackage(const size_t package_index);
 
     void finishDataPackages();
@@ -128,6 +133,14 @@ class LevelSet : public MeshWithGridDataPackages<4>,
 
     // upwind algorithm choosing candidate difference by the sign
     Real upwindDifference(Real sign, Real df_p, Real df_n);
+
+    /** generate the cache key from the geometry, the mesh, the kernel and a parent key */
+    void initializeCacheKey(const std::string &parent_key);
+    /** chain the cache key with an operation modifying the level set */
+    void updateCacheKey(const std::string &operation, Real parameter);
+    std::string CacheFilePath();
+    bool readFromCache();
+    void writeToCache();
 };
 
 /**
@@ -1,6 +1,7 @@
 #include "level_set_shape.h"
 
 #include "base_body.h"
+#include "data_hash.h"
 #include "io_all.h"
 #include "sph_system.h"
 
@@ -10,7 +11,8 @@ namespace SPH
 LevelSetShape::
     LevelSetShape(Shape &shape, SharedPtr<SPHAdaptation> sph_adaptation, Real refinement_ratio)
     : Shape(shape.getName()), sph_adaptation_(sph_adaptation),
-      level_set_(*level_set_keeper_.movePtr(sph_adaptation->createLevelSet(shape, refinement_ratio)))
+      level_set_(*level_set_keeper_.movePtr(sph_adaptation->createLevelSet(shape, refinement_ratio))),
+      geometry_hash_(DataHash().add(std::string("LevelSetShape")).add(shape.getGeometryHash()).add(refinement_ratio).Value())
 {
     bounding_box_ = shape.getBounds();
     is_bounds_found_ = true;
@@ -19,12 +21,25 @@ LevelSetShape::
 LevelSetShape::LevelSetShape(SPHBody &sph_body, Shape &shape, Real refinement_ratio)
     : Shape(shape.getName()),
       level_set_(*level_set_keeper_.movePtr(
-          sph_body.sph_adaptation_->createLevelSet(shape, refinement_ratio)))
+          createCachedLevelSet(sph_body, shape, refinement_ratio))),
+      geometry_hash_(DataHash().add(std::string("LevelSetShape")).add(shape.getGeometryHash()).add(refinement_ratio).Value())
 {
     bounding_box_ = shape.getBounds();
     is_bounds_found_ = true;
 }
 //=================================================================================================//
+UniquePtr<BaseLevelSet> LevelSetShape::
+    createCachedLevelSet(SPHBody &sph_body, Shape &shape, Real refinement_ratio)
+{
+    SPHSystem &sph_system = sph_body.getSPHSystem();
+    SPHAdaptation &sph_adaptation = *sph_body.sph_adaptation_;
+    if (sph_system.LevelSetCache() && sph_system.hasIOEnvironment())
+    {
+        sph_adaptation.setLevelSetCacheFolder(sph_system.getIOEnvironment().cache_folder_ + "/level_set");
+    }
+    return sph_adaptation.createLevelSet(shape, refinement_ratio);
+}
+//=================================================================================================//
 void LevelSetShape::writeLevelSet(SPHSystem &sph_system)
 {
     MeshRecordingToPlt write_level_set_to_plt(sph_system, level_set_);
@@ -34,12 +49,14 @@ void LevelSetShape::writeLevelSet(SPHSystem &sph_system)
 LevelSetShape *LevelSetShape::cleanLevelSet(Real small_shift_factor)
 {
     level_set_.cleanInterface(small_shift_factor);
+    geometry_hash_ = DataHash().add(geometry_hash_).add(std::string("CleanLevelSet")).add(small_shift_factor).Value();
     return this;
 }
 //=================================================================================================//
 LevelSetShape *LevelSetShape::correctLevelSetSign(Real small_shift_factor)
 {
     level_set_.correctTopology(small_shift_factor);
+    geometry_hash_ = DataHash().add(geometry_hash_).add(std::string("CorrectLevelSetSign")).add(small_shift_factor).Value();
     return this;
 }
 //=================================================================================================//
@@ -57,7 +57,10 @@ class LevelSetShape : public Shape
 
     virtual bool checkContain(const Vecd &probe_point, bool BOUNDARY_INCLUDED = true) override;
     virtual Vecd findClosestPoint(const Vecd &probe_point) override;
+    /** hashed from the original shape and the operations applied on the level set */
+    virtual uint64_t getGeometryHash() override { return geometry_hash_; };
 
+    Real probeSignedDistance(const Vecd &probe_point) { return level_set_.probeSignedDistance(probe_point); };
     Vecd findLevelSetGradient(const Vecd &probe_point);
     Real computeKernelIntegral(const Vecd &probe_point, Real h_ratio = 1.0);
     Vecd computeKernelGradientIntegral(const Vecd &probe_point, Real h_ratio = 1.0);
@@ -69,8 +72,11 @@ class LevelSetShape : public Shape
 
   protected:
     BaseLevelSet &level_set_; /**< narrow bounded level set mesh. */
+    uint64_t geometry_hash_;  /**< computed on construction as the original shape may be released */
 
     virtual BoundingBox findBounds() override;
+    /** level set data are loaded from or saved to the system cache folder when the cache is used. */
+    UniquePtr<BaseLevelSet> createCachedLevelSet(SPHBody &sph_body, Shape &shape, Real refinement_ratio);
 };
 } // namespace SPH
 #endif // LEVEL_SET_SHAPE_H
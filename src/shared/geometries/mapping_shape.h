@@ -31,6 +31,7 @@
 
 #include "base_data_package.h"
 #include "base_geometry.h"
+#include "data_hash.h"
 
 namespace SPH
 {
@@ -57,6 +58,11 @@ class InverseShape : public BaseShapeType
     {
         return !BaseShapeType::checkContain(probe_point);
     };
+
+    virtual uint64_t getGeometryHash() override
+    {
+        return DataHash().add(std::string("InverseShape")).add(BaseShapeType::getGeometryHash()).Value();
+    };
 };
 
 /**
@@ -102,6 +108,13 @@ class ExtrudeShape : public BaseShapeType
         closest_point += BaseShapeType::checkContain(probe_point) ? shift : -shift;
         return closest_point;
     };
+
+    virtual uint64_t getGeometryHash() override
+    {
+        DataHash geometry_hash;
+        geometry_hash.add(std::string("ExtrudeShape")).add(BaseShapeType::getGeometryHash()).add(thickness_);
+        return geometry_hash.Value();
+    };
 };
 } // namespace SPH
 
@@ -31,6 +31,7 @@
 
 #include "base_data_package.h"
 #include "base_geometry.h"
+#include "data_hash.h"
 
 namespace SPH
 {
@@ -69,6 +70,14 @@ class TransformShape : public BaseShapeType
         return transform_.shiftFrameStationToBase(closest_point_origin);
     };
 
+    virtual uint64_t getGeometryHash() override
+    {
+        DataHash geometry_hash;
+        geometry_hash.add(std::string("TransformShape")).add(BaseShapeType::getGeometryHash());
+        geometry_hash.add(transform_.getRotationMatrix()).add(transform_.getTranslation());
+        return geometry_hash.Value();
+    };
+
   protected:
     Transform transform_;
 
@@ -40,6 +40,7 @@
 #include "io_all.h"
 #include "parameterization.h"
 #include "all_regression_test_methods.h"
+#include "parametric_sweep.h"
 #include "sph_system.h"
 
 #endif // SPHINXSYS_H
@@ -6,11 +6,18 @@
 namespace SPH
 {
 //=============================================================================================//
-IOEnvironment::IOEnvironment(SPHSystem &sph_system, bool delete_output)
+IOEnvironment::IOEnvironment(SPHSystem &sph_system, bool delete_output, const std::string &variant_name)
     : sph_system_(sph_system),
       input_folder_("./input"), output_folder_("./output"),
-      restart_folder_("./restart"), reload_folder_("./reload")
+      restart_folder_("./restart"), reload_folder_("./reload"),
+      cache_folder_("./cache")
 {
+    if (!variant_name.empty())
+    {
+        output_folder_ += "/" + variant_name;
+        restart_folder_ += "/" + variant_name;
+    }
+
     if (!fs::exists(input_folder_))
     {
         fs::create_directory(input_folder_);
@@ -18,12 +25,12 @@ IOEnvironment::IOEnvironment(SPHSystem &sph_system, bool delete_output)
 
     if (!fs::exists(output_folder_))
     {
-        fs::create_directory(output_folder_);
+        fs::create_directories(output_folder_);
     }
 
     if (!fs::exists(restart_folder_))
     {
-        fs::create_directory(restart_folder_);
+        fs::create_directories(restart_folder_);
     }
 
     if (!fs::exists(reload_folder_))
@@ -34,11 +41,11 @@ IOEnvironment::IOEnvironment(SPHSystem &sph_system, bool delete_output)
     if (sph_system.RestartStep() == 0)
     {
         fs::remove_all(restart_folder_);
-        fs::create_directory(restart_folder_);
+        fs::create_directories(restart_folder_);
         if (delete_output == true)
         {
             fs::remove_all(output_folder_);
-            fs::create_directory(output_folder_);
+            fs::create_directories(output_folder_);
         }
     }
 
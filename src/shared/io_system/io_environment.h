@@ -58,8 +58,12 @@ class IOEnvironment
     std::string output_folder_;
     std::string restart_folder_;
     std::string reload_folder_;
+    std::string cache_folder_; /**< data reusable by later runs, created only when needed */
 
-    explicit IOEnvironment(SPHSystem &sph_system, bool delete_output = true);
+    /** A non-empty variant name places the output and restart folders into
+     * subfolders of that name, while input, reload and cache folders are shared by all variants. */
+    explicit IOEnvironment(SPHSystem &sph_system, bool delete_output = true,
+                           const std::string &variant_name = "");
     virtual ~IOEnvironment(){};
     ParameterizationIO &defineParameterizationIO();
 };
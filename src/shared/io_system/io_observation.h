@@ -31,13 +31,15 @@
 
 #include "io_base.h"
 
-#include "io_plt.h"
+#include "io_time_series.h"
 
 namespace SPH
 {
 /**
  * @class ObservedQuantityRecording
- * @brief write files for observed quantity
+ * @brief write files for observed quantity.
+ * The observations are written in the buffered binary time series format,
+ * which can be read by TimeSeriesReader and the python scripts.
  */
 template <typename VariableType>
 class ObservedQuantityRecording : public BodyStatesRecording,
@@ -45,11 +47,11 @@ class ObservedQuantityRecording : public BodyStatesRecording,
 {
   protected:
     SPHBody &observer_;
-    PltEngine plt_engine_;
     BaseParticles &base_particles_;
     std::string dynamics_identifier_name_;
     const std::string quantity_name_;
     std::string filefullpath_output_;
+    TimeSeriesWriter time_series_writer_;
 
   public:
     VariableType type_indicator_; /*< this is an indicator to identify the variable type. */
@@ -58,37 +60,30 @@ class ObservedQuantityRecording : public BodyStatesRecording,
     ObservedQuantityRecording(const std::string &quantity_name, BaseContactRelation &contact_relation)
         : BodyStatesRecording(contact_relation.getSPHBody()),
           ObservingAQuantity<VariableType>(contact_relation, quantity_name),
-          observer_(contact_relation.getSPHBody()), plt_engine_(),
+          observer_(contact_relation.getSPHBody()),
           base_particles_(observer_.getBaseParticles()),
           dynamics_identifier_name_(contact_relation.getSPHBody().getName()),
-          quantity_name_(quantity_name)
+          quantity_name_(quantity_name),
+          filefullpath_output_(io_environment_.output_folder_ + "/" + dynamics_identifier_name_ + "_" + quantity_name + ".bin"),
+          time_series_writer_(filefullpath_output_)
     {
-        /** Output for .dat file. */
-        filefullpath_output_ = io_environment_.output_folder_ + "/" + dynamics_identifier_name_ + "_" + quantity_name + ".dat";
-        std::ofstream out_file(filefullpath_output_.c_str(), std::ios::app);
-        out_file << "run_time"
-                 << "   ";
         for (size_t i = 0; i != base_particles_.TotalRealParticles(); ++i)
         {
             std::string quantity_name_i = quantity_name + "[" + std::to_string(i) + "]";
-            plt_engine_.writeAQuantityHeader(out_file, (*this->interpolated_quantities_)[i], quantity_name_i);
+            time_series_writer_.addColumn(quantity_name_i, (*this->interpolated_quantities_)[i]);
         }
-        out_file << "\n";
-        out_file.close();
     };
     virtual ~ObservedQuantityRecording(){};
 
     virtual void writeWithFileName(const std::string &sequence) override
     {
         this->exec();
-        std::ofstream out_file(filefullpath_output_.c_str(), std::ios::app);
-        out_file << GlobalStaticVariables::physical_time_ << "   ";
+        time_series_writer_.beginRow(GlobalStaticVariables::physical_time_);
         for (size_t i = 0; i != base_particles_.TotalRealParticles(); ++i)
         {
-            plt_engine_.writeAQuantity(out_file, (*this->interpolated_quantities_)[i]);
+            time_series_writer_.writeValue((*this->interpolated_quantities_)[i]);
         }
-        out_file << "\n";
-        out_file.close();
+        time_series_writer_.endRow();
     };
 
     StdLargeVec<VariableType> *getObservedQuantity()
@@ -99,17 +94,17 @@ class ObservedQuantityRecording : public BodyStatesRecording,
 
 /**
  * @class ReducedQuantityRecording
- * @brief write reduced quantity of a body
+ * @brief write reduced quantity of a body in the buffered binary time series format.
  */
 template <class LocalReduceMethodType>
 class ReducedQuantityRecording : public BaseIO
 {
   protected:
-    PltEngine plt_engine_;
     ReduceDynamics<LocalReduceMethodType> reduce_method_;
     std::string dynamics_identifier_name_;
     const std::string quantity_name_;
     std::string filefullpath_output_;
+    TimeSeriesWriter time_series_writer_;
 
   public:
     /*< deduce variable type from reduce method. */
@@ -119,29 +114,22 @@ class ReducedQuantityRecording : public BaseIO
   public:
     template <class DynamicsIdentifier, typename... Args>
     ReducedQuantityRecording(DynamicsIdentifier &identifier, Args &&...args)
-        : BaseIO(identifier.getSPHBody().getSPHSystem()), plt_engine_(),
+        : BaseIO(identifier.getSPHBody().getSPHSystem()),
           reduce_method_(identifier, std::forward<Args>(args)...),
           dynamics_identifier_name_(reduce_method_.DynamicsIdentifierName()),
-          quantity_name_(reduce_method_.QuantityName())
+          quantity_name_(reduce_method_.QuantityName()),
+          filefullpath_output_(io_environment_.output_folder_ + "/" + dynamics_identifier_name_ + "_" + quantity_name_ + ".bin"),
+          time_series_writer_(filefullpath_output_)
     {
-        /** output for .dat file. */
-        filefullpath_output_ = io_environment_.output_folder_ + "/" + dynamics_identifier_name_ + "_" + quantity_name_ + ".dat";
-        std::ofstream out_file(filefullpath_output_.c_str(), std::ios::app);
-        out_file << "\"run_time\""
-                 << "   ";
-        plt_engine_.writeAQuantityHeader(out_file, reduce_method_.Reference(), quantity_name_);
-        out_file << "\n";
-        out_file.close();
+        time_series_writer_.addColumn(quantity_name_, reduce_method_.Reference());
     };
     virtual ~ReducedQuantityRecording(){};
 
     virtual void writeToFile(size_t iteration_step = 0) override
     {
-        std::ofstream out_file(filefullpath_output_.c_str(), std::ios::app);
-        out_file << GlobalStaticVariables::physical_time_ << "   ";
-        plt_engine_.writeAQuantity(out_file, reduce_method_.exec());
-        out_file << "\n";
-        out_file.close();
+        time_series_writer_.beginRow(GlobalStaticVariables::physical_time_);
+        time_series_writer_.writeValue(reduce_method_.exec());
+        time_series_writer_.endRow();
     };
 };
 } // namespace SPH
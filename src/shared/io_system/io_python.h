@@ -0,0 +1,218 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file    io_python.h
+ * @brief   Reusable pybind11 binding layer for a simulation case.
+ * @details Registered particle variables are exposed as NumPy arrays viewing the particle data
+ *          without copy, the simulation can be advanced step by step from Python
+ *          and reduced quantities are evaluated without writing files.
+ *          This header depends on pybind11 and is therefore not included in sphinxsys.h.
+ *          It should be included by a case compiled as a pybind11 module only.
+ *          Note that the array views are valid until the particle data are reallocated,
+ *          e.g. by reserving buffer particles, and their length is the number of real particles
+ *          when they are requested.
+ * @author  Xiangyu Hu
+ */
+
+#ifndef IO_PYTHON_H
+#define IO_PYTHON_H
+
+#include "base_body.h"
+#include "base_particles.h"
+
+#include <pybind11/eigen.h>
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <functional>
+#include <map>
+
+namespace SPH
+{
+/** the capsule as the base of an array view, which does not own the data */
+inline pybind11::capsule NonOwningBase(const void *data)
+{
+    return pybind11::capsule(data, [](void *) {});
+}
+
+template <typename DataType>
+pybind11::array NumpyView(StdLargeVec<DataType> &data, size_t size)
+{
+    return pybind11::array_t<DataType>({pybind11::ssize_t(size)},
+                                       {pybind11::ssize_t(sizeof(DataType))},
+                                       data.data(), NonOwningBase(data.data()));
+}
+
+inline pybind11::array NumpyView(StdLargeVec<Vecd> &data, size_t size)
+{
+    return pybind11::array_t<Real>({pybind11::ssize_t(size), pybind11::ssize_t(Dimensions)},
+                                   {pybind11::ssize_t(sizeof(Vecd)), pybind11::ssize_t(sizeof(Real))},
+                                   reinterpret_cast<Real *>(data.data()), NonOwningBase(data.data()));
+}
+
+/** Matrices are stored column major, i.e. the array is indexed by [particle, row, column]. */
+inline pybind11::array NumpyView(StdLargeVec<Matd> &data, size_t size)
+{
+    return pybind11::array_t<Real>({pybind11::ssize_t(size), pybind11::ssize_t(Dimensions), pybind11::ssize_t(Dimensions)},
+                                   {pybind11::ssize_t(sizeof(Matd)), pybind11::ssize_t(sizeof(Real)),
+                                    pybind11::ssize_t(Dimensions * sizeof(Real))},
+                                   reinterpret_cast<Real *>(data.data()), NonOwningBase(data.data()));
+}
+
+/**
+ * @class PythonSimulationControl
+ * @brief Base class of a simulation case controlled from Python.
+ * A case defines one (outer) time step in advanceStep and the output after each output interval,
+ * exposes its bodies and reduced quantities, and is bound by bindSimulationControl.
+ * Errors on requests from Python are raised as Python exceptions.
+ */
+class PythonSimulationControl
+{
+  public:
+    explicit PythonSimulationControl(Real output_interval) : output_interval_(output_interval){};
+    virtual ~PythonSimulationControl(){};
+
+    /** advance one time step and return the advanced physical time */
+    virtual Real advanceStep() = 0;
+    /** output after each output interval, such as writing body states */
+    virtual void writeOutput(){};
+
+    Real advanceOutputInterval()
+    {
+        Real integration_time = 0.0;
+        while (integration_time < output_interval_)
+        {
+            integration_time += advanceStep();
+        }
+        writeOutput();
+        return integration_time;
+    };
+
+    void advanceToTime(Real end_time)
+    {
+        while (GlobalStaticVariables::physical_time_ < end_time)
+        {
+            advanceOutputInterval();
+        }
+    };
+
+    Real PhysicalTime() { return GlobalStaticVariables::physical_time_; };
+
+    void exposeBody(SPHBody &sph_body)
+    {
+        exposed_particles_[sph_body.getName()] = &sph_body.getBaseParticles();
+    };
+
+    template <class ReduceDynamicsType>
+    void exposeReducedQuantity(const std::string &name, ReduceDynamicsType &reduce_dynamics)
+    {
+        reduced_quantities_[name] = [&reduce_dynamics]()
+        { return pybind11::cast(reduce_dynamics.exec()); };
+    };
+
+    size_t NumberOfParticles(const std::string &body_name)
+    {
+        return getExposedParticles(body_name).TotalRealParticles();
+    };
+
+    pybind11::array getParticleData(const std::string &body_name, const std::string &variable_name)
+    {
+        BaseParticles &particles = getExposedParticles(body_name);
+        pybind11::array data_view;
+        if (!(findParticleData<Real>(particles, variable_name, data_view) ||
+              findParticleData<Vecd>(particles, variable_name, data_view) ||
+              findParticleData<Matd>(particles, variable_name, data_view) ||
+              findParticleData<int>(particles, variable_name, data_view)))
+        {
+            throw pybind11::key_error("The variable '" + variable_name + "' is not registered in body '" + body_name + "'!");
+        }
+        return data_view;
+    };
+
+    pybind11::object getReducedQuantity(const std::string &name)
+    {
+        auto reduced_quantity = reduced_quantities_.find(name);
+        if (reduced_quantity == reduced_quantities_.end())
+        {
+            throw pybind11::key_error("The reduced quantity '" + name + "' is not exposed!");
+        }
+        return reduced_quantity->second();
+    };
+
+    pybind11::dict getReducedQuantities()
+    {
+        pybind11::dict reduced_values;
+        for (auto &reduced_quantity : reduced_quantities_)
+        {
+            reduced_values[pybind11::str(reduced_quantity.first)] = reduced_quantity.second();
+        }
+        return reduced_values;
+    };
+
+  protected:
+    Real output_interval_;
+    std::map<std::string, BaseParticles *> exposed_particles_;
+    std::map<std::string, std::function<pybind11::object()>> reduced_quantities_;
+
+    BaseParticles &getExposedParticles(const std::string &body_name)
+    {
+        auto particles = exposed_particles_.find(body_name);
+        if (particles == exposed_particles_.end())
+        {
+            throw pybind11::key_error("The body '" + body_name + "' is not exposed!");
+        }
+        return *particles->second;
+    };
+
+    template <typename DataType>
+    bool findParticleData(BaseParticles &particles, const std::string &variable_name, pybind11::array &data_view)
+    {
+        DiscreteVariable<DataType> *variable =
+            findVariableByName<DataType>(particles.AllDiscreteVariables(), variable_name);
+        if (variable == nullptr)
+        {
+            return false;
+        }
+        variable->markAccessed();
+        data_view = NumpyView(*variable->DataField(), particles.TotalRealParticles());
+        return true;
+    };
+};
+
+/** Bind the simulation control of a case derived from PythonSimulationControl.
+ *  The array views keep the case alive as long as they are referenced in Python. */
+template <class CaseType, typename... Options>
+void bindSimulationControl(pybind11::class_<CaseType, Options...> &case_class)
+{
+    case_class.def("AdvanceStep", &CaseType::advanceStep)
+        .def("AdvanceOutputInterval", &CaseType::advanceOutputInterval)
+        .def("AdvanceToTime", &CaseType::advanceToTime)
+        .def("PhysicalTime", &CaseType::PhysicalTime)
+        .def("NumberOfParticles", &CaseType::NumberOfParticles)
+        .def("GetParticleData", &CaseType::getParticleData, pybind11::keep_alive<0, 1>())
+        .def("GetReducedQuantity", &CaseType::getReducedQuantity)
+        .def("GetReducedQuantities", &CaseType::getReducedQuantities);
+}
+} // namespace SPH
+#endif // IO_PYTHON_H
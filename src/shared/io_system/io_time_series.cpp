@@ -0,0 +1,250 @@
+/**
+ * @file 	io_time_series.cpp
+ * @author	Chi Zhang, Shuoguo Zhang, Zhenxi Zhao and Xiangyu Hu
+ */
+
+#include "io_time_series.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <mutex>
+#include <set>
+
+namespace SPH
+{
+namespace
+{
+const char time_series_magic[8] = {'S', 'P', 'H', 'T', 'S', 'v', '1', '\0'};
+
+template <typename DataType>
+void appendBytes(std::string &bytes, const DataType &data)
+{
+    bytes.append(reinterpret_cast<const char *>(&data), sizeof(DataType));
+}
+
+template <typename DataType>
+DataType readBytes(std::ifstream &in_file)
+{
+    DataType data{};
+    in_file.read(reinterpret_cast<char *>(&data), sizeof(DataType));
+    return data;
+}
+
+/** live writers, flushed when the program ends through exit(), which skips the destructors of local objects */
+std::mutex &liveWritersMutex()
+{
+    static std::mutex live_writers_mutex;
+    return live_writers_mutex;
+}
+
+std::set<TimeSeriesWriter *> &liveWriters()
+{
+    static std::set<TimeSeriesWriter *> live_writers;
+    return live_writers;
+}
+
+void flushLiveWriters()
+{
+    std::lock_guard<std::mutex> lock(liveWritersMutex());
+    for (TimeSeriesWriter *writer : liveWriters())
+        writer->flush();
+}
+} // namespace
+//=============================================================================================//
+TimeSeriesWriter::TimeSeriesWriter(const std::string &filefullpath, size_t buffer_rows)
+    : filefullpath_(filefullpath), buffer_rows_(SMAX(buffer_rows, size_t(1))),
+      row_size_(1), buffered_rows_(0), is_header_written_(false)
+{
+    // the registry is constructed before the exit handler is registered, so that it outlives the handler
+    static std::once_flag at_exit_flag;
+    std::call_once(at_exit_flag, []()
+                   { liveWritersMutex(); liveWriters(); std::atexit(flushLiveWriters); });
+    std::lock_guard<std::mutex> lock(liveWritersMutex());
+    liveWriters().insert(this);
+}
+//=============================================================================================//
+TimeSeriesWriter::~TimeSeriesWriter()
+{
+    {
+        std::lock_guard<std::mutex> lock(liveWritersMutex());
+        liveWriters().erase(this);
+    }
+    flush();
+}
+//=============================================================================================//
+void TimeSeriesWriter::addColumn(const std::string &name, int number_of_components)
+{
+    if (is_header_written_)
+    {
+        std::cout << "\n Error: the column " << name << " is added after the first row is written!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+    column_names_.push_back(name);
+    column_components_.push_back(number_of_components);
+    row_size_ += number_of_components;
+}
+//=============================================================================================//
+void TimeSeriesWriter::writeHeader()
+{
+    std::string header(time_series_magic, sizeof(time_series_magic));
+    appendBytes(header, uint32_t(sizeof(Real)));
+    appendBytes(header, uint32_t(column_names_.size()));
+    for (size_t i = 0; i != column_names_.size(); ++i)
+    {
+        appendBytes(header, uint32_t(column_names_[i].size()));
+        header.append(column_names_[i]);
+        appendBytes(header, int32_t(column_components_[i]));
+    }
+
+    // an existing file with the same header, e.g. from a restarted run, is appended
+    bool is_same_header = false;
+    if (fs::exists(filefullpath_))
+    {
+        std::ifstream in_file(filefullpath_.c_str(), std::ios::binary);
+        std::string existing_header(header.size(), '\0');
+        in_file.read(&existing_header[0], header.size());
+        is_same_header = in_file && existing_header == header;
+    }
+    if (!is_same_header)
+    {
+        std::ofstream out_file(filefullpath_.c_str(), std::ios::binary | std::ios::trunc);
+        out_file.write(header.data(), header.size());
+    }
+
+    row_buffer_.reserve(buffer_rows_ * row_size_);
+    is_header_written_ = true;
+}
+//=============================================================================================//
+void TimeSeriesWriter::beginRow(Real time)
+{
+    if (!is_header_written_)
+        writeHeader();
+    row_buffer_.push_back(time);
+}
+//=============================================================================================//
+void TimeSeriesWriter::writeValue(const Vecd &value)
+{
+    for (int i = 0; i != Dimensions; ++i)
+        row_buffer_.push_back(value[i]);
+}
+//=============================================================================================//
+void TimeSeriesWriter::endRow()
+{
+    if (row_buffer_.size() != (buffered_rows_ + 1) * row_size_)
+    {
+        std::cout << "\n Error: the row written to " << filefullpath_ << " does not match the columns!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+    buffered_rows_++;
+    if (buffered_rows_ == buffer_rows_)
+        flush();
+}
+//=============================================================================================//
+void TimeSeriesWriter::flush()
+{
+    if (buffered_rows_ == 0)
+        return;
+
+    std::ofstream out_file(filefullpath_.c_str(), std::ios::binary | std::ios::app);
+    out_file.write(reinterpret_cast<const char *>(row_buffer_.data()),
+                   sizeof(Real) * buffered_rows_ * row_size_);
+    row_buffer_.clear();
+    buffered_rows_ = 0;
+}
+//=============================================================================================//
+TimeSeriesReader::TimeSeriesReader(const std::string &filefullpath)
+{
+    std::ifstream in_file(filefullpath.c_str(), std::ios::binary);
+    char magic[sizeof(time_series_magic)];
+    in_file.read(magic, sizeof(magic));
+    if (!in_file || !std::equal(magic, magic + sizeof(magic), time_series_magic))
+    {
+        std::cout << "\n Error: " << filefullpath << " is not a time series file!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+
+    uint32_t real_size = readBytes<uint32_t>(in_file);
+    uint32_t number_of_columns = readBytes<uint32_t>(in_file);
+    size_t row_size = 1;
+    for (uint32_t i = 0; i != number_of_columns; ++i)
+    {
+        std::string name(readBytes<uint32_t>(in_file), ' ');
+        in_file.read(&name[0], name.size());
+        column_names_.push_back(name);
+        column_components_.push_back(readBytes<int32_t>(in_file));
+        column_offsets_.push_back(row_size);
+        row_size += column_components_.back();
+    }
+
+    // rows written with another precision are converted, an incomplete last row is discarded
+    StdVec<Real> row(row_size);
+    while (in_file)
+    {
+        for (size_t i = 0; i != row_size && in_file; ++i)
+            row[i] = real_size == sizeof(float) ? Real(readBytes<float>(in_file)) : Real(readBytes<double>(in_file));
+        if (!in_file)
+            break;
+        times_.push_back(row[0]);
+        rows_.push_back(row);
+    }
+}
+//=============================================================================================//
+void TimeSeriesReader::checkColumnComponents(size_t column, int number_of_components)
+{
+    if (column_components_[column] != number_of_components)
+    {
+        std::cout << "\n Error: the column " << column_names_[column] << " has "
+                  << column_components_[column] << " components!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+}
+//=============================================================================================//
+void TimeSeriesReader::getValue(size_t row, size_t column, Real &value)
+{
+    checkColumnComponents(column, 1);
+    value = rows_[row][column_offsets_[column]];
+}
+//=============================================================================================//
+void TimeSeriesReader::getValue(size_t row, size_t column, Vecd &value)
+{
+    checkColumnComponents(column, Dimensions);
+    for (int i = 0; i != Dimensions; ++i)
+        value[i] = rows_[row][column_offsets_[column] + i];
+}
+//=============================================================================================//
+void TimeSeriesReader::writeToDat(const std::string &dat_filefullpath)
+{
+    std::ofstream out_file(dat_filefullpath.c_str(), std::ios::trunc);
+    out_file << "\"run_time\""
+             << "   ";
+    for (size_t i = 0; i != column_names_.size(); ++i)
+    {
+        if (column_components_[i] == 1)
+        {
+            out_file << "\"" << column_names_[i] << "\""
+                     << "   ";
+        }
+        else
+        {
+            for (int j = 0; j != column_components_[i]; ++j)
+                out_file << "\"" << column_names_[i] << "[" << j << "]\""
+                         << "   ";
+        }
+    }
+    out_file << "\n";
+
+    for (size_t row = 0; row != rows_.size(); ++row)
+    {
+        out_file << times_[row] << "   ";
+        for (size_t i = 1; i != rows_[row].size(); ++i)
+            out_file << std::fixed << std::setprecision(9) << rows_[row][i] << "   ";
+        out_file << "\n";
+    }
+}
+//=============================================================================================//
+} // namespace SPH
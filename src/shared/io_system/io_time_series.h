@@ -0,0 +1,123 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	io_time_series.h
+ * @brief 	Buffered binary output of time series, such as observed and reduced quantities.
+ * @details The file starts with a header giving the precision, the column names and
+ *          the number of components of each column, followed by raw rows of the time
+ *          and all the column components. Rows are buffered in memory and appended
+ *          to the file when the buffer is full, so that the file is not reopened for each row.
+ * @author	Chi Zhang, Shuoguo Zhang, Zhenxi Zhao and Xiangyu Hu
+ */
+
+#ifndef IO_TIME_SERIES_H
+#define IO_TIME_SERIES_H
+
+#include "base_data_package.h"
+#include "sph_data_containers.h"
+
+#include <filesystem>
+#include <fstream>
+namespace fs = std::filesystem;
+
+namespace SPH
+{
+/**
+ * @class TimeSeriesWriter
+ * @brief Write a time series in the binary format with buffered rows.
+ * All columns are added before the first row is written.
+ * The buffered rows are also flushed when the program ends through exit(),
+ * e.g. on an error, as the destructors of local objects are not called then.
+ */
+class TimeSeriesWriter
+{
+  public:
+    explicit TimeSeriesWriter(const std::string &filefullpath, size_t buffer_rows = 256);
+    virtual ~TimeSeriesWriter();
+
+    void addColumn(const std::string &name, const Real &type_indicator) { addColumn(name, 1); };
+    void addColumn(const std::string &name, const Vecd &type_indicator) { addColumn(name, Dimensions); };
+    void beginRow(Real time);
+    void writeValue(const Real &value) { row_buffer_.push_back(value); };
+    void writeValue(const Vecd &value);
+    void endRow();
+    /** append the buffered rows to the file */
+    void flush();
+    std::string FileFullPath() { return filefullpath_; };
+
+  protected:
+    std::string filefullpath_;
+    size_t buffer_rows_;
+    StdVec<std::string> column_names_;
+    StdVec<int> column_components_;
+    size_t row_size_;           /**< number of values in a row, including the time */
+    size_t buffered_rows_;
+    StdVec<Real> row_buffer_;
+    bool is_header_written_;
+
+    void addColumn(const std::string &name, int number_of_components);
+    void writeHeader();
+};
+
+/**
+ * @class TimeSeriesReader
+ * @brief Read a time series written by TimeSeriesWriter,
+ * for post-processing, regression tests or conversion to the text format.
+ */
+class TimeSeriesReader
+{
+  public:
+    explicit TimeSeriesReader(const std::string &filefullpath);
+    virtual ~TimeSeriesReader(){};
+
+    StdVec<std::string> ColumnNames() { return column_names_; };
+    StdVec<int> ColumnComponents() { return column_components_; };
+    size_t NumberOfRows() { return times_.size(); };
+    StdVec<Real> &Times() { return times_; };
+    /** value of a column in a row, scalar or vector according to the column components */
+    void getValue(size_t row, size_t column, Real &value);
+    void getValue(size_t row, size_t column, Vecd &value);
+    /** all rows of the columns as snapshot * column, as used by the regression tests */
+    template <typename DataType>
+    BiVector<DataType> getAllValues()
+    {
+        BiVector<DataType> all_values(NumberOfRows(), StdVec<DataType>(column_names_.size()));
+        for (size_t row = 0; row != NumberOfRows(); ++row)
+            for (size_t column = 0; column != column_names_.size(); ++column)
+                getValue(row, column, all_values[row][column]);
+        return all_values;
+    };
+    /** write in the text format of the former .dat files */
+    void writeToDat(const std::string &dat_filefullpath);
+
+  protected:
+    StdVec<std::string> column_names_;
+    StdVec<int> column_components_;
+    StdVec<size_t> column_offsets_;
+    StdVec<Real> times_;
+    BiVector<Real> rows_;
+
+    void checkColumnComponents(size_t column, int number_of_components);
+};
+} // namespace SPH
+#endif // IO_TIME_SERIES_H
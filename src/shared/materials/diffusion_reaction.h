@@ -180,15 +180,22 @@ class LocalDirectionalDiffusion : public DirectionalDiffusion
 /**
  * @class BaseReactionModel
  * @brief Base class for all reaction models.
+ * @details Besides the particle-wise reaction functors, the rates can be evaluated
+ * for a batch of particles with species stored as structure of arrays.
+ * Models override getReactionRates with plain loops which can be vectorized
+ * by the compiler and avoid a virtual call for each particle.
  */
 template <int NUM_SPECIES>
 class BaseReactionModel
 {
   public:
     static constexpr int NumSpecies = NUM_SPECIES;
+    static constexpr size_t BatchSize = 64;
     typedef std::array<Real, NUM_SPECIES> LocalSpecies;
     typedef std::array<std::string, NUM_SPECIES> SpeciesNames;
     typedef std::function<Real(LocalSpecies &)> ReactionFunctor;
+    typedef std::array<Real, BatchSize> BatchedValues;
+    typedef std::array<BatchedValues, NUM_SPECIES> BatchedSpecies;
     StdVec<ReactionFunctor> get_production_rates_;
     StdVec<ReactionFunctor> get_loss_rates_;
 
@@ -218,6 +225,22 @@ class BaseReactionModel
     virtual ~BaseReactionModel(){};
     SpeciesNames &getSpeciesNames() { return species_names_; };
 
+    /** Production and loss rates of the k-th species for the first batch_size particles of a batch. */
+    virtual void getReactionRates(size_t k, BatchedSpecies &species, size_t batch_size,
+                                  BatchedValues &production_rates, BatchedValues &loss_rates)
+    {
+        LocalSpecies local_species;
+        for (size_t l = 0; l != batch_size; ++l)
+        {
+            for (size_t m = 0; m != NumSpecies; ++m)
+            {
+                local_species[m] = species[m][l];
+            }
+            production_rates[l] = get_production_rates_[k](local_species);
+            loss_rates[l] = get_loss_rates_[k](local_species);
+        }
+    };
+
   protected:
     std::string reaction_model_;
     SpeciesNames species_names_;
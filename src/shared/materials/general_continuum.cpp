@@ -37,12 +37,18 @@ Real PlasticContinuum::getDPConstantsK(Real cohesion, Real friction_angle)
     return 3.0 * cohesion / sqrt(9.0 + 12.0 * tan(friction_angle) * tan(friction_angle));
 }
 //=================================================================================================//
-Mat3d PlasticContinuum::ConstitutiveRelation(Mat3d &velocity_gradient, Mat3d &stress_tensor)
+Mat3d PlasticContinuum::ElasticConstitutiveRelation(Mat3d &velocity_gradient, Mat3d &stress_tensor)
 {
     Mat3d strain_rate = 0.5 * (velocity_gradient + velocity_gradient.transpose());
     Mat3d spin_rate = 0.5 * (velocity_gradient - velocity_gradient.transpose());
     Mat3d deviatoric_strain_rate = strain_rate - (1.0 / stress_dimension_) * strain_rate.trace() * Mat3d::Identity();
-    Mat3d stress_rate_elastic = 2.0 * G_ * deviatoric_strain_rate + K_ * strain_rate.trace() * Mat3d::Identity() + stress_tensor * (spin_rate.transpose()) + spin_rate * stress_tensor;
+    return 2.0 * G_ * deviatoric_strain_rate + K_ * strain_rate.trace() * Mat3d::Identity() + stress_tensor * (spin_rate.transpose()) + spin_rate * stress_tensor;
+}
+//=================================================================================================//
+Mat3d PlasticContinuum::ConstitutiveRelation(Mat3d &velocity_gradient, Mat3d &stress_tensor)
+{
+    Mat3d strain_rate = 0.5 * (velocity_gradient + velocity_gradient.transpose());
+    Mat3d stress_rate_elastic = ElasticConstitutiveRelation(velocity_gradient, stress_tensor);
     Real stress_tensor_I1 = stress_tensor.trace();
     Mat3d deviatoric_stress_tensor = stress_tensor - (1.0 / stress_dimension_) * stress_tensor.trace() * Mat3d::Identity();
     Real stress_tensor_J2 = 0.5 * (deviatoric_stress_tensor.cwiseProduct(deviatoric_stress_tensor.transpose())).sum();
@@ -62,10 +68,18 @@ Mat3d PlasticContinuum::ConstitutiveRelation(Mat3d &velocity_gradient, Mat3d &st
 //=================================================================================================//
 Mat3d PlasticContinuum::ReturnMapping(Mat3d &stress_tensor)
 {
+    int is_plastic_active = 1;
+    return ReturnMapping(stress_tensor, is_plastic_active);
+}
+//=================================================================================================//
+Mat3d PlasticContinuum::ReturnMapping(Mat3d &stress_tensor, int &is_plastic_active)
+{
+    is_plastic_active = 0;
     Real stress_tensor_I1 = stress_tensor.trace();
     if (-alpha_phi_ * stress_tensor_I1 + k_c_ < 0)
     {
         stress_tensor -= (1.0 / stress_dimension_) * (stress_tensor_I1 - k_c_ / alpha_phi_) * Mat3d::Identity();
+        is_plastic_active = 1;
     }
     stress_tensor_I1 = stress_tensor.trace();
     Mat3d deviatoric_stress_tensor = stress_tensor - (1.0 / stress_dimension_) * stress_tensor.trace() * Mat3d::Identity();
@@ -74,6 +88,13 @@ Mat3d PlasticContinuum::ReturnMapping(Mat3d &stress_tensor)
     {
         Real r = (-alpha_phi_ * stress_tensor_I1 + k_c_) / (sqrt(stress_tensor_J2) + TinyReal);
         stress_tensor = r * deviatoric_stress_tensor + (1.0 / stress_dimension_) * stress_tensor_I1 * Mat3d::Identity();
+        is_plastic_active = 1;
+    }
+    else if (is_plastic_active == 0)
+    {
+        /** the same yield function as evaluated in the constitutive relation for the unchanged stress */
+        Real f = sqrt(stress_tensor_J2) + alpha_phi_ * stress_tensor_I1 - k_c_;
+        is_plastic_active = f >= TinyReal ? 1 : 0;
     }
     return stress_tensor;
 }
@@ -94,7 +94,14 @@ class PlasticContinuum : public GeneralContinuum
     Real getFrictionAngle() { return phi_; };
 
     virtual Mat3d ConstitutiveRelation(Mat3d &velocity_gradient, Mat3d &stress_tensor);
-    virtual Mat3d ReturnMapping(Mat3d &stress_tensor);
+    /** elastic predictor of the stress rate, which is the constitutive relation
+     * for stress strictly within the yield surface */
+    virtual Mat3d ElasticConstitutiveRelation(Mat3d &velocity_gradient, Mat3d &stress_tensor);
+    /** forwards to the two-argument return mapping, which is the one to override in derived materials */
+    Mat3d ReturnMapping(Mat3d &stress_tensor);
+    /** return mapping also giving whether plastic flow should be evaluated by the next constitutive relation,
+     * obtained from the yield check without extra cost */
+    virtual Mat3d ReturnMapping(Mat3d &stress_tensor, int &is_plastic_active);
 
     virtual GeneralContinuum *ThisObjectPtr() override { return this; };
 };
@@ -43,6 +43,12 @@ class Kernel;
 class SPHAdaptation;
 class CellLinkedList;
 
+/** a small functor taking all particles as candidates for neighbor search */
+struct AllSearchCandidates
+{
+    bool operator()(size_t index_i, const Vecd &position) const { return true; };
+};
+
 /**
  * @class BaseCellLinkedList
  * @brief The Abstract class for mesh cell linked list derived from BaseMeshField.
@@ -128,7 +134,21 @@ class CellLinkedList : public BaseCellLinkedList, public Mesh
     /** generalized particle search algorithm */
     template <class DynamicsRange, typename GetSearchDepth, typename GetNeighborRelation>
     void searchNeighborsByParticles(DynamicsRange &dynamics_range, ParticleConfiguration &particle_configuration,
-                                    GetSearchDepth &get_search_depth, GetNeighborRelation &get_neighbor_relation);
+                                    GetSearchDepth &get_search_depth, GetNeighborRelation &get_neighbor_relation)
+    {
+        AllSearchCandidates all_search_candidates;
+        searchNeighborsByParticles(dynamics_range, particle_configuration,
+                                   get_search_depth, get_neighbor_relation, all_search_candidates);
+    };
+    /** particle search only for the particles accepted by the candidate check */
+    template <class DynamicsRange, typename GetSearchDepth, typename GetNeighborRelation, typename CheckSearchCandidate>
+    void searchNeighborsByParticles(DynamicsRange &dynamics_range, ParticleConfiguration &particle_configuration,
+                                    GetSearchDepth &get_search_depth, GetNeighborRelation &get_neighbor_relation,
+                                    CheckSearchCandidate &check_search_candidate);
+    /** search the list data in the cells around a position, which is not necessarily a particle */
+    template <typename FunctionOnListData>
+    void searchNeighborsByPosition(const Vecd &position, int search_depth,
+                                   const FunctionOnListData &function_on_list_data);
 };
 
 /**
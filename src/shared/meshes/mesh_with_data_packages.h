@@ -120,7 +120,8 @@ class MeshWithGridDataPackages : public Mesh
     explicit MeshWithGridDataPackages(BoundingBox tentative_bounds, Real data_spacing, size_t buffer_size)
         : Mesh(tentative_bounds, pkg_size * data_spacing, buffer_size),
           data_spacing_(data_spacing),
-          global_mesh_(mesh_lower_bound_ + 0.5 * data_spacing * Vecd::Ones(), data_spacing, all_cells_ * pkg_size)
+          global_mesh_(mesh_lower_bound_ + 0.5 * data_spacing * Vecd::Ones(), data_spacing, all_cells_ * pkg_size),
+          cell_neighborhood_(nullptr), meta_data_cell_(nullptr)
     {
         allocateMetaDataMatrix();
     };
@@ -132,6 +133,114 @@ class MeshWithGridDataPackages : public Mesh
     };
     /** spacing between the data, which is 1/ pkg_size of this grid spacing */
     virtual Real DataSpacing() override { return data_spacing_; };
+    /** name of the owner under which the mesh data are accounted in the memory footprint */
+    void setMeshDataOwner(const std::string &owner_name) { mesh_data_owner_ = owner_name; };
+
+    /** write the metadata and the data of all mesh variables to a binary file */
+    void writeMeshDataToBinary(std::ofstream &output_file)
+    {
+        size_t total_cells = all_cells_.prod();
+        output_file.write(reinterpret_cast<const char *>(all_cells_.data()), sizeof(int) * Dimensions);
+        output_file.write(reinterpret_cast<const char *>(&data_spacing_), sizeof(Real));
+        output_file.write(reinterpret_cast<const char *>(&num_grid_pkgs_), sizeof(size_t));
+
+        StdVec<std::string> variable_names;
+        size_t package_data_bytes = 0;
+        collect_mesh_variable_names_(all_mesh_variables_, variable_names, package_data_bytes);
+        size_t number_of_variables = variable_names.size();
+        output_file.write(reinterpret_cast<const char *>(&number_of_variables), sizeof(size_t));
+        for (const std::string &name : variable_names)
+        {
+            size_t name_size = name.size();
+            output_file.write(reinterpret_cast<const char *>(&name_size), sizeof(size_t));
+            output_file.write(name.data(), name_size);
+        }
+
+        StdVec<int> categories(total_cells);
+        StdVec<size_t> package_indices(total_cells);
+        for (size_t l = 0; l != total_cells; ++l)
+        {
+            Arrayi cell_index = transfer1DtoMeshIndex(all_cells_, l);
+            categories[l] = isCoreDataPackage(cell_index) ? 2 : (isInnerDataPackage(cell_index) ? 1 : 0);
+            package_indices[l] = PackageIndexFromCellIndex(cell_index);
+        }
+        output_file.write(reinterpret_cast<const char *>(categories.data()), sizeof(int) * total_cells);
+        output_file.write(reinterpret_cast<const char *>(package_indices.data()), sizeof(size_t) * total_cells);
+        output_file.write(reinterpret_cast<const char *>(cell_neighborhood_), sizeof(CellNeighborhood) * num_grid_pkgs_);
+        output_file.write(reinterpret_cast<const char *>(meta_data_cell_), sizeof(std::pair<Arrayi, int>) * num_grid_pkgs_);
+
+        write_mesh_variable_data_(all_mesh_variables_, num_grid_pkgs_, output_file);
+    };
+
+    /** read the metadata and the data of all mesh variables from a binary file.
+     *  Return false, without changing the mesh, if the file does not match this mesh. */
+    bool readMeshDataFromBinary(std::ifstream &input_file)
+    {
+        Arrayi all_cells = Arrayi::Zero();
+        Real data_spacing = 0.0;
+        size_t num_grid_pkgs = 0;
+        input_file.read(reinterpret_cast<char *>(all_cells.data()), sizeof(int) * Dimensions);
+        input_file.read(reinterpret_cast<char *>(&data_spacing), sizeof(Real));
+        input_file.read(reinterpret_cast<char *>(&num_grid_pkgs), sizeof(size_t));
+        if (!input_file || (all_cells != all_cells_).any() || data_spacing != data_spacing_)
+            return false;
+        if (cell_neighborhood_ != nullptr && num_grid_pkgs != num_grid_pkgs_)
+            return false;
+
+        StdVec<std::string> variable_names;
+        size_t package_data_bytes = 0;
+        collect_mesh_variable_names_(all_mesh_variables_, variable_names, package_data_bytes);
+        size_t number_of_variables = 0;
+        input_file.read(reinterpret_cast<char *>(&number_of_variables), sizeof(size_t));
+        if (!input_file || number_of_variables != variable_names.size())
+            return false;
+        for (const std::string &name : variable_names)
+        {
+            size_t name_size = 0;
+            input_file.read(reinterpret_cast<char *>(&name_size), sizeof(size_t));
+            std::string name_in_file(name_size, ' ');
+            input_file.read(&name_in_file[0], name_size);
+            if (!input_file || name_in_file != name)
+                return false;
+        }
+
+        size_t total_cells = all_cells_.prod();
+        StdVec<int> categories(total_cells);
+        StdVec<size_t> package_indices(total_cells);
+        input_file.read(reinterpret_cast<char *>(categories.data()), sizeof(int) * total_cells);
+        input_file.read(reinterpret_cast<char *>(package_indices.data()), sizeof(size_t) * total_cells);
+        if (!input_file)
+            return false;
+
+        // check the size of the remaining data so that the mesh is not changed by a truncated file
+        std::streampos data_begin = input_file.tellg();
+        input_file.seekg(0, std::ios::end);
+        size_t remaining_bytes = static_cast<size_t>(input_file.tellg() - data_begin);
+        input_file.seekg(data_begin);
+        size_t package_bytes = sizeof(CellNeighborhood) + sizeof(std::pair<Arrayi, int>) + package_data_bytes;
+        if (remaining_bytes < package_bytes * num_grid_pkgs)
+            return false;
+
+        if (cell_neighborhood_ == nullptr)
+        {
+            num_grid_pkgs_ = num_grid_pkgs;
+            cell_neighborhood_ = new CellNeighborhood[num_grid_pkgs_];
+            meta_data_cell_ = new std::pair<Arrayi, int>[num_grid_pkgs_];
+            resizeMeshVariableData();
+        }
+
+        for (size_t l = 0; l != total_cells; ++l)
+        {
+            Arrayi cell_index = transfer1DtoMeshIndex(all_cells_, l);
+            assignCategoryOnMetaDataMesh(cell_index, categories[l]);
+            assignDataPackageIndex(cell_index, package_indices[l]);
+        }
+        input_file.read(reinterpret_cast<char *>(cell_neighborhood_), sizeof(CellNeighborhood) * num_grid_pkgs_);
+        input_file.read(reinterpret_cast<char *>(meta_data_cell_), sizeof(std::pair<Arrayi, int>) * num_grid_pkgs_);
+
+        read_mesh_variable_data_(all_mesh_variables_, num_grid_pkgs_, input_file);
+        return static_cast<bool>(input_file);
+    };
 
   protected:
     MeshVariableAssemble all_mesh_variables_;         /**< all mesh variables on this mesh. */
@@ -143,6 +252,7 @@ class MeshWithGridDataPackages : public Mesh
     MeshDataMatrix<MetaData> meta_data_mesh_;         /**< metadata for all cells. */
     CellNeighborhood *cell_neighborhood_;                  /**< 3*3(*3) array to store indicies of neighborhood cells. */
     std::pair<Arrayi, int> *meta_data_cell_;          /**< metadata for each occupied cell: (arrayi)cell index, (int)core1/inner0. */
+    std::string mesh_data_owner_;                     /**< owner of the mesh data in the memory footprint. */
     using NeighbourIndex = std::pair<size_t, Arrayi>; /**< stores shifted neighbour info: (size_t)package index, (arrayi)local grid index. */
     template <typename DataType>
     using PackageData = PackageDataMatrix<DataType, pkg_size>;
@@ -181,13 +291,13 @@ class MeshWithGridDataPackages : public Mesh
     struct ResizeMeshVariableData
     {
         void operator()(MeshVariableAssemble &all_mesh_variables_,
-                        const size_t num_grid_pkgs_)
+                        const size_t num_grid_pkgs_, const std::string &owner_name)
         {
             constexpr int type_index = DataTypeIndex<DataType>::value;
             for (size_t l = 0; l != std::get<type_index>(all_mesh_variables_).size(); ++l)
             {
                 MeshVariable<DataType> *variable = std::get<type_index>(all_mesh_variables_)[l];
-                variable->allocateAllMeshVariableData(num_grid_pkgs_);
+                variable->allocateAllMeshVariableData(num_grid_pkgs_, owner_name);
             }
         }
     };
@@ -195,9 +305,61 @@ class MeshWithGridDataPackages : public Mesh
 
     void resizeMeshVariableData()
     {
-        resize_mesh_variable_data_(all_mesh_variables_, num_grid_pkgs_);
+        resize_mesh_variable_data_(all_mesh_variables_, num_grid_pkgs_, mesh_data_owner_);
     }
 
+    /** collect the names of all mesh variables in the order of the variable assemble
+     *  and the size of their data in a package */
+    template <typename DataType>
+    struct CollectMeshVariableNames
+    {
+        void operator()(MeshVariableAssemble &all_mesh_variables_, StdVec<std::string> &variable_names,
+                        size_t &package_data_bytes)
+        {
+            constexpr int type_index = DataTypeIndex<DataType>::value;
+            for (MeshVariable<DataType> *variable : std::get<type_index>(all_mesh_variables_))
+            {
+                variable_names.push_back(variable->Name());
+                package_data_bytes += sizeof(typename MeshVariable<DataType>::PackageData);
+            }
+        }
+    };
+    DataAssembleOperation<CollectMeshVariableNames> collect_mesh_variable_names_;
+
+    /** write the raw package data of all mesh variables */
+    template <typename DataType>
+    struct WriteMeshVariableData
+    {
+        void operator()(MeshVariableAssemble &all_mesh_variables_, const size_t num_grid_pkgs_,
+                        std::ofstream &output_file)
+        {
+            constexpr int type_index = DataTypeIndex<DataType>::value;
+            for (MeshVariable<DataType> *variable : std::get<type_index>(all_mesh_variables_))
+            {
+                output_file.write(reinterpret_cast<const char *>(variable->DataField()),
+                                  sizeof(typename MeshVariable<DataType>::PackageData) * num_grid_pkgs_);
+            }
+        }
+    };
+    DataAssembleOperation<WriteMeshVariableData> write_mesh_variable_data_;
+
+    /** read the raw package data of all mesh variables */
+    template <typename DataType>
+    struct ReadMeshVariableData
+    {
+        void operator()(MeshVariableAssemble &all_mesh_variables_, const size_t num_grid_pkgs_,
+                        std::ifstream &input_file)
+        {
+            constexpr int type_index = DataTypeIndex<DataType>::value;
+            for (MeshVariable<DataType> *variable : std::get<type_index>(all_mesh_variables_))
+            {
+                input_file.read(reinterpret_cast<char *>(variable->DataField()),
+                                sizeof(typename MeshVariable<DataType>::PackageData) * num_grid_pkgs_);
+            }
+        }
+    };
+    DataAssembleOperation<ReadMeshVariableData> read_mesh_variable_data_;
+
     /** void (non_value_returning) function iterate on all data points by value. */
     template <typename FunctionOnData>
     void for_each_cell_data(const FunctionOnData &function);
@@ -167,6 +167,9 @@ class PlasticIntegration2ndHalf<Inner<>, RiemannSolverType>
     RiemannSolverType riemann_solver_;
     StdLargeVec<Real> &acc_deviatoric_plastic_strain_, &vertical_stress_;
     StdLargeVec<Real> &Vol_, &mass_;
+    /** particles whose stress is on the yield surface, for which the plastic flow is evaluated,
+     * while the others take the elastic predictor */
+    StdLargeVec<int> &is_plastic_active_;
     Real E_, nu_;
 
     Real getDeviatoricPlasticStrain(Mat3d &strain_tensor);
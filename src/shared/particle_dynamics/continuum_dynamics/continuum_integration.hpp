@@ -146,8 +146,10 @@ PlasticIntegration2ndHalf<Inner<>, RiemannSolverType>::PlasticIntegration2ndHalf
       vertical_stress_(*particles_->registerSharedVariable<Real>("VerticalStress")),
       Vol_(*particles_->getVariableDataByName<Real>("VolumetricMeasure")),
       mass_(*particles_->getVariableDataByName<Real>("Mass")),
+      is_plastic_active_(*particles_->registerSharedVariable<int>("IsPlasticActive", 1)),
       E_(plastic_continuum_.getYoungsModulus()), nu_(plastic_continuum_.getPoissonRatio())
 {
+    particles_->addVariableToSort<int>("IsPlasticActive");
     particles_->addVariableToSort<Real>("AccDeviatoricPlasticStrain");
     particles_->addVariableToSort<Real>("VerticalStress");
 }
@@ -194,11 +196,13 @@ void PlasticIntegration2ndHalf<Inner<>, RiemannSolverType>::update(size_t index_
     rho_[index_i] += drho_dt_[index_i] * dt * 0.5;
     Vol_[index_i] = mass_[index_i] / rho_[index_i];
     Mat3d velocity_gradient = upgradeToMat3d(velocity_gradient_[index_i]);
-    Mat3d stress_tensor_rate_3D_ = plastic_continuum_.ConstitutiveRelation(velocity_gradient, stress_tensor_3D_[index_i]);
+    Mat3d stress_tensor_rate_3D_ = is_plastic_active_[index_i]
+                                       ? plastic_continuum_.ConstitutiveRelation(velocity_gradient, stress_tensor_3D_[index_i])
+                                       : plastic_continuum_.ElasticConstitutiveRelation(velocity_gradient, stress_tensor_3D_[index_i]);
     stress_rate_3D_[index_i] += stress_tensor_rate_3D_;
     stress_tensor_3D_[index_i] += stress_rate_3D_[index_i] * dt;
     /*return mapping*/
-    Mat3d stress_tensor_ = plastic_continuum_.ReturnMapping(stress_tensor_3D_[index_i]);
+    Mat3d stress_tensor_ = plastic_continuum_.ReturnMapping(stress_tensor_3D_[index_i], is_plastic_active_[index_i]);
     stress_tensor_3D_[index_i] = stress_tensor_;
     vertical_stress_[index_i] = stress_tensor_3D_[index_i](1, 1);
     strain_rate_3D_[index_i] = 0.5 * (velocity_gradient + velocity_gradient.transpose());
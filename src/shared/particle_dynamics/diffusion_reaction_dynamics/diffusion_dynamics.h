@@ -220,12 +220,12 @@ template <class ContactKernelGradientType, class DiffusionType>
 class DiffusionRelaxation<Robin<ContactKernelGradientType>, DiffusionType>
     : public DiffusionRelaxation<Contact<ContactKernelGradientType>, DiffusionType>
 {
+  protected:
     StdLargeVec<Vecd> &n_;
     StdVec<StdVec<StdLargeVec<Real> *>> contact_convection_;
     StdVec<StdVec<Real *>> contact_species_infinity_;
     StdVec<StdLargeVec<Vecd> *> contact_n_;
 
-  protected:
     void getTransferRateRobin(
         size_t particle_i, size_t particle_j, Real surface_area_ij_Robin,
         StdVec<StdLargeVec<Real> *> &transfer_k,
@@ -0,0 +1,185 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file    implicit_diffusion_dynamics.h
+ * @brief   Implicit time integration of diffusion with a preconditioned BiCGSTAB
+ *          solver so that the time step is limited by accuracy, not by stability.
+ * @author  Chi Zhang and Xiangyu Hu
+ */
+
+#ifndef IMPLICIT_DIFFUSION_DYNAMICS_H
+#define IMPLICIT_DIFFUSION_DYNAMICS_H
+
+#include "diffusion_dynamics.h"
+
+namespace SPH
+{
+/**
+ * @class BaseDiffusionDiagonal
+ * @brief Base class for the diagonal of the diffusion operator,
+ * i.e. the derivative of the change rate of a particle with respect to its own species.
+ * @details The diagonal is used by the Jacobi preconditioner of the implicit solver.
+ * It is computed with the same kernel gradients and boundary conditions as the
+ * explicit diffusion relaxation.
+ */
+template <class DiffusionRelaxationType>
+class BaseDiffusionDiagonal : public DiffusionRelaxationType
+{
+  protected:
+    StdVec<StdLargeVec<Real> *> diffusion_diagonal_;
+
+  public:
+    template <typename... Args>
+    explicit BaseDiffusionDiagonal(Args &&...args);
+    virtual ~BaseDiffusionDiagonal(){};
+    void initialization(size_t index_i, Real dt = 0.0);
+};
+
+template <typename... InteractionTypes>
+class DiffusionDiagonal;
+
+template <class KernelGradientType, class DiffusionType>
+class DiffusionDiagonal<Inner<KernelGradientType>, DiffusionType>
+    : public BaseDiffusionDiagonal<DiffusionRelaxation<Inner<KernelGradientType>, DiffusionType>>
+{
+  public:
+    template <typename... Args>
+    explicit DiffusionDiagonal(Args &&...args);
+    virtual ~DiffusionDiagonal(){};
+    void interaction(size_t index_i, Real dt = 0.0);
+};
+
+template <class ContactKernelGradientType, class DiffusionType>
+class DiffusionDiagonal<Dirichlet<ContactKernelGradientType>, DiffusionType>
+    : public BaseDiffusionDiagonal<DiffusionRelaxation<Dirichlet<ContactKernelGradientType>, DiffusionType>>
+{
+  public:
+    template <typename... Args>
+    explicit DiffusionDiagonal(Args &&...args);
+    virtual ~DiffusionDiagonal(){};
+    void interaction(size_t index_i, Real dt = 0.0);
+};
+
+/** The Neumann boundary condition gives a constant flux and does not contribute to the diagonal. */
+template <class ContactKernelGradientType, class DiffusionType>
+class DiffusionDiagonal<Neumann<ContactKernelGradientType>, DiffusionType>
+    : public BaseDiffusionDiagonal<DiffusionRelaxation<Contact<ContactKernelGradientType>, DiffusionType>>
+{
+  public:
+    template <typename... Args>
+    explicit DiffusionDiagonal(Args &&...args);
+    virtual ~DiffusionDiagonal(){};
+    void interaction(size_t index_i, Real dt = 0.0){};
+};
+
+template <class ContactKernelGradientType, class DiffusionType>
+class DiffusionDiagonal<Robin<ContactKernelGradientType>, DiffusionType>
+    : public BaseDiffusionDiagonal<DiffusionRelaxation<Robin<ContactKernelGradientType>, DiffusionType>>
+{
+  public:
+    template <typename... Args>
+    explicit DiffusionDiagonal(Args &&...args);
+    virtual ~DiffusionDiagonal(){};
+    void interaction(size_t index_i, Real dt = 0.0);
+};
+
+/**
+ * @class DiffusionRelaxationImplicit
+ * @brief Implicit theta scheme for diffusion, theta = 1 for backward Euler (default)
+ * and theta = 0.5 for Crank-Nicolson.
+ * @details With the change rate written as L(phi) = M phi + b, the linear system
+ * (I - theta dt M) phi^{n+1} = phi^n + (1 - theta) dt L(phi^n) + theta dt b
+ * is solved by Jacobi preconditioned BiCGSTAB iterations.
+ * The operator is applied matrix-free by the inner and contact interactions of
+ * the explicit DiffusionRelaxationType, so that all kernel gradient corrections
+ * and boundary conditions are shared with the explicit schemes.
+ * As the operator is not symmetric with corrected kernel gradients or local anisotropic
+ * diffusion, conjugate gradient iterations are not used. All species are solved together
+ * so that one operator evaluation serves all species in each half iteration.
+ * A warning is given if the tolerance is not reached within the maximum iterations.
+ * The diffusion species should be identical to the gradient species.
+ */
+template <class DiffusionRelaxationType, class DiffusionDiagonalType>
+class DiffusionRelaxationImplicit : public DiffusionRelaxationType, public BaseDynamics<void>
+{
+  protected:
+    DiffusionDiagonalType diffusion_diagonal_operator_;
+    StdVec<StdLargeVec<Real> *> diffusion_diagonal_;
+    Real implicit_weight_;
+    Real tolerance_;
+    size_t max_iterations_;
+    size_t iterations_;
+    StdVec<StdLargeVec<Real>> residual_;
+    StdVec<StdLargeVec<Real>> shadow_residual_;
+    StdVec<StdLargeVec<Real>> search_direction_;
+    StdVec<StdLargeVec<Real>> preconditioned_;
+    StdVec<StdLargeVec<Real>> operated_direction_;
+    StdVec<StdLargeVec<Real>> operated_residual_;
+    StdVec<StdLargeVec<Real>> source_rate_;
+
+    void resizeWorkingData();
+    /** Change rate of the species, or of the given states if they are swapped in. */
+    void computeChangeRate();
+    void computeChangeRate(StdVec<StdLargeVec<Real>> &states);
+    void computeDiagonal();
+    void applyPreconditioner(size_t m, Real theta_dt, const StdLargeVec<Real> &input, StdLargeVec<Real> &output);
+    /** The system operator (I - theta dt M) applied to the given states. */
+    void applySystemOperator(Real theta_dt, StdVec<StdLargeVec<Real>> &input, StdVec<StdLargeVec<Real>> &output);
+    Real weightedDotProduct(const StdLargeVec<Real> &a, const StdLargeVec<Real> &b);
+
+  public:
+    template <typename FirstArg, typename... OtherArgs>
+    explicit DiffusionRelaxationImplicit(FirstArg &first_arg, OtherArgs &&...other_args);
+    virtual ~DiffusionRelaxationImplicit(){};
+
+    void setImplicitWeight(Real implicit_weight) { implicit_weight_ = implicit_weight; };
+    void setSolverTolerance(Real tolerance, size_t max_iterations);
+    size_t NumberOfIterations() { return iterations_; };
+    virtual void exec(Real dt = 0.0) override;
+};
+
+template <class DiffusionType, class KernelGradientType, class ContactKernelGradientType,
+          template <typename... Parameters> typename... ContactInteractionTypes>
+class DiffusionBodyRelaxationImplicit
+    : public DiffusionRelaxationImplicit<
+          ComplexInteraction<DiffusionRelaxation<
+                                 Inner<KernelGradientType>, ContactInteractionTypes<ContactKernelGradientType>...>,
+                             DiffusionType>,
+          ComplexInteraction<DiffusionDiagonal<
+                                 Inner<KernelGradientType>, ContactInteractionTypes<ContactKernelGradientType>...>,
+                             DiffusionType>>
+{
+  public:
+    template <typename FirstArg, typename... OtherArgs>
+    explicit DiffusionBodyRelaxationImplicit(FirstArg &&first_arg, OtherArgs &&...other_args)
+        : DiffusionRelaxationImplicit<
+              ComplexInteraction<DiffusionRelaxation<
+                                     Inner<KernelGradientType>, ContactInteractionTypes<ContactKernelGradientType>...>,
+                                 DiffusionType>,
+              ComplexInteraction<DiffusionDiagonal<
+                                     Inner<KernelGradientType>, ContactInteractionTypes<ContactKernelGradientType>...>,
+                                 DiffusionType>>(first_arg, std::forward<OtherArgs>(other_args)...){};
+    virtual ~DiffusionBodyRelaxationImplicit(){};
+};
+} // namespace SPH
+#endif // IMPLICIT_DIFFUSION_DYNAMICS_H
@@ -0,0 +1,411 @@
+/**
+ * @file 	implicit_diffusion_dynamics.hpp
+ * @brief 	Implicit time integration of diffusion with preconditioned BiCGSTAB.
+ * @author	Chi Zhang and Xiangyu Hu
+ */
+
+#ifndef IMPLICIT_DIFFUSION_DYNAMICS_HPP
+#define IMPLICIT_DIFFUSION_DYNAMICS_HPP
+
+#include "diffusion_dynamics.hpp"
+#include "implicit_diffusion_dynamics.h"
+
+namespace SPH
+{
+//=================================================================================================//
+template <class DiffusionRelaxationType>
+template <typename... Args>
+BaseDiffusionDiagonal<DiffusionRelaxationType>::BaseDiffusionDiagonal(Args &&...args)
+    : DiffusionRelaxationType(std::forward<Args>(args)...)
+{
+    for (auto &diffusion : this->diffusions_)
+    {
+        std::string diffusion_species_name = diffusion->DiffusionSpeciesName();
+        diffusion_diagonal_.push_back(
+            this->particles_->template registerSharedVariable<Real>(diffusion_species_name + "ImplicitDiagonal"));
+    }
+}
+//=================================================================================================//
+template <class DiffusionRelaxationType>
+void BaseDiffusionDiagonal<DiffusionRelaxationType>::initialization(size_t index_i, Real dt)
+{
+    for (size_t m = 0; m < this->diffusions_.size(); ++m)
+    {
+        (*diffusion_diagonal_[m])[index_i] = 0.0;
+    }
+}
+//=================================================================================================//
+template <class KernelGradientType, class DiffusionType>
+template <typename... Args>
+DiffusionDiagonal<Inner<KernelGradientType>, DiffusionType>::DiffusionDiagonal(Args &&...args)
+    : BaseDiffusionDiagonal<DiffusionRelaxation<Inner<KernelGradientType>, DiffusionType>>(
+          std::forward<Args>(args)...) {}
+//=================================================================================================//
+template <class KernelGradientType, class DiffusionType>
+void DiffusionDiagonal<Inner<KernelGradientType>, DiffusionType>::interaction(size_t index_i, Real dt)
+{
+    Neighborhood &inner_neighborhood = this->inner_configuration_[index_i];
+    for (size_t m = 0; m < this->diffusions_.size(); ++m)
+    {
+        auto diffusion_m = this->diffusions_[m];
+        Real diagonal = 0.0;
+        for (size_t n = 0; n != inner_neighborhood.current_size_; ++n)
+        {
+            size_t index_j = inner_neighborhood.j_[n];
+            Real dW_ijV_j = inner_neighborhood.dW_ij_[n] * this->Vol_[index_j];
+            Real r_ij_ = inner_neighborhood.r_ij_[n];
+            Vecd &e_ij = inner_neighborhood.e_ij_[n];
+
+            Real diff_coeff_ij = diffusion_m->getInterParticleDiffusionCoeff(index_i, index_j, e_ij);
+            const Vecd &grad_ijV_j = this->kernel_gradient_(index_i, index_j, dW_ijV_j, e_ij);
+            Real surface_area_ij = 2.0 * grad_ijV_j.dot(e_ij) / r_ij_;
+            diagonal += diff_coeff_ij * surface_area_ij;
+        }
+        (*this->diffusion_diagonal_[m])[index_i] += diagonal;
+    }
+}
+//=================================================================================================//
+template <class ContactKernelGradientType, class DiffusionType>
+template <typename... Args>
+DiffusionDiagonal<Dirichlet<ContactKernelGradientType>, DiffusionType>::DiffusionDiagonal(Args &&...args)
+    : BaseDiffusionDiagonal<DiffusionRelaxation<Dirichlet<ContactKernelGradientType>, DiffusionType>>(
+          std::forward<Args>(args)...) {}
+//=================================================================================================//
+template <class ContactKernelGradientType, class DiffusionType>
+void DiffusionDiagonal<Dirichlet<ContactKernelGradientType>, DiffusionType>::interaction(size_t index_i, Real dt)
+{
+    for (size_t k = 0; k < this->contact_configuration_.size(); ++k)
+    {
+        StdLargeVec<Real> &wall_Vol_k = *(this->contact_Vol_[k]);
+        Neighborhood &contact_neighborhood = (*this->contact_configuration_[k])[index_i];
+        for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
+        {
+            size_t index_j = contact_neighborhood.j_[n];
+            Real r_ij_ = contact_neighborhood.r_ij_[n];
+            Real dW_ijV_j = contact_neighborhood.dW_ij_[n] * wall_Vol_k[index_j];
+            Vecd &e_ij = contact_neighborhood.e_ij_[n];
+
+            const Vecd &grad_ijV_j = this->contact_kernel_gradients_[k](index_i, index_j, dW_ijV_j, e_ij);
+            Real area_ij = 2.0 * grad_ijV_j.dot(e_ij) / r_ij_;
+            for (size_t m = 0; m < this->diffusions_.size(); ++m)
+            {
+                Real diff_coeff_ij = this->diffusions_[m]->getInterParticleDiffusionCoeff(index_i, index_i, e_ij);
+                (*this->diffusion_diagonal_[m])[index_i] += 2.0 * diff_coeff_ij * area_ij;
+            }
+        }
+    }
+}
+//=================================================================================================//
+template <class ContactKernelGradientType, class DiffusionType>
+template <typename... Args>
+DiffusionDiagonal<Neumann<ContactKernelGradientType>, DiffusionType>::DiffusionDiagonal(Args &&...args)
+    : BaseDiffusionDiagonal<DiffusionRelaxation<Contact<ContactKernelGradientType>, DiffusionType>>(
+          std::forward<Args>(args)...) {}
+//=================================================================================================//
+template <class ContactKernelGradientType, class DiffusionType>
+template <typename... Args>
+DiffusionDiagonal<Robin<ContactKernelGradientType>, DiffusionType>::DiffusionDiagonal(Args &&...args)
+    : BaseDiffusionDiagonal<DiffusionRelaxation<Robin<ContactKernelGradientType>, DiffusionType>>(
+          std::forward<Args>(args)...) {}
+//=================================================================================================//
+template <class ContactKernelGradientType, class DiffusionType>
+void DiffusionDiagonal<Robin<ContactKernelGradientType>, DiffusionType>::interaction(size_t index_i, Real dt)
+{
+    for (size_t k = 0; k < this->contact_configuration_.size(); ++k)
+    {
+        StdLargeVec<Vecd> &n_k = *(this->contact_n_[k]);
+        StdLargeVec<Real> &Vol_k = *(this->contact_Vol_[k]);
+        StdVec<StdLargeVec<Real> *> &convection_k = this->contact_convection_[k];
+        Neighborhood &contact_neighborhood = (*this->contact_configuration_[k])[index_i];
+        for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
+        {
+            size_t index_j = contact_neighborhood.j_[n];
+            Real dW_ijV_j = contact_neighborhood.dW_ij_[n] * Vol_k[index_j];
+            Vecd &e_ij = contact_neighborhood.e_ij_[n];
+
+            const Vecd &grad_ijV_j = this->contact_kernel_gradients_[k](index_i, index_j, dW_ijV_j, e_ij);
+            Vecd n_ij = this->n_[index_i] - n_k[index_j];
+            Real area_ij_Robin = grad_ijV_j.dot(n_ij);
+            for (size_t m = 0; m < this->diffusions_.size(); ++m)
+            {
+                (*this->diffusion_diagonal_[m])[index_i] -= (*convection_k[m])[index_j] * area_ij_Robin;
+            }
+        }
+    }
+}
+//=================================================================================================//
+template <class DiffusionRelaxationType, class DiffusionDiagonalType>
+template <typename FirstArg, typename... OtherArgs>
+DiffusionRelaxationImplicit<DiffusionRelaxationType, DiffusionDiagonalType>::
+    DiffusionRelaxationImplicit(FirstArg &first_arg, OtherArgs &&...other_args)
+    : DiffusionRelaxationType(first_arg, other_args...),
+      BaseDynamics<void>(first_arg.getSPHBody()),
+      diffusion_diagonal_operator_(first_arg, other_args...),
+      implicit_weight_(1.0), tolerance_(1.0e-6), max_iterations_(200), iterations_(0)
+{
+    for (auto &diffusion : this->diffusions_)
+    {
+        std::string diffusion_species_name = diffusion->DiffusionSpeciesName();
+        if (diffusion_species_name != diffusion->GradientSpeciesName())
+        {
+            std::cout << "\n Error: implicit diffusion requires identical diffusion and gradient species for "
+                      << diffusion_species_name << "!" << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+        diffusion_diagonal_.push_back(
+            this->particles_->template registerSharedVariable<Real>(diffusion_species_name + "ImplicitDiagonal"));
+    }
+
+    size_t number_of_species = this->diffusions_.size();
+    residual_.resize(number_of_species);
+    shadow_residual_.resize(number_of_species);
+    search_direction_.resize(number_of_species);
+    preconditioned_.resize(number_of_species);
+    operated_direction_.resize(number_of_species);
+    operated_residual_.resize(number_of_species);
+    source_rate_.resize(number_of_species);
+}
+//=================================================================================================//
+template <class DiffusionRelaxationType, class DiffusionDiagonalType>
+void DiffusionRelaxationImplicit<DiffusionRelaxationType, DiffusionDiagonalType>::
+    setSolverTolerance(Real tolerance, size_t max_iterations)
+{
+    tolerance_ = tolerance;
+    max_iterations_ = max_iterations;
+}
+//=================================================================================================//
+template <class DiffusionRelaxationType, class DiffusionDiagonalType>
+void DiffusionRelaxationImplicit<DiffusionRelaxationType, DiffusionDiagonalType>::resizeWorkingData()
+{
+    for (size_t m = 0; m < this->diffusions_.size(); ++m)
+    {
+        size_t data_size = this->diffusion_species_[m]->size();
+        residual_[m].resize(data_size, 0.0);
+        shadow_residual_[m].resize(data_size, 0.0);
+        search_direction_[m].resize(data_size, 0.0);
+        preconditioned_[m].resize(data_size, 0.0);
+        operated_direction_[m].resize(data_size, 0.0);
+        operated_residual_[m].resize(data_size, 0.0);
+        source_rate_[m].resize(data_size, 0.0);
+    }
+}
+//=================================================================================================//
+template <class DiffusionRelaxationType, class DiffusionDiagonalType>
+void DiffusionRelaxationImplicit<DiffusionRelaxationType, DiffusionDiagonalType>::computeChangeRate()
+{
+    particle_for(ParallelPolicy(), this->getDynamicsIdentifier().LoopRange(),
+                 [&](size_t i)
+                 {
+                     this->initialization(i);
+                     this->interaction(i);
+                 });
+}
+//=================================================================================================//
+template <class DiffusionRelaxationType, class DiffusionDiagonalType>
+void DiffusionRelaxationImplicit<DiffusionRelaxationType, DiffusionDiagonalType>::
+    computeChangeRate(StdVec<StdLargeVec<Real>> &states)
+{
+    for (size_t m = 0; m < this->diffusions_.size(); ++m)
+    {
+        std::swap(*this->diffusion_species_[m], states[m]);
+    }
+    computeChangeRate();
+    for (size_t m = 0; m < this->diffusions_.size(); ++m)
+    {
+        std::swap(*this->diffusion_species_[m], states[m]);
+    }
+}
+//=================================================================================================//
+template <class DiffusionRelaxationType, class DiffusionDiagonalType>
+void DiffusionRelaxationImplicit<DiffusionRelaxationType, DiffusionDiagonalType>::computeDiagonal()
+{
+    particle_for(ParallelPolicy(), this->getDynamicsIdentifier().LoopRange(),
+                 [&](size_t i)
+                 {
+                     diffusion_diagonal_operator_.initialization(i);
+                     diffusion_diagonal_operator_.interaction(i);
+                 });
+}
+//=================================================================================================//
+template <class DiffusionRelaxationType, class DiffusionDiagonalType>
+Real DiffusionRelaxationImplicit<DiffusionRelaxationType, DiffusionDiagonalType>::
+    weightedDotProduct(const StdLargeVec<Real> &a, const StdLargeVec<Real> &b)
+{
+    return particle_reduce(ParallelPolicy(), this->getDynamicsIdentifier().LoopRange(),
+                           Real(0), ReduceSum<Real>(),
+                           [&](size_t i) -> Real
+                           { return this->Vol_[i] * a[i] * b[i]; });
+}
+//=================================================================================================//
+template <class DiffusionRelaxationType, class DiffusionDiagonalType>
+void DiffusionRelaxationImplicit<DiffusionRelaxationType, DiffusionDiagonalType>::
+    applyPreconditioner(size_t m, Real theta_dt, const StdLargeVec<Real> &input, StdLargeVec<Real> &output)
+{
+    StdLargeVec<Real> &diagonal = *diffusion_diagonal_[m];
+    particle_for(ParallelPolicy(), this->getDynamicsIdentifier().LoopRange(),
+                 [&](size_t i)
+                 {
+                     Real system_diagonal = 1.0 - theta_dt * diagonal[i];
+                     output[i] = system_diagonal > TinyReal ? input[i] / system_diagonal : input[i];
+                 });
+}
+//=================================================================================================//
+template <class DiffusionRelaxationType, class DiffusionDiagonalType>
+void DiffusionRelaxationImplicit<DiffusionRelaxationType, DiffusionDiagonalType>::
+    applySystemOperator(Real theta_dt, StdVec<StdLargeVec<Real>> &input, StdVec<StdLargeVec<Real>> &output)
+{
+    computeChangeRate(input);
+    for (size_t m = 0; m < this->diffusions_.size(); ++m)
+    {
+        StdLargeVec<Real> &diffusion_dt = *this->diffusion_dt_[m];
+        StdLargeVec<Real> &source_rate = source_rate_[m];
+        StdLargeVec<Real> &input_m = input[m];
+        StdLargeVec<Real> &output_m = output[m];
+        particle_for(ParallelPolicy(), this->getDynamicsIdentifier().LoopRange(),
+                     [&](size_t i)
+                     {
+                         output_m[i] = input_m[i] - theta_dt * (diffusion_dt[i] - source_rate[i]);
+                     });
+    }
+}
+//=================================================================================================//
+template <class DiffusionRelaxationType, class DiffusionDiagonalType>
+void DiffusionRelaxationImplicit<DiffusionRelaxationType, DiffusionDiagonalType>::exec(Real dt)
+{
+    setUpdated();
+    resizeWorkingData();
+    computeDiagonal();
+
+    size_t number_of_species = this->diffusions_.size();
+    Real theta_dt = implicit_weight_ * dt;
+    IndexRange loop_range = this->getDynamicsIdentifier().LoopRange();
+    // the change rate of zero species is the constant part b of the operator
+    for (size_t m = 0; m < number_of_species; ++m)
+    {
+        std::fill(search_direction_[m].begin(), search_direction_[m].end(), 0.0);
+    }
+    computeChangeRate(search_direction_);
+    for (size_t m = 0; m < number_of_species; ++m)
+    {
+        source_rate_[m] = *this->diffusion_dt_[m];
+    }
+    // with the current species as initial guess, the initial residual is dt L(phi^n)
+    computeChangeRate();
+
+    StdVec<Real> rho(number_of_species, 1.0);
+    StdVec<Real> alpha(number_of_species, 1.0);
+    StdVec<Real> omega(number_of_species, 1.0);
+    StdVec<Real> initial_residual_norm(number_of_species, 0.0);
+    StdVec<Real> converged_residual_norm(number_of_species, 0.0);
+    StdVec<bool> is_finished(number_of_species, false);
+    for (size_t m = 0; m < number_of_species; ++m)
+    {
+        StdLargeVec<Real> &diffusion_dt = *this->diffusion_dt_[m];
+        particle_for(ParallelPolicy(), loop_range,
+                     [&](size_t i)
+                     {
+                         residual_[m][i] = dt * diffusion_dt[i];
+                         shadow_residual_[m][i] = residual_[m][i];
+                         search_direction_[m][i] = 0.0;
+                         operated_direction_[m][i] = 0.0;
+                     });
+        initial_residual_norm[m] = weightedDotProduct(residual_[m], residual_[m]);
+        converged_residual_norm[m] = tolerance_ * tolerance_ * initial_residual_norm[m];
+        is_finished[m] = initial_residual_norm[m] < TinyReal;
+    }
+
+    // The operator is not symmetric with corrected kernel gradients or local anisotropic diffusion,
+    // therefore, the stabilized bi-conjugate gradient method is used.
+    iterations_ = 0;
+    while (iterations_ < max_iterations_ &&
+           std::find(is_finished.begin(), is_finished.end(), false) != is_finished.end())
+    {
+        ++iterations_;
+        for (size_t m = 0; m < number_of_species; ++m)
+        {
+            if (is_finished[m])
+                continue;
+
+            StdLargeVec<Real> &residual = residual_[m];
+            StdLargeVec<Real> &search_direction = search_direction_[m];
+            StdLargeVec<Real> &operated_direction = operated_direction_[m];
+            Real rho_new = weightedDotProduct(shadow_residual_[m], residual);
+            Real beta = (rho_new / rho[m]) * (alpha[m] / omega[m]);
+            rho[m] = rho_new;
+            particle_for(ParallelPolicy(), loop_range,
+                         [&](size_t i)
+                         {
+                             search_direction[i] =
+                                 residual[i] + beta * (search_direction[i] - omega[m] * operated_direction[i]);
+                         });
+            applyPreconditioner(m, theta_dt, search_direction, preconditioned_[m]);
+        }
+        applySystemOperator(theta_dt, preconditioned_, operated_direction_);
+
+        for (size_t m = 0; m < number_of_species; ++m)
+        {
+            if (is_finished[m])
+                continue;
+
+            StdLargeVec<Real> &diffusion_species = *this->diffusion_species_[m];
+            StdLargeVec<Real> &residual = residual_[m];
+            StdLargeVec<Real> &preconditioned = preconditioned_[m];
+            StdLargeVec<Real> &operated_direction = operated_direction_[m];
+            Real shadow_dot_operated = weightedDotProduct(shadow_residual_[m], operated_direction);
+            if (std::abs(shadow_dot_operated) < TinyReal * initial_residual_norm[m])
+            {
+                is_finished[m] = true; // breakdown of the iterations
+                continue;
+            }
+            alpha[m] = rho[m] / shadow_dot_operated;
+            particle_for(ParallelPolicy(), loop_range,
+                         [&](size_t i)
+                         {
+                             diffusion_species[i] += alpha[m] * preconditioned[i];
+                             residual[i] -= alpha[m] * operated_direction[i];
+                         });
+            is_finished[m] = weightedDotProduct(residual, residual) <= converged_residual_norm[m];
+            applyPreconditioner(m, theta_dt, residual, preconditioned);
+        }
+        applySystemOperator(theta_dt, preconditioned_, operated_residual_);
+
+        for (size_t m = 0; m < number_of_species; ++m)
+        {
+            if (is_finished[m])
+                continue;
+
+            StdLargeVec<Real> &diffusion_species = *this->diffusion_species_[m];
+            StdLargeVec<Real> &residual = residual_[m];
+            StdLargeVec<Real> &preconditioned = preconditioned_[m];
+            StdLargeVec<Real> &operated_residual = operated_residual_[m];
+            Real operated_norm = weightedDotProduct(operated_residual, operated_residual);
+            omega[m] = operated_norm > TinyReal * initial_residual_norm[m]
+                           ? weightedDotProduct(operated_residual, residual) / operated_norm
+                           : 0.0;
+            particle_for(ParallelPolicy(), loop_range,
+                         [&](size_t i)
+                         {
+                             diffusion_species[i] += omega[m] * preconditioned[i];
+                             residual[i] -= omega[m] * operated_residual[i];
+                         });
+            is_finished[m] = weightedDotProduct(residual, residual) <= converged_residual_norm[m];
+            is_finished[m] = is_finished[m] || omega[m] == 0.0; // stagnation of the iterations
+        }
+    }
+
+    for (size_t m = 0; m < number_of_species; ++m)
+    {
+        if (initial_residual_norm[m] >= TinyReal &&
+            weightedDotProduct(residual_[m], residual_[m]) > converged_residual_norm[m])
+        {
+            std::cout << "\n Warning: implicit diffusion of " << this->diffusions_[m]->DiffusionSpeciesName()
+                      << " is not converged after " << iterations_ << " iterations, relative residual "
+                      << std::sqrt(weightedDotProduct(residual_[m], residual_[m]) / initial_residual_norm[m])
+                      << "!" << std::endl;
+        }
+    }
+}
+//=================================================================================================//
+} // namespace SPH
+#endif // IMPLICIT_DIFFUSION_DYNAMICS_HPP
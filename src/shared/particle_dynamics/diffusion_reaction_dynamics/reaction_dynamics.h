@@ -49,7 +49,6 @@ class BaseReactionRelaxation
     void advanceForwardStep(size_t index_i, Real dt);
     void advanceBackwardStep(size_t index_i, Real dt);
 
-  private:
     static constexpr int NumReactiveSpecies = ReactionModelType::NumSpecies;
     typedef std::array<std::string, NumReactiveSpecies> ReactiveSpeciesNames;
     typedef std::array<Real, NumReactiveSpecies> LocalSpecies;
@@ -95,5 +94,68 @@ class ReactionRelaxationBackward
     virtual ~ReactionRelaxationBackward(){};
     void update(size_t index_i, Real dt = 0.0) { this->advanceBackwardStep(index_i, dt); };
 };
+
+/**
+ * @class BatchedReactionRelaxation
+ * @brief Compute the reaction process of all species for batches of particles.
+ * @details The species of a batch are loaded as structure of arrays and the reaction
+ * rates are evaluated by the batched interface of the reaction model.
+ * Each species is advanced by the same exponential (Rush-Larsen type) update as
+ * the particle-wise relaxation, which gives identical results without sub-cycling.
+ * With adaptive sub-cycling, a particle takes more sub-steps when the change of
+ * a species estimated from the current rates exceeds the given maximum,
+ * so that only particles with fast reactions, e.g. in the upstroke, are refined.
+ */
+template <class ReactionModelType>
+class BatchedReactionRelaxation
+    : public BaseReactionRelaxation<ReactionModelType>,
+      public BaseDynamics<void>
+{
+  protected:
+    static constexpr size_t BatchSize = ReactionModelType::BatchSize;
+    typedef typename ReactionModelType::BatchedValues BatchedValues;
+    typedef typename ReactionModelType::BatchedSpecies BatchedSpecies;
+    StdVec<size_t> sweeping_sequence_;
+    size_t max_sub_steps_;
+    Real max_species_change_;
+
+    void advanceBatch(size_t first_index, size_t batch_size, Real dt);
+    void getSubStepNumbers(BatchedSpecies &species, size_t batch_size,
+                           Real dt, std::array<size_t, BatchSize> &sub_steps);
+
+  public:
+    BatchedReactionRelaxation(bool is_forward_sweeping, SPHBody &sph_body, ReactionModelType &reaction_model);
+    virtual ~BatchedReactionRelaxation(){};
+
+    /** Enable adaptive sub-cycling with at most max_sub_steps sub-steps for a particle. */
+    void setAdaptiveSubCycling(size_t max_sub_steps, Real max_species_change);
+    virtual void exec(Real dt = 0.0) override;
+};
+
+/**
+ * @class BatchedReactionRelaxationForward
+ * @brief Compute the reaction process of all species by forward splitting for batches of particles.
+ */
+template <class ReactionModelType>
+class BatchedReactionRelaxationForward : public BatchedReactionRelaxation<ReactionModelType>
+{
+  public:
+    BatchedReactionRelaxationForward(SPHBody &sph_body, ReactionModelType &reaction_model)
+        : BatchedReactionRelaxation<ReactionModelType>(true, sph_body, reaction_model){};
+    virtual ~BatchedReactionRelaxationForward(){};
+};
+
+/**
+ * @class BatchedReactionRelaxationBackward
+ * @brief Compute the reaction process of all species by backward splitting for batches of particles.
+ */
+template <class ReactionModelType>
+class BatchedReactionRelaxationBackward : public BatchedReactionRelaxation<ReactionModelType>
+{
+  public:
+    BatchedReactionRelaxationBackward(SPHBody &sph_body, ReactionModelType &reaction_model)
+        : BatchedReactionRelaxation<ReactionModelType>(false, sph_body, reaction_model){};
+    virtual ~BatchedReactionRelaxationBackward(){};
+};
 } // namespace SPH
 #endif // REACTION_DYNAMICS_H
\ No newline at end of file
@@ -84,5 +84,123 @@ void BaseReactionRelaxation<ReactionModelType>::
     applyGlobalSpecies(local_species, index_i);
 }
 //=================================================================================================//
+template <class ReactionModelType>
+BatchedReactionRelaxation<ReactionModelType>::
+    BatchedReactionRelaxation(bool is_forward_sweeping, SPHBody &sph_body, ReactionModelType &reaction_model)
+    : BaseReactionRelaxation<ReactionModelType>(sph_body, reaction_model),
+      BaseDynamics<void>(sph_body), max_sub_steps_(1), max_species_change_(MaxReal)
+{
+    for (size_t k = 0; k != this->NumReactiveSpecies; ++k)
+    {
+        sweeping_sequence_.push_back(is_forward_sweeping ? k : this->NumReactiveSpecies - 1 - k);
+    }
+}
+//=================================================================================================//
+template <class ReactionModelType>
+void BatchedReactionRelaxation<ReactionModelType>::
+    setAdaptiveSubCycling(size_t max_sub_steps, Real max_species_change)
+{
+    max_sub_steps_ = SMAX(max_sub_steps, size_t(1));
+    max_species_change_ = max_species_change;
+}
+//=================================================================================================//
+template <class ReactionModelType>
+void BatchedReactionRelaxation<ReactionModelType>::
+    getSubStepNumbers(BatchedSpecies &species, size_t batch_size,
+                      Real dt, std::array<size_t, BatchSize> &sub_steps)
+{
+    sub_steps.fill(1);
+    if (max_sub_steps_ == 1)
+        return;
+
+    BatchedValues production_rates, loss_rates;
+    BatchedValues max_change;
+    max_change.fill(0.0);
+    for (size_t k = 0; k != this->NumReactiveSpecies; ++k)
+    {
+        this->reaction_model_.getReactionRates(k, species, batch_size, production_rates, loss_rates);
+        for (size_t l = 0; l != batch_size; ++l)
+        {
+            Real change = ABS(production_rates[l] - loss_rates[l] * species[k][l]) * dt;
+            max_change[l] = SMAX(max_change[l], change);
+        }
+    }
+
+    for (size_t l = 0; l != batch_size; ++l)
+    {
+        Real required_sub_steps = SMIN(Real(max_sub_steps_), std::ceil(max_change[l] / max_species_change_));
+        sub_steps[l] = required_sub_steps > 1.0 ? size_t(required_sub_steps) : 1;
+    }
+}
+//=================================================================================================//
+template <class ReactionModelType>
+void BatchedReactionRelaxation<ReactionModelType>::
+    advanceBatch(size_t first_index, size_t batch_size, Real dt)
+{
+    BatchedSpecies species;
+    for (size_t k = 0; k != this->NumReactiveSpecies; ++k)
+    {
+        StdLargeVec<Real> &reactive_species = *this->reactive_species_[k];
+        for (size_t l = 0; l != batch_size; ++l)
+        {
+            species[k][l] = reactive_species[first_index + l];
+        }
+    }
+
+    std::array<size_t, BatchSize> sub_steps;
+    getSubStepNumbers(species, batch_size, dt, sub_steps);
+    size_t max_sub_steps = *std::max_element(sub_steps.begin(), sub_steps.begin() + batch_size);
+
+    BatchedValues sub_dt, production_rates, loss_rates;
+    for (size_t s = 0; s != max_sub_steps; ++s)
+    {
+        for (size_t l = 0; l != batch_size; ++l)
+        {
+            sub_dt[l] = s < sub_steps[l] ? dt / Real(sub_steps[l]) : 0.0;
+        }
+
+        for (size_t k : sweeping_sequence_)
+        {
+            this->reaction_model_.getReactionRates(k, species, batch_size, production_rates, loss_rates);
+            for (size_t l = 0; l != batch_size; ++l)
+            {
+                species[k][l] = sub_dt[l] > 0.0
+                                    ? this->updateAReactionSpecies(species[k][l], production_rates[l], loss_rates[l], sub_dt[l])
+                                    : species[k][l];
+            }
+        }
+    }
+
+    for (size_t k = 0; k != this->NumReactiveSpecies; ++k)
+    {
+        StdLargeVec<Real> &reactive_species = *this->reactive_species_[k];
+        for (size_t l = 0; l != batch_size; ++l)
+        {
+            reactive_species[first_index + l] = species[k][l];
+        }
+    }
+}
+//=================================================================================================//
+template <class ReactionModelType>
+void BatchedReactionRelaxation<ReactionModelType>::exec(Real dt)
+{
+    setUpdated();
+    this->setupDynamics(dt);
+
+    size_t total_real_particles = this->particles_->TotalRealParticles();
+    size_t number_of_batches = (total_real_particles + BatchSize - 1) / BatchSize;
+    parallel_for(
+        IndexRange(0, number_of_batches),
+        [&](const IndexRange &r)
+        {
+            for (size_t i = r.begin(); i != r.end(); ++i)
+            {
+                size_t first_index = i * BatchSize;
+                advanceBatch(first_index, SMIN(BatchSize, total_real_particles - first_index), dt);
+            }
+        },
+        ap);
+}
+//=================================================================================================//
 } // namespace SPH
 #endif // REACTION_DYNAMICS_HPP
\ No newline at end of file
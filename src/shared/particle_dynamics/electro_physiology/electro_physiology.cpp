@@ -16,43 +16,76 @@ void ElectroPhysiologyReaction::initializeElectroPhysiologyReaction()
 //=================================================================================================//
 Real ElectroPhysiologyReaction::getProductionActiveContractionStress(LocalSpecies &species)
 {
-    Real voltage_dim = species[voltage_] * 100.0 - 80.0;
-    Real factor = 0.1 + (1.0 - 0.1) * exp(-exp(-voltage_dim));
-    return factor * k_a_ * (voltage_dim + 80.0);
+    return productionActiveContractionStress(species[voltage_]);
 }
 //=================================================================================================//
 Real ElectroPhysiologyReaction::getLossRateActiveContractionStress(LocalSpecies &species)
 {
-    Real voltage_dim = species[voltage_] * 100.0 - 80.0;
-    return 0.1 + (1.0 - 0.1) * exp(-exp(-voltage_dim));
+    return lossRateActiveContractionStress(species[voltage_]);
+}
+//=================================================================================================//
+void ElectroPhysiologyReaction::getReactionRates(size_t k, BatchedSpecies &species, size_t batch_size,
+                                                 BatchedValues &production_rates, BatchedValues &loss_rates)
+{
+    if (k != active_contraction_stress_)
+    {
+        BaseReactionModel<3>::getReactionRates(k, species, batch_size, production_rates, loss_rates);
+        return;
+    }
+
+    BatchedValues &voltage = species[voltage_];
+    for (size_t l = 0; l != batch_size; ++l)
+    {
+        production_rates[l] = productionActiveContractionStress(voltage[l]);
+        loss_rates[l] = lossRateActiveContractionStress(voltage[l]);
+    }
 }
 //=================================================================================================//
 Real AlievPanfilowModel::getProductionRateIonicCurrent(LocalSpecies &species)
 {
-    Real voltage = species[voltage_];
-    return -k_ * voltage * (voltage * voltage - a_ * voltage - voltage) / c_m_;
+    return productionRateIonicCurrent(species[voltage_]);
 }
 //=================================================================================================//
 Real AlievPanfilowModel::getLossRateIonicCurrent(LocalSpecies &species)
 {
-    Real gate_variable = species[gate_variable_];
-    return (k_ * a_ + gate_variable) / c_m_;
+    return lossRateIonicCurrent(species[gate_variable_]);
 }
 //=================================================================================================//
 Real AlievPanfilowModel::getProductionRateGateVariable(LocalSpecies &species)
 {
-    Real voltage = species[voltage_];
-    Real gate_variable = species[gate_variable_];
-    Real temp = epsilon_ + mu_1_ * gate_variable / (mu_2_ + voltage + Eps);
-    return -temp * k_ * voltage * (voltage - b_ - 1.0);
+    return productionRateGateVariable(species[voltage_], species[gate_variable_]);
+}
+//=================================================================================================//
+Real AlievPanfilowModel::getLossRateGateVariable(LocalSpecies &species)
+{
+    return lossRateGateVariable(species[voltage_], species[gate_variable_]);
 }
 //=================================================================================================//
-Real AlievPanfilowModel::
-    getLossRateGateVariable(LocalSpecies &species)
+void AlievPanfilowModel::getReactionRates(size_t k, BatchedSpecies &species, size_t batch_size,
+                                          BatchedValues &production_rates, BatchedValues &loss_rates)
 {
-    Real voltage = species[voltage_];
-    Real gate_variable = species[gate_variable_];
-    return epsilon_ + mu_1_ * gate_variable / (mu_2_ + voltage + Eps);
+    BatchedValues &voltage = species[voltage_];
+    BatchedValues &gate_variable = species[gate_variable_];
+    if (k == voltage_)
+    {
+        for (size_t l = 0; l != batch_size; ++l)
+        {
+            production_rates[l] = productionRateIonicCurrent(voltage[l]);
+            loss_rates[l] = lossRateIonicCurrent(gate_variable[l]);
+        }
+    }
+    else if (k == gate_variable_)
+    {
+        for (size_t l = 0; l != batch_size; ++l)
+        {
+            production_rates[l] = productionRateGateVariable(voltage[l], gate_variable[l]);
+            loss_rates[l] = lossRateGateVariable(voltage[l], gate_variable[l]);
+        }
+    }
+    else
+    {
+        ElectroPhysiologyReaction::getReactionRates(k, species, batch_size, production_rates, loss_rates);
+    }
 }
 //=================================================================================================//
 } // namespace SPH
@@ -49,6 +49,17 @@ class ElectroPhysiologyReaction : public BaseReactionModel<3>
     virtual Real getProductionActiveContractionStress(LocalSpecies &species);
     virtual Real getLossRateActiveContractionStress(LocalSpecies &species);
 
+    inline Real lossRateActiveContractionStress(Real voltage)
+    {
+        Real voltage_dim = voltage * 100.0 - 80.0;
+        return 0.1 + (1.0 - 0.1) * exp(-exp(-voltage_dim));
+    };
+    inline Real productionActiveContractionStress(Real voltage)
+    {
+        Real voltage_dim = voltage * 100.0 - 80.0;
+        return lossRateActiveContractionStress(voltage) * k_a_ * (voltage_dim + 80.0);
+    };
+
   public:
     explicit ElectroPhysiologyReaction(Real k_a)
         : BaseReactionModel<3>({"Voltage", "GateVariable", "ActiveContractionStress"}),
@@ -62,6 +73,8 @@ class ElectroPhysiologyReaction : public BaseReactionModel<3>
     virtual ~ElectroPhysiologyReaction(){};
 
     void initializeElectroPhysiologyReaction();
+    virtual void getReactionRates(size_t k, BatchedSpecies &species, size_t batch_size,
+                                  BatchedValues &production_rates, BatchedValues &loss_rates) override;
 };
 
 /**
@@ -81,6 +94,23 @@ class AlievPanfilowModel : public ElectroPhysiologyReaction
     virtual Real getProductionRateGateVariable(LocalSpecies &species) override;
     virtual Real getLossRateGateVariable(LocalSpecies &species) override;
 
+    inline Real productionRateIonicCurrent(Real voltage)
+    {
+        return -k_ * voltage * (voltage * voltage - a_ * voltage - voltage) / c_m_;
+    };
+    inline Real lossRateIonicCurrent(Real gate_variable)
+    {
+        return (k_ * a_ + gate_variable) / c_m_;
+    };
+    inline Real lossRateGateVariable(Real voltage, Real gate_variable)
+    {
+        return epsilon_ + mu_1_ * gate_variable / (mu_2_ + voltage + Eps);
+    };
+    inline Real productionRateGateVariable(Real voltage, Real gate_variable)
+    {
+        return -lossRateGateVariable(voltage, gate_variable) * k_ * voltage * (voltage - b_ - 1.0);
+    };
+
   public:
     explicit AlievPanfilowModel(Real k_a, Real c_m, Real k, Real a, Real b, Real mu_1, Real mu_2, Real epsilon)
         : ElectroPhysiologyReaction(k_a), k_(k), a_(a), b_(b), mu_1_(mu_1), mu_2_(mu_2),
@@ -89,6 +119,8 @@ class AlievPanfilowModel : public ElectroPhysiologyReaction
         reaction_model_ = "AlievPanfilowModel";
     };
     virtual ~AlievPanfilowModel(){};
+    virtual void getReactionRates(size_t k, BatchedSpecies &species, size_t batch_size,
+                                  BatchedValues &production_rates, BatchedValues &loss_rates) override;
 };
 
 /**
@@ -141,10 +173,10 @@ using ElectroPhysiologyDiffusionRelaxationComplex =
 
 /** Solve the reaction ODE equation of trans-membrane potential	using forward sweeping */
 using ElectroPhysiologyReactionRelaxationForward =
-    SimpleDynamics<ReactionRelaxationForward<ElectroPhysiologyReaction>>;
+    BatchedReactionRelaxationForward<ElectroPhysiologyReaction>;
 /** Solve the reaction ODE equation of trans-membrane potential	using backward sweeping */
 using ElectroPhysiologyReactionRelaxationBackward =
-    SimpleDynamics<ReactionRelaxationBackward<ElectroPhysiologyReaction>>;
+    BatchedReactionRelaxationBackward<ElectroPhysiologyReaction>;
 } // namespace electro_physiology
 } // namespace SPH
 #endif // ELECTRO_PHYSIOLOGY_H
\ No newline at end of file
@@ -50,10 +50,17 @@ class ParallelUnsequencedPolicy
 {
 };
 
+/** Parallel execution on a SYCL device, the CPU device by default.
+ * Without SYCL, it falls back to ParallelPolicy on the host. */
+class ParallelDevicePolicy
+{
+};
+
 inline constexpr auto seq = SequencedPolicy{};
 inline constexpr auto unseq = UnsequencedPolicy{};
 inline constexpr auto par = ParallelPolicy{};
 inline constexpr auto par_unseq = ParallelUnsequencedPolicy{};
+inline constexpr auto par_device = ParallelDevicePolicy{};
 } // namespace execution
 } // namespace SPH
 #endif // EXECUTION_POLICY_H
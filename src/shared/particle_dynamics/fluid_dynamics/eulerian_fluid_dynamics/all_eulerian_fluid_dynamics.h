@@ -32,5 +32,6 @@
 
 #pragma once
 
+#include "eulerian_compressible_face_integration.hpp"
 #include "eulerian_compressible_fluid_integration.hpp"
 #include "eulerian_fluid_integration.hpp"
@@ -0,0 +1,103 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file eulerian_compressible_face_integration.h
+ * @brief Face-based finite volume integration for compressible flow.
+ * @details Different from the cell-based integration, in which the interface state
+ * is computed from both sides, the Riemann problem of each face is solved only once
+ * and the flux is scattered to the two cells. The faces are processed color by color
+ * so that the scattering is free of data race.
+ * @author Zhentong Wang and Xiangyu Hu
+ */
+
+#ifndef EULERIAN_COMPRESSIBLE_FACE_INTEGRATION_H
+#define EULERIAN_COMPRESSIBLE_FACE_INTEGRATION_H
+
+#include "eulerian_compressible_fluid_integration.h"
+#include "unstructured_mesh.h"
+
+namespace SPH
+{
+namespace fluid_dynamics
+{
+/**
+ * @class BaseFaceIntegrationInCompressible
+ * @brief Base class for face-based integration with batched Riemann solutions.
+ */
+template <class RiemannSolverType>
+class BaseFaceIntegrationInCompressible : public BaseDynamics<void>
+{
+  public:
+    explicit BaseFaceIntegrationInCompressible(BaseInnerRelationInFVM &inner_relation, Real limiter_parameter = 5.0);
+    virtual ~BaseFaceIntegrationInCompressible(){};
+
+  protected:
+    BaseParticles &particles_;
+    FaceListInFVM &face_list_;
+    CompressibleFluid compressible_fluid_;
+    RiemannSolverType riemann_solver_;
+    StdLargeVec<Real> &Vol_, &rho_, &mass_, &p_, &E_, &dE_dt_, &dmass_dt_;
+    StdLargeVec<Vecd> &vel_, &mom_, &force_, &force_prior_;
+
+    /** Solve the Riemann problems of all faces in batches and pass the interface states
+     *  to the function which scatters the fluxes to the owner and neighbor cells. */
+    template <typename ScatterFunction>
+    void interactionByFaces(const ScatterFunction &scatter_flux);
+};
+
+/**
+ * @class EulerianCompressibleFaceIntegration1stHalf
+ * @brief Momentum update with the face-based fluxes.
+ */
+template <class RiemannSolverType>
+class EulerianCompressibleFaceIntegration1stHalf : public BaseFaceIntegrationInCompressible<RiemannSolverType>
+{
+  public:
+    explicit EulerianCompressibleFaceIntegration1stHalf(BaseInnerRelationInFVM &inner_relation, Real limiter_parameter = 5.0)
+        : BaseFaceIntegrationInCompressible<RiemannSolverType>(inner_relation, limiter_parameter){};
+    virtual ~EulerianCompressibleFaceIntegration1stHalf(){};
+    virtual void exec(Real dt = 0.0) override;
+};
+using EulerianCompressibleFaceIntegration1stHalfNoRiemann = EulerianCompressibleFaceIntegration1stHalf<NoRiemannSolverInCompressibleEulerianMethod>;
+using EulerianCompressibleFaceIntegration1stHalfHLLCRiemann = EulerianCompressibleFaceIntegration1stHalf<HLLCRiemannSolver>;
+using EulerianCompressibleFaceIntegration1stHalfHLLCWithLimiterRiemann = EulerianCompressibleFaceIntegration1stHalf<HLLCWithLimiterRiemannSolver>;
+
+/**
+ * @class EulerianCompressibleFaceIntegration2ndHalf
+ * @brief Mass and energy update with the face-based fluxes.
+ */
+template <class RiemannSolverType>
+class EulerianCompressibleFaceIntegration2ndHalf : public BaseFaceIntegrationInCompressible<RiemannSolverType>
+{
+  public:
+    explicit EulerianCompressibleFaceIntegration2ndHalf(BaseInnerRelationInFVM &inner_relation, Real limiter_parameter = 5.0)
+        : BaseFaceIntegrationInCompressible<RiemannSolverType>(inner_relation, limiter_parameter){};
+    virtual ~EulerianCompressibleFaceIntegration2ndHalf(){};
+    virtual void exec(Real dt = 0.0) override;
+};
+using EulerianCompressibleFaceIntegration2ndHalfNoRiemann = EulerianCompressibleFaceIntegration2ndHalf<NoRiemannSolverInCompressibleEulerianMethod>;
+using EulerianCompressibleFaceIntegration2ndHalfHLLCRiemann = EulerianCompressibleFaceIntegration2ndHalf<HLLCRiemannSolver>;
+using EulerianCompressibleFaceIntegration2ndHalfHLLCWithLimiterRiemann = EulerianCompressibleFaceIntegration2ndHalf<HLLCWithLimiterRiemannSolver>;
+} // namespace fluid_dynamics
+} // namespace SPH
+#endif // EULERIAN_COMPRESSIBLE_FACE_INTEGRATION_H
@@ -0,0 +1,158 @@
+#ifndef EULERIAN_COMPRESSIBLE_FACE_INTEGRATION_HPP
+#define EULERIAN_COMPRESSIBLE_FACE_INTEGRATION_HPP
+
+#include "eulerian_compressible_face_integration.h"
+
+namespace SPH
+{
+namespace fluid_dynamics
+{
+//=================================================================================================//
+template <class RiemannSolverType>
+BaseFaceIntegrationInCompressible<RiemannSolverType>::
+    BaseFaceIntegrationInCompressible(BaseInnerRelationInFVM &inner_relation, Real limiter_parameter)
+    : BaseDynamics<void>(inner_relation.getSPHBody()),
+      particles_(inner_relation.getSPHBody().getBaseParticles()),
+      face_list_(inner_relation.getFaceList()),
+      compressible_fluid_(CompressibleFluid(1.0, 1.4)),
+      riemann_solver_(compressible_fluid_, compressible_fluid_, limiter_parameter),
+      Vol_(*particles_.getVariableDataByName<Real>("VolumetricMeasure")),
+      rho_(*particles_.getVariableDataByName<Real>("Density")),
+      mass_(*particles_.getVariableDataByName<Real>("Mass")),
+      p_(*particles_.registerSharedVariable<Real>("Pressure")),
+      E_(*particles_.registerSharedVariable<Real>("TotalEnergy")),
+      dE_dt_(*particles_.registerSharedVariable<Real>("TotalEnergyChangeRate")),
+      dmass_dt_(*particles_.registerSharedVariable<Real>("MassChangeRate")),
+      vel_(*particles_.registerSharedVariable<Vecd>("Velocity")),
+      mom_(*particles_.registerSharedVariable<Vecd>("Momentum")),
+      force_(*particles_.registerSharedVariable<Vecd>("Force")),
+      force_prior_(*particles_.registerSharedVariable<Vecd>("ForcePrior")) {}
+//=================================================================================================//
+template <class RiemannSolverType>
+template <typename ScatterFunction>
+void BaseFaceIntegrationInCompressible<RiemannSolverType>::
+    interactionByFaces(const ScatterFunction &scatter_flux)
+{
+    StdLargeVec<size_t> &owner = face_list_.owner_;
+    StdLargeVec<size_t> &neighbor = face_list_.neighbor_;
+    StdLargeVec<Vecd> &normal = face_list_.normal_;
+    for (const IndexRange &color_range : face_list_.color_ranges_)
+    {
+        parallel_for(
+            color_range,
+            [&](const IndexRange &r)
+            {
+                CompressibleInterfaceBatch batch;
+                for (size_t face_begin = r.begin(); face_begin < r.end(); face_begin += CompressibleInterfaceBatch::Capacity)
+                {
+                    size_t face_end = SMIN(face_begin + CompressibleInterfaceBatch::Capacity, r.end());
+                    batch.size_ = 0;
+                    for (size_t face = face_begin; face != face_end; ++face)
+                    {
+                        size_t index_i = owner[face];
+                        size_t index_j = neighbor[face];
+                        batch.addInterface(rho_[index_i], vel_[index_i], p_[index_i], E_[index_i] / Vol_[index_i],
+                                           rho_[index_j], vel_[index_j], p_[index_j], E_[index_j] / Vol_[index_j],
+                                           normal[face]);
+                    }
+                    riemann_solver_.getInterfaceStates(batch);
+                    for (size_t l = 0; l != batch.size_; ++l)
+                    {
+                        scatter_flux(face_begin + l, batch, l);
+                    }
+                }
+            },
+            ap);
+    }
+}
+//=================================================================================================//
+template <class RiemannSolverType>
+void EulerianCompressibleFaceIntegration1stHalf<RiemannSolverType>::exec(Real dt)
+{
+    size_t total_real_cells = this->particles_.TotalRealParticles();
+    StdLargeVec<Vecd> &force = this->force_;
+    StdLargeVec<Vecd> &force_prior = this->force_prior_;
+    particle_for(ParallelPolicy(), IndexRange(0, total_real_cells),
+                 [&](size_t index_i)
+                 { force[index_i] = force_prior[index_i]; });
+
+    FaceListInFVM &face_list = this->face_list_;
+    this->interactionByFaces(
+        [&](size_t face, CompressibleInterfaceBatch &batch, size_t l)
+        {
+            Matd convect_flux = batch.rho_star_[l] * batch.vel_star_[l] * batch.vel_star_[l].transpose();
+            Vecd momentum_flux = face_list.area_[face] * (convect_flux + batch.p_star_[l] * Matd::Identity()) * face_list.normal_[face];
+            force[face_list.owner_[face]] += momentum_flux;
+            size_t index_j = face_list.neighbor_[face];
+            if (index_j < total_real_cells)
+                force[index_j] -= momentum_flux;
+        });
+
+    StdLargeVec<Vecd> &mom = this->mom_;
+    StdLargeVec<Vecd> &vel = this->vel_;
+    StdLargeVec<Real> &mass = this->mass_;
+    particle_for(ParallelPolicy(), IndexRange(0, total_real_cells),
+                 [&](size_t index_i)
+                 {
+                     mom[index_i] += force[index_i] * dt;
+                     vel[index_i] = mom[index_i] / mass[index_i];
+                 });
+    this->setUpdated();
+}
+//=================================================================================================//
+template <class RiemannSolverType>
+void EulerianCompressibleFaceIntegration2ndHalf<RiemannSolverType>::exec(Real dt)
+{
+    size_t total_real_cells = this->particles_.TotalRealParticles();
+    StdLargeVec<Real> &dmass_dt = this->dmass_dt_;
+    StdLargeVec<Real> &dE_dt = this->dE_dt_;
+    StdLargeVec<Vecd> &force_prior = this->force_prior_;
+    StdLargeVec<Vecd> &vel = this->vel_;
+    particle_for(ParallelPolicy(), IndexRange(0, total_real_cells),
+                 [&](size_t index_i)
+                 {
+                     dmass_dt[index_i] = 0.0;
+                     dE_dt[index_i] = force_prior[index_i].dot(vel[index_i]); // TODO: not conservative formulation
+                 });
+
+    FaceListInFVM &face_list = this->face_list_;
+    this->interactionByFaces(
+        [&](size_t face, CompressibleInterfaceBatch &batch, size_t l)
+        {
+            Real area = face_list.area_[face];
+            Vecd &e_ij = face_list.normal_[face];
+            Real mass_flux = area * (batch.rho_star_[l] * batch.vel_star_[l]).dot(e_ij);
+            Real energy_flux = area * ((batch.E_star_[l] + batch.p_star_[l]) * batch.vel_star_[l]).dot(e_ij);
+            size_t index_i = face_list.owner_[face];
+            dmass_dt[index_i] += mass_flux;
+            dE_dt[index_i] += energy_flux;
+            size_t index_j = face_list.neighbor_[face];
+            if (index_j < total_real_cells)
+            {
+                dmass_dt[index_j] -= mass_flux;
+                dE_dt[index_j] -= energy_flux;
+            }
+        });
+
+    StdLargeVec<Real> &E = this->E_;
+    StdLargeVec<Real> &mass = this->mass_;
+    StdLargeVec<Real> &rho = this->rho_;
+    StdLargeVec<Real> &Vol = this->Vol_;
+    StdLargeVec<Real> &p = this->p_;
+    StdLargeVec<Vecd> &mom = this->mom_;
+    CompressibleFluid &compressible_fluid = this->compressible_fluid_;
+    particle_for(ParallelPolicy(), IndexRange(0, total_real_cells),
+                 [&](size_t index_i)
+                 {
+                     E[index_i] += dE_dt[index_i] * dt;
+                     mass[index_i] += dmass_dt[index_i] * dt;
+                     rho[index_i] = mass[index_i] / Vol[index_i];
+                     Real rho_e = E[index_i] / Vol[index_i] - 0.5 * (mom[index_i] / mass[index_i]).squaredNorm() * rho[index_i];
+                     p[index_i] = compressible_fluid.getPressure(rho[index_i], rho_e);
+                 });
+    this->setUpdated();
+}
+//=================================================================================================//
+} // namespace fluid_dynamics
+} // namespace SPH
+#endif // EULERIAN_COMPRESSIBLE_FACE_INTEGRATION_HPP
@@ -5,7 +5,7 @@ namespace SPH
 //=================================================================================================//
 NoRiemannSolverInCompressibleEulerianMethod::
     NoRiemannSolverInCompressibleEulerianMethod(CompressibleFluid &compressible_fluid_i,
-                                                CompressibleFluid &compressible_fluid_j)
+                                                CompressibleFluid &compressible_fluid_j, Real limiter_parameter)
     : compressible_fluid_i_(compressible_fluid_i), compressible_fluid_j_(compressible_fluid_j){};
 //=================================================================================================//
 CompressibleFluidStarState NoRiemannSolverInCompressibleEulerianMethod::
@@ -19,17 +19,43 @@ CompressibleFluidStarState NoRiemannSolverInCompressibleEulerianMethod::
     return CompressibleFluidStarState(rho_star, v_star, p_star, energy_star);
 }
 //=================================================================================================//
+void NoRiemannSolverInCompressibleEulerianMethod::getInterfaceStates(CompressibleInterfaceBatch &batch)
+{
+    for (size_t l = 0; l != batch.size_; ++l)
+    {
+        batch.setStarState(l, getInterfaceState(batch.StateI(l), batch.StateJ(l), batch.e_ij_[l]));
+    }
+}
+//=================================================================================================//
 HLLCRiemannSolver::HLLCRiemannSolver(CompressibleFluid &compressible_fluid_i,
                                      CompressibleFluid &compressible_fluid_j, Real limiter_parameter)
     : compressible_fluid_i_(compressible_fluid_i), compressible_fluid_j_(compressible_fluid_j){};
 //=================================================================================================//
 CompressibleFluidStarState HLLCRiemannSolver::
     getInterfaceState(const CompressibleFluidState &state_i, const CompressibleFluidState &state_j, const Vecd &e_ij)
+{
+    return getInterfaceState(state_i, state_j, e_ij,
+                             compressible_fluid_i_.getSoundSpeed(state_i.p_, state_i.rho_),
+                             compressible_fluid_j_.getSoundSpeed(state_j.p_, state_j.rho_));
+}
+//=================================================================================================//
+void HLLCRiemannSolver::getInterfaceStates(CompressibleInterfaceBatch &batch)
+{
+    batch.computeSoundSpeeds(compressible_fluid_i_.HeatCapacityRatio(), compressible_fluid_j_.HeatCapacityRatio());
+    for (size_t l = 0; l != batch.size_; ++l)
+    {
+        batch.setStarState(l, getInterfaceState(batch.StateI(l), batch.StateJ(l), batch.e_ij_[l], batch.c_i_[l], batch.c_j_[l]));
+    }
+}
+//=================================================================================================//
+CompressibleFluidStarState HLLCRiemannSolver::
+    getInterfaceState(const CompressibleFluidState &state_i, const CompressibleFluidState &state_j,
+                      const Vecd &e_ij, Real c_i, Real c_j)
 {
     Real ul = -e_ij.dot(state_i.vel_);
     Real ur = -e_ij.dot(state_j.vel_);
-    Real s_l = ul - compressible_fluid_i_.getSoundSpeed(state_i.p_, state_i.rho_);
-    Real s_r = ur + compressible_fluid_j_.getSoundSpeed(state_j.p_, state_j.rho_);
+    Real s_l = ul - c_i;
+    Real s_r = ur + c_j;
     Real s_star = (state_j.rho_ * ur * (s_r - ur) + state_i.rho_ * ul * (ul - s_l) + state_i.p_ - state_j.p_) /
                   (state_j.rho_ * (s_r - ur) + state_i.rho_ * (ul - s_l));
     Real p_star = 0.0;
@@ -77,13 +103,31 @@ HLLCWithLimiterRiemannSolver::
 //=================================================================================================//
 CompressibleFluidStarState HLLCWithLimiterRiemannSolver::
     getInterfaceState(const CompressibleFluidState &state_i, const CompressibleFluidState &state_j, const Vecd &e_ij)
+{
+    return getInterfaceState(state_i, state_j, e_ij,
+                             compressible_fluid_i_.getSoundSpeed(state_i.p_, state_i.rho_),
+                             compressible_fluid_j_.getSoundSpeed(state_j.p_, state_j.rho_));
+}
+//=================================================================================================//
+void HLLCWithLimiterRiemannSolver::getInterfaceStates(CompressibleInterfaceBatch &batch)
+{
+    batch.computeSoundSpeeds(compressible_fluid_i_.HeatCapacityRatio(), compressible_fluid_j_.HeatCapacityRatio());
+    for (size_t l = 0; l != batch.size_; ++l)
+    {
+        batch.setStarState(l, getInterfaceState(batch.StateI(l), batch.StateJ(l), batch.e_ij_[l], batch.c_i_[l], batch.c_j_[l]));
+    }
+}
+//=================================================================================================//
+CompressibleFluidStarState HLLCWithLimiterRiemannSolver::
+    getInterfaceState(const CompressibleFluidState &state_i, const CompressibleFluidState &state_j,
+                      const Vecd &e_ij, Real c_i, Real c_j)
 {
     Real ul = -e_ij.dot(state_i.vel_);
     Real ur = -e_ij.dot(state_j.vel_);
-    Real s_l = ul - compressible_fluid_i_.getSoundSpeed(state_i.p_, state_i.rho_);
-    Real s_r = ur + compressible_fluid_j_.getSoundSpeed(state_j.p_, state_j.rho_);
-    Real rhol_cl = compressible_fluid_i_.getSoundSpeed(state_i.p_, state_i.rho_) * state_i.rho_;
-    Real rhor_cr = compressible_fluid_j_.getSoundSpeed(state_j.p_, state_j.rho_) * state_j.rho_;
+    Real s_l = ul - c_i;
+    Real s_r = ur + c_j;
+    Real rhol_cl = c_i * state_i.rho_;
+    Real rhor_cr = c_j * state_j.rho_;
     Real clr = (rhol_cl + rhor_cr) / (state_i.rho_ + state_j.rho_);
     Real s_star = (state_j.p_ - state_i.p_) * pow(SMIN(limiter_parameter_ * SMAX((ul - ur) / clr, Real(0)), Real(1)), 2) /
                       (state_i.rho_ * (s_l - ul) - state_j.rho_ * (s_r - ur)) +
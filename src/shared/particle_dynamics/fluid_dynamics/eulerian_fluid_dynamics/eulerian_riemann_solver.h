@@ -51,6 +51,52 @@ struct CompressibleFluidStarState : FluidStateOut
         : FluidStateOut(rho, vel, p), E_(E){};
 };
 
+/**
+ * @struct CompressibleInterfaceBatch
+ * @brief  States on both sides of a batch of interfaces in structure-of-arrays layout.
+ * @details The sound speeds of the whole batch are evaluated in one vectorizable loop
+ * before the wave pattern of each interface is resolved.
+ */
+struct CompressibleInterfaceBatch
+{
+    static constexpr size_t Capacity = 16;
+    size_t size_ = 0;
+    Real rho_i_[Capacity], p_i_[Capacity], E_i_[Capacity], c_i_[Capacity];
+    Real rho_j_[Capacity], p_j_[Capacity], E_j_[Capacity], c_j_[Capacity];
+    Vecd vel_i_[Capacity], vel_j_[Capacity], e_ij_[Capacity];
+    Real rho_star_[Capacity], p_star_[Capacity], E_star_[Capacity];
+    Vecd vel_star_[Capacity];
+
+    void addInterface(Real rho_i, const Vecd &vel_i, Real p_i, Real E_i,
+                      Real rho_j, const Vecd &vel_j, Real p_j, Real E_j, const Vecd &e_ij)
+    {
+        rho_i_[size_] = rho_i, vel_i_[size_] = vel_i, p_i_[size_] = p_i, E_i_[size_] = E_i;
+        rho_j_[size_] = rho_j, vel_j_[size_] = vel_j, p_j_[size_] = p_j, E_j_[size_] = E_j;
+        e_ij_[size_] = e_ij;
+        size_++;
+    };
+
+    void computeSoundSpeeds(Real gamma_i, Real gamma_j)
+    {
+        for (size_t l = 0; l != size_; ++l)
+        {
+            c_i_[l] = std::sqrt(gamma_i * p_i_[l] / rho_i_[l]);
+            c_j_[l] = std::sqrt(gamma_j * p_j_[l] / rho_j_[l]);
+        }
+    };
+
+    CompressibleFluidState StateI(size_t l) { return CompressibleFluidState(rho_i_[l], vel_i_[l], p_i_[l], E_i_[l]); };
+    CompressibleFluidState StateJ(size_t l) { return CompressibleFluidState(rho_j_[l], vel_j_[l], p_j_[l], E_j_[l]); };
+
+    void setStarState(size_t l, const CompressibleFluidStarState &star_state)
+    {
+        rho_star_[l] = star_state.rho_;
+        vel_star_[l] = star_state.vel_;
+        p_star_[l] = star_state.p_;
+        E_star_[l] = star_state.E_;
+    };
+};
+
 /**
  * @struct NoRiemannSolverInCompressibleEulerianMethod
  * @brief  NO RiemannSolver for weakly-compressible flow in Eulerian method for compressible flow.
@@ -60,8 +106,9 @@ class NoRiemannSolverInCompressibleEulerianMethod
     CompressibleFluid &compressible_fluid_i_, &compressible_fluid_j_;
 
   public:
-    NoRiemannSolverInCompressibleEulerianMethod(CompressibleFluid &fluid_i, CompressibleFluid &fluid_j);
+    NoRiemannSolverInCompressibleEulerianMethod(CompressibleFluid &fluid_i, CompressibleFluid &fluid_j, Real limiter_parameter = 0.0);
     CompressibleFluidStarState getInterfaceState(const CompressibleFluidState &state_i, const CompressibleFluidState &state_j, const Vecd &e_ij);
+    void getInterfaceStates(CompressibleInterfaceBatch &batch);
 };
 
 /**
@@ -75,6 +122,12 @@ class HLLCRiemannSolver
   public:
     HLLCRiemannSolver(CompressibleFluid &compressible_fluid_i, CompressibleFluid &compressible_fluid_j, Real limiter_parameter = 0.0);
     CompressibleFluidStarState getInterfaceState(const CompressibleFluidState &state_i, const CompressibleFluidState &state_j, const Vecd &e_ij);
+    /** Interface states of a batch with the sound speeds evaluated together beforehand. */
+    void getInterfaceStates(CompressibleInterfaceBatch &batch);
+
+  protected:
+    CompressibleFluidStarState getInterfaceState(const CompressibleFluidState &state_i, const CompressibleFluidState &state_j,
+                                                 const Vecd &e_ij, Real c_i, Real c_j);
 };
 /**
  * @struct HLLCWithLimiterRiemannSolver
@@ -88,6 +141,12 @@ class HLLCWithLimiterRiemannSolver
   public:
     HLLCWithLimiterRiemannSolver(CompressibleFluid &compressible_fluid_i, CompressibleFluid &compressible_fluid_j, Real limiter_parameter = 5.0);
     CompressibleFluidStarState getInterfaceState(const CompressibleFluidState &state_i, const CompressibleFluidState &state_j, const Vecd &e_ij);
+    /** Interface states of a batch with the sound speeds evaluated together beforehand. */
+    void getInterfaceStates(CompressibleInterfaceBatch &batch);
+
+  protected:
+    CompressibleFluidStarState getInterfaceState(const CompressibleFluidState &state_i, const CompressibleFluidState &state_j,
+                                                 const Vecd &e_ij, Real c_i, Real c_j);
 };
 } // namespace SPH
 #endif // EULERIAN_RIEMANN_SOLVER_H
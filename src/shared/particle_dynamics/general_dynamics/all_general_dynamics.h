@@ -32,6 +32,7 @@
 #include "all_domain_bounding.h"
 #include "all_surface_indication.h"
 #include "base_general_dynamics.h"
+#include "contact_broad_phase.h"
 #include "force_prior.h"
 #include "fvm_ghost_boundary.h"
 #include "general_constraint.h"
@@ -39,4 +40,7 @@
 #include "general_interpolation.h"
 #include "general_reduce.h"
 #include "kernel_correction.hpp"
-#include "particle_smoothing.hpp"
\ No newline at end of file
+#include "particle_activity.h"
+#include "particle_split_and_merge.h"
+#include "particle_smoothing.hpp"
+#include "point_probe.hpp"
\ No newline at end of file
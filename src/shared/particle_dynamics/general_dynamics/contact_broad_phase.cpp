@@ -0,0 +1,131 @@
+#include "contact_broad_phase.h"
+
+#include <numeric>
+
+namespace SPH
+{
+//=================================================================================================//
+ContactBroadPhase::ContactBroadPhase(RealBodyVector bodies)
+    : bodies_(bodies), bounding_boxes_(bodies.size()),
+      is_overlapping_(bodies.size(), StdVec<bool>(bodies.size(), true))
+{
+    for (size_t i = 0; i != bodies_.size(); ++i)
+    {
+        position_lower_bounds_.push_back(
+            lower_bound_ptrs_keeper_.createPtr<ReduceDynamics<PositionLowerBound>>(*bodies_[i]));
+        position_upper_bounds_.push_back(
+            upper_bound_ptrs_keeper_.createPtr<ReduceDynamics<PositionUpperBound>>(*bodies_[i]));
+    }
+}
+//=================================================================================================//
+void ContactBroadPhase::subscribeRelation(BaseContactRelation &contact_relation)
+{
+    contact_relations_.push_back(&contact_relation);
+}
+//=================================================================================================//
+int ContactBroadPhase::findBodyIndex(SPHBody &body)
+{
+    for (size_t i = 0; i != bodies_.size(); ++i)
+    {
+        if (bodies_[i] == &body)
+            return i;
+    }
+    return -1;
+}
+//=================================================================================================//
+bool ContactBroadPhase::isOverlapping(SPHBody &body, SPHBody &other_body)
+{
+    int i = findBodyIndex(body);
+    int j = findBodyIndex(other_body);
+    // bodies not in the broad phase are always taken as possibly in contact
+    return i < 0 || j < 0 ? true : is_overlapping_[i][j];
+}
+//=================================================================================================//
+BoundingBox ContactBroadPhase::getBoundingBox(SPHBody &body)
+{
+    int i = findBodyIndex(body);
+    if (i < 0)
+    {
+        std::cout << "\n Error: " << body.getName() << " is not in the contact broad phase!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+    return bounding_boxes_[i];
+}
+//=================================================================================================//
+bool ContactBroadPhase::isBoxOverlapping(size_t i, size_t j)
+{
+    return (bounding_boxes_[i].first_.array() <= bounding_boxes_[j].second_.array()).all() &&
+           (bounding_boxes_[j].first_.array() <= bounding_boxes_[i].second_.array()).all();
+}
+//=================================================================================================//
+void ContactBroadPhase::update()
+{
+    for (size_t i = 0; i != bodies_.size(); ++i)
+    {
+        Vecd inflation = bodies_[i]->sph_adaptation_->getKernel()->CutOffRadius() * Vecd::Ones();
+        bounding_boxes_[i] = BoundingBox(position_lower_bounds_[i]->exec() - inflation,
+                                         position_upper_bounds_[i]->exec() + inflation);
+    }
+    sweepAndPrune();
+
+    for (BaseContactRelation *contact_relation : contact_relations_)
+    {
+        SPHBody &sph_body = contact_relation->getSPHBody();
+        StdVec<bool> is_contact_active;
+        for (RealBody *contact_body : contact_relation->contact_bodies_)
+        {
+            is_contact_active.push_back(isOverlapping(sph_body, *contact_body));
+        }
+        contact_relation->setActiveContacts(is_contact_active);
+    }
+}
+//=================================================================================================//
+void ContactBroadPhase::sweepAndPrune()
+{
+    size_t number_of_bodies = bodies_.size();
+    for (size_t i = 0; i != number_of_bodies; ++i)
+    {
+        std::fill(is_overlapping_[i].begin(), is_overlapping_[i].end(), false);
+        is_overlapping_[i][i] = true;
+    }
+
+    // sweep along the axis with the largest spread of box centers
+    Vecd lower_center = MaxReal * Vecd::Ones();
+    Vecd upper_center = -MaxReal * Vecd::Ones();
+    for (const BoundingBox &bounding_box : bounding_boxes_)
+    {
+        Vecd center = 0.5 * (bounding_box.first_ + bounding_box.second_);
+        lower_center = lower_center.cwiseMin(center);
+        upper_center = upper_center.cwiseMax(center);
+    }
+    int axis = 0;
+    (upper_center - lower_center).maxCoeff(&axis);
+
+    StdVec<size_t> sorted_bodies(number_of_bodies);
+    std::iota(sorted_bodies.begin(), sorted_bodies.end(), 0);
+    std::sort(sorted_bodies.begin(), sorted_bodies.end(),
+              [&](size_t i, size_t j)
+              { return bounding_boxes_[i].first_[axis] < bounding_boxes_[j].first_[axis]; });
+
+    StdVec<size_t> active_bodies;
+    for (size_t i : sorted_bodies)
+    {
+        // prune the bodies whose intervals end before the current one starts
+        active_bodies.erase(std::remove_if(active_bodies.begin(), active_bodies.end(),
+                                           [&](size_t j)
+                                           { return bounding_boxes_[j].second_[axis] < bounding_boxes_[i].first_[axis]; }),
+                            active_bodies.end());
+        for (size_t j : active_bodies)
+        {
+            if (isBoxOverlapping(i, j))
+            {
+                is_overlapping_[i][j] = true;
+                is_overlapping_[j][i] = true;
+            }
+        }
+        active_bodies.push_back(i);
+    }
+}
+//=================================================================================================//
+} // namespace SPH
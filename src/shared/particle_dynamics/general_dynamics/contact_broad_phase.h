@@ -0,0 +1,74 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	contact_broad_phase.h
+ * @brief 	Broad phase of the contact detection among bodies.
+ * @details The bounding boxes of the bodies are obtained by reducing particle positions
+ * 			and inflated by the cutoff radius of each body.
+ * 			The overlapping pairs are found by sweep and prune along the axis
+ * 			with the largest spread of the box centers.
+ * 			The contact relations subscribed skip the neighbor search
+ * 			with the contact bodies whose boxes do not overlap.
+ * @author	Chi Zhang and Xiangyu Hu
+ */
+
+#ifndef CONTACT_BROAD_PHASE_H
+#define CONTACT_BROAD_PHASE_H
+
+#include "general_reduce.h"
+#include "particle_dynamics_algorithms.h"
+
+namespace SPH
+{
+/**
+ * @class ContactBroadPhase
+ * @brief Find the pairs of bodies which may be in contact.
+ * Note that, update should be called before updating the configuration of the subscribed relations.
+ */
+class ContactBroadPhase
+{
+  public:
+    explicit ContactBroadPhase(RealBodyVector bodies);
+    virtual ~ContactBroadPhase(){};
+
+    void subscribeRelation(BaseContactRelation &contact_relation);
+    void update();
+    bool isOverlapping(SPHBody &body, SPHBody &other_body);
+    BoundingBox getBoundingBox(SPHBody &body);
+
+  protected:
+    UniquePtrsKeeper<ReduceDynamics<PositionLowerBound>> lower_bound_ptrs_keeper_;
+    UniquePtrsKeeper<ReduceDynamics<PositionUpperBound>> upper_bound_ptrs_keeper_;
+    RealBodyVector bodies_;
+    StdVec<ReduceDynamics<PositionLowerBound> *> position_lower_bounds_;
+    StdVec<ReduceDynamics<PositionUpperBound> *> position_upper_bounds_;
+    StdVec<BoundingBox> bounding_boxes_;
+    StdVec<StdVec<bool>> is_overlapping_;
+    StdVec<BaseContactRelation *> contact_relations_;
+
+    int findBodyIndex(SPHBody &body);
+    bool isBoxOverlapping(size_t i, size_t j);
+    void sweepAndPrune();
+};
+} // namespace SPH
+#endif // CONTACT_BROAD_PHASE_H
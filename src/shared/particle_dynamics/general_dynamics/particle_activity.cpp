@@ -0,0 +1,106 @@
+#include "particle_activity.h"
+
+namespace SPH
+{
+//=================================================================================================//
+ActiveParticles::ActiveParticles(SPHBody &sph_body)
+    : BodyPartByParticle(sph_body, sph_body.getName() + "ActiveParticles"),
+      is_sleeping_(*base_particles_.registerSharedVariable<int>("IsSleeping"))
+{
+    base_particles_.addVariableToSort<int>("IsSleeping");
+    updateActiveParticles();
+}
+//=================================================================================================//
+void ActiveParticles::updateActiveParticles()
+{
+    body_part_particles_.clear();
+    for (size_t i = 0; i != base_particles_.TotalRealParticles(); ++i)
+    {
+        if (!is_sleeping_[i])
+            body_part_particles_.push_back(i);
+    }
+}
+//=================================================================================================//
+size_t ActiveParticles::NumberOfSleepingParticles()
+{
+    return base_particles_.TotalRealParticles() - body_part_particles_.size();
+}
+//=================================================================================================//
+UpdateParticleActivity::
+    UpdateParticleActivity(BaseInnerRelation &inner_relation, ActiveParticles &active_particles,
+                           Real velocity_threshold, Real acceleration_threshold, int quiescent_updates)
+    : LocalDynamics(inner_relation.getSPHBody()), DataDelegateInner(inner_relation),
+      BaseDynamics<void>(inner_relation.getSPHBody()), active_particles_(active_particles),
+      velocity_threshold_(velocity_threshold), acceleration_threshold_(acceleration_threshold),
+      quiescent_updates_(quiescent_updates),
+      mass_(*particles_->getVariableDataByName<Real>("Mass")),
+      vel_(*particles_->registerSharedVariable<Vecd>("Velocity")),
+      force_(*particles_->registerSharedVariable<Vecd>("Force")),
+      force_prior_(*particles_->registerSharedVariable<Vecd>("ForcePrior")),
+      is_sleeping_(*particles_->getVariableDataByName<int>("IsSleeping")),
+      quiescent_count_(*particles_->registerSharedVariable<int>("QuiescentCount"))
+{
+    particles_->addVariableToSort<int>("QuiescentCount");
+    if (&active_particles.getSPHBody() != &inner_relation.getSPHBody())
+    {
+        std::cout << "\n Error: the active particles are not from the body of the inner relation!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+}
+//=================================================================================================//
+bool UpdateParticleActivity::isQuiescent(size_t index_i)
+{
+    // the force of a sleeping particle is not updated, so that only the prior force may wake it up
+    Vecd acceleration = (force_[index_i] + force_prior_[index_i]) / mass_[index_i];
+    return vel_[index_i].squaredNorm() < velocity_threshold_ * velocity_threshold_ &&
+           acceleration.squaredNorm() < acceleration_threshold_ * acceleration_threshold_;
+}
+//=================================================================================================//
+bool UpdateParticleActivity::isApproachedByAwakeNeighbor(size_t index_i)
+{
+    const Neighborhood &inner_neighborhood = inner_configuration_[index_i];
+    for (size_t n = 0; n != inner_neighborhood.current_size_; ++n)
+    {
+        size_t index_j = inner_neighborhood.j_[n];
+        // e_ij points from j to i, so that positive value means j is approaching i
+        Real approaching_velocity = (vel_[index_j] - vel_[index_i]).dot(inner_neighborhood.e_ij_[n]);
+        if (!is_sleeping_[index_j] && approaching_velocity > velocity_threshold_)
+            return true;
+    }
+    return false;
+}
+//=================================================================================================//
+void UpdateParticleActivity::exec(Real dt)
+{
+    size_t total_real_particles = particles_->TotalRealParticles();
+    if (sleeping_state_.size() < total_real_particles)
+        sleeping_state_.resize(particles_->ParticlesBound());
+
+    particle_for(execution::ParallelPolicy(), IndexRange(0, total_real_particles),
+                 [&](size_t i)
+                 {
+                     quiescent_count_[i] = isQuiescent(i) ? quiescent_count_[i] + 1 : 0;
+                     bool is_approached = isApproachedByAwakeNeighbor(i);
+                     if (is_sleeping_[i])
+                     {
+                         sleeping_state_[i] = quiescent_count_[i] > 0 && !is_approached;
+                     }
+                     else
+                     {
+                         sleeping_state_[i] = quiescent_count_[i] >= quiescent_updates_ && !is_approached;
+                     }
+                 });
+
+    particle_for(execution::ParallelPolicy(), IndexRange(0, total_real_particles),
+                 [&](size_t i)
+                 {
+                     if (!sleeping_state_[i])
+                         quiescent_count_[i] = SMIN(quiescent_count_[i], quiescent_updates_ - 1);
+                     is_sleeping_[i] = sleeping_state_[i];
+                 });
+
+    active_particles_.updateActiveParticles();
+}
+//=================================================================================================//
+} // namespace SPH
@@ -0,0 +1,99 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file    particle_activity.h
+ * @brief   Deactivation of quiescent particles, i.e. sleeping particles, for near-static regions.
+ * @details The particles whose velocity and acceleration stay below thresholds
+ *          for a number of successive checks are put to sleep.
+ *          A sleeping particle is waken up when an awake neighbor approaches it
+ *          or when its acceleration, i.e. the load on it, exceeds the threshold again.
+ *          The awake particles are collected in ActiveParticles, a dynamic body part,
+ *          so that existing local dynamics can be restricted to them by ActiveParticleDynamics
+ *          and the computational cost scales with the active region.
+ *          The activity is updated for all particles, but typically less often than the acoustic steps.
+ *          Since the sleeping states are sorted with the particles,
+ *          the activity should be updated after particle sorting.
+ * @author  Xiangyu Hu
+ */
+
+#ifndef PARTICLE_ACTIVITY_H
+#define PARTICLE_ACTIVITY_H
+
+#include "base_general_dynamics.h"
+
+namespace SPH
+{
+/**
+ * @class ActiveParticles
+ * @brief A dynamic body part with the particles which are not sleeping.
+ * Before the first activity update, all particles are active.
+ */
+class ActiveParticles : public BodyPartByParticle
+{
+  public:
+    explicit ActiveParticles(SPHBody &sph_body);
+    virtual ~ActiveParticles(){};
+    void updateActiveParticles();
+    size_t NumberOfSleepingParticles();
+
+  protected:
+    StdLargeVec<int> &is_sleeping_;
+};
+
+/**
+ * @class UpdateParticleActivity
+ * @brief Update the sleeping states of the particles and the active particles.
+ * A particle falls asleep after its velocity and acceleration have been below the thresholds
+ * for the given number of successive updates and no awake neighbor approaches it.
+ * It is waken up once its velocity or acceleration exceeds the thresholds
+ * or an awake neighbor approaches it faster than the velocity threshold.
+ * Note that the Force of a sleeping particle is not updated by the dynamics restricted by ActiveParticleDynamics,
+ * but keeps the value below the threshold from the time the particle fell asleep.
+ * Therefore, only ForcePrior gives the change of the load on a sleeping particle.
+ * The dynamics giving ForcePrior, such as gravity and the contact forces from other bodies,
+ * should be carried out for all particles, not only the active ones,
+ * so that, e.g., an impacting body wakes up the sleeping particles it hits.
+ * The loads from the inner neighbors are accounted for by the approaching awake neighbors.
+ */
+class UpdateParticleActivity : public LocalDynamics, public DataDelegateInner, public BaseDynamics<void>
+{
+  public:
+    UpdateParticleActivity(BaseInnerRelation &inner_relation, ActiveParticles &active_particles,
+                           Real velocity_threshold, Real acceleration_threshold, int quiescent_updates = 10);
+    virtual ~UpdateParticleActivity(){};
+    virtual void exec(Real dt = 0.0) override;
+
+  protected:
+    ActiveParticles &active_particles_;
+    Real velocity_threshold_, acceleration_threshold_;
+    int quiescent_updates_;
+    StdLargeVec<Real> &mass_;
+    StdLargeVec<Vecd> &vel_, &force_, &force_prior_;
+    StdLargeVec<int> &is_sleeping_, &quiescent_count_;
+    StdLargeVec<int> sleeping_state_; /**< the new sleeping states before updated simultaneously */
+
+    bool isQuiescent(size_t index_i);
+    bool isApproachedByAwakeNeighbor(size_t index_i);
+};
+} // namespace SPH
+#endif // PARTICLE_ACTIVITY_H
@@ -0,0 +1,158 @@
+#include "particle_split_and_merge.h"
+
+namespace SPH
+{
+//=================================================================================================//
+RefinementIndicatorByVelocityGradient::
+    RefinementIndicatorByVelocityGradient(SPHBody &sph_body, Real reference_velocity)
+    : LocalDynamics(sph_body), DataDelegateSimple(sph_body),
+      reference_velocity_(reference_velocity),
+      vel_grad_(*particles_->getVariableDataByName<Matd>("VelocityGradient")),
+      indicator_(*particles_->registerSharedVariable<Real>("RefinementIndicator")) {}
+//=================================================================================================//
+void RefinementIndicatorByVelocityGradient::update(size_t index_i, Real dt)
+{
+    indicator_[index_i] = vel_grad_[index_i].norm() * particles_->ParticleSpacing(index_i) / reference_velocity_;
+}
+//=================================================================================================//
+ParticleSplitAndMerge::
+    ParticleSplitAndMerge(BaseInnerRelation &inner_relation, ParticleBuffer<Base> &buffer,
+                          const std::string &indicator_name, Real split_threshold, Real merge_threshold)
+    : LocalDynamics(inner_relation.getSPHBody()), DataDelegateInner(inner_relation),
+      BaseDynamics<void>(inner_relation.getSPHBody()), buffer_(buffer),
+      split_threshold_(split_threshold), merge_threshold_(merge_threshold),
+      h_ratio_max_(inner_relation.getSPHBody().sph_adaptation_->ReferenceSmoothingLength() /
+                   inner_relation.getSPHBody().sph_adaptation_->MinimumSmoothingLength()),
+      number_of_children_(size_t(1) << Dimensions),
+      indicator_(*particles_->getVariableDataByName<Real>(indicator_name)),
+      h_ratio_(*particles_->getVariableDataByName<Real>("SmoothingLengthRatio")),
+      Vol_(*particles_->getVariableDataByName<Real>("VolumetricMeasure")),
+      mass_(*particles_->getVariableDataByName<Real>("Mass")),
+      pos_(*particles_->getVariableDataByName<Vecd>("Position")),
+      vel_(*particles_->getVariableDataByName<Vecd>("Velocity")),
+      number_of_split_(0), number_of_merged_(0)
+{
+    DynamicCast<ParticleWithLocalRefinement>(this, inner_relation.getSPHBody().sph_adaptation_);
+    if (merge_threshold_ >= split_threshold_)
+    {
+        std::cout << "\n Error: the merge threshold should be smaller than the split threshold!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+    buffer_.checkParticlesReserved();
+}
+//=================================================================================================//
+bool ParticleSplitAndMerge::isSplittable(size_t index_i)
+{
+    return indicator_[index_i] > split_threshold_ && 2.0 * h_ratio_[index_i] < h_ratio_max_ + Eps;
+}
+//=================================================================================================//
+bool ParticleSplitAndMerge::isMergeable(size_t index_i)
+{
+    return indicator_[index_i] < merge_threshold_ &&
+           h_ratio_[index_i] * pow(0.5, 1.0 / Real(Dimensions)) > 1.0 - Eps;
+}
+//=================================================================================================//
+size_t ParticleSplitAndMerge::findMergePartner(size_t index_i)
+{
+    size_t partner = MaxSize_t;
+    Real distance_min = MaxReal;
+    const Neighborhood &inner_neighborhood = inner_configuration_[index_i];
+    for (size_t n = 0; n != inner_neighborhood.current_size_; ++n)
+    {
+        size_t index_j = inner_neighborhood.j_[n];
+        if (index_j < particles_->TotalRealParticles() && isMergeable(index_j) &&
+            ABS(h_ratio_[index_j] - h_ratio_[index_i]) < 0.1 * h_ratio_[index_i] &&
+            inner_neighborhood.r_ij_[n] < distance_min)
+        {
+            distance_min = inner_neighborhood.r_ij_[n];
+            partner = index_j;
+        }
+    }
+    return partner;
+}
+//=================================================================================================//
+void ParticleSplitAndMerge::splitParticle(size_t index_i)
+{
+    Real child_mass = mass_[index_i] / Real(number_of_children_);
+    Real child_volume = Vol_[index_i] / Real(number_of_children_);
+    Real child_h_ratio = 2.0 * h_ratio_[index_i];
+    Real offset = 0.25 * particles_->ParticleSpacing(index_i);
+    Vecd parent_position = pos_[index_i];
+
+    for (size_t c = 0; c != number_of_children_; ++c)
+    {
+        Vecd child_offset = Vecd::Zero();
+        for (int d = 0; d != Dimensions; ++d)
+        {
+            child_offset[d] = (c >> d) & 1 ? offset : -offset;
+        }
+
+        size_t child_index = index_i;
+        if (c != 0)
+        {
+            buffer_.checkEnoughBuffer(*particles_);
+            child_index = particles_->TotalRealParticles();
+            particles_->createRealParticleFrom(index_i);
+        }
+        pos_[child_index] = parent_position + child_offset;
+        mass_[child_index] = child_mass;
+        Vol_[child_index] = child_volume;
+        h_ratio_[child_index] = child_h_ratio;
+    }
+}
+//=================================================================================================//
+void ParticleSplitAndMerge::mergeParticles(size_t index_i, size_t index_j)
+{
+    Real total_mass = mass_[index_i] + mass_[index_j];
+    Real total_volume = Vol_[index_i] + Vol_[index_j];
+    pos_[index_i] = (mass_[index_i] * pos_[index_i] + mass_[index_j] * pos_[index_j]) / total_mass;
+    vel_[index_i] = (mass_[index_i] * vel_[index_i] + mass_[index_j] * vel_[index_j]) / total_mass;
+    h_ratio_[index_i] *= pow(Vol_[index_i] / total_volume, 1.0 / Real(Dimensions));
+    mass_[index_i] = total_mass;
+    Vol_[index_i] = total_volume;
+}
+//=================================================================================================//
+void ParticleSplitAndMerge::exec(Real dt)
+{
+    setupDynamics(dt);
+
+    size_t total_real_particles = particles_->TotalRealParticles();
+    is_splitting_.resize(total_real_particles);
+    merge_partner_.resize(total_real_particles);
+    particle_for(execution::ParallelPolicy(), IndexRange(0, total_real_particles),
+                 [&](size_t i)
+                 {
+                     is_splitting_[i] = isSplittable(i);
+                     merge_partner_[i] = isMergeable(i) ? findMergePartner(i) : MaxSize_t;
+                 });
+
+    /** Only mutually nearest pairs are merged so that each particle merges at most once. */
+    number_of_split_ = 0;
+    merged_particles_.clear();
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        size_t j = merge_partner_[i];
+        if (j != MaxSize_t && i < j && merge_partner_[j] == i)
+        {
+            mergeParticles(i, j);
+            merged_particles_.push_back(j);
+        }
+        else if (is_splitting_[i])
+        {
+            splitParticle(i);
+            number_of_split_++;
+        }
+    }
+
+    /** Deleted in descending order so that the last real particles moved
+     *  into the deleted places are never those to be deleted. */
+    std::sort(merged_particles_.begin(), merged_particles_.end(), std::greater<size_t>());
+    for (size_t j : merged_particles_)
+    {
+        particles_->switchToBufferParticle(j);
+    }
+    number_of_merged_ = merged_particles_.size();
+}
+//=================================================================================================//
+} // namespace SPH
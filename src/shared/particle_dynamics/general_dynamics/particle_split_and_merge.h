@@ -0,0 +1,104 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file    particle_split_and_merge.h
+ * @brief   Solution-adaptive particle refinement by splitting and merging particles at run time.
+ * @details The particles are split where a refinement indicator is larger than a threshold
+ *          and merged where it is smaller than another threshold.
+ *          The smoothing length ratio of the particles follows their volume,
+ *          so that the body should be created with ParticleWithLocalRefinement adaptation,
+ *          which also bounds the levels of splitting and merging.
+ *          The new particles are taken from the reserved buffer particles
+ *          and the merged particles are switched back to buffer.
+ *          Therefore, the cell linked list and the configurations
+ *          should be updated after splitting and merging.
+ * @author  Xiangyu Hu
+ */
+
+#ifndef PARTICLE_SPLIT_AND_MERGE_H
+#define PARTICLE_SPLIT_AND_MERGE_H
+
+#include "adaptation.h"
+#include "base_general_dynamics.h"
+#include "particle_reserve.h"
+
+namespace SPH
+{
+/**
+ * @class RefinementIndicatorByVelocityGradient
+ * @brief The refinement indicator given by the velocity gradient,
+ * non-dimensionalized by the local particle spacing and a reference velocity.
+ * The velocity gradient should be computed by VelocityGradient before.
+ */
+class RefinementIndicatorByVelocityGradient : public LocalDynamics, public DataDelegateSimple
+{
+  public:
+    RefinementIndicatorByVelocityGradient(SPHBody &sph_body, Real reference_velocity);
+    virtual ~RefinementIndicatorByVelocityGradient(){};
+    void update(size_t index_i, Real dt = 0.0);
+
+  protected:
+    Real reference_velocity_;
+    StdLargeVec<Matd> &vel_grad_;
+    StdLargeVec<Real> &indicator_;
+};
+
+/**
+ * @class ParticleSplitAndMerge
+ * @brief Split a particle into 2^Dimensions particles with half spacing
+ * and merge a pair of particles with the same resolution into one.
+ * Mass and volume are conserved and the merged particle is located
+ * at the center of mass with the velocity conserving momentum.
+ * Other particle data of a merged particle are taken from the particle with smaller index.
+ * The decisions are made in parallel and the particles are created and deleted sequentially.
+ */
+class ParticleSplitAndMerge : public LocalDynamics, public DataDelegateInner, public BaseDynamics<void>
+{
+  public:
+    ParticleSplitAndMerge(BaseInnerRelation &inner_relation, ParticleBuffer<Base> &buffer,
+                          const std::string &indicator_name, Real split_threshold, Real merge_threshold);
+    virtual ~ParticleSplitAndMerge(){};
+    virtual void exec(Real dt = 0.0) override;
+    size_t NumberOfSplitParticles() { return number_of_split_; };
+    size_t NumberOfMergedParticles() { return number_of_merged_; };
+
+  protected:
+    ParticleBuffer<Base> &buffer_;
+    Real split_threshold_, merge_threshold_;
+    Real h_ratio_max_;               /**< the ratio of the finest particles */
+    const size_t number_of_children_; /**< 2^Dimensions */
+    StdLargeVec<Real> &indicator_, &h_ratio_, &Vol_, &mass_;
+    StdLargeVec<Vecd> &pos_, &vel_;
+    StdLargeVec<int> is_splitting_; /**< int rather than bool, which is not safe for concurrent writes */
+    StdLargeVec<size_t> merge_partner_;
+    StdVec<size_t> merged_particles_;
+    size_t number_of_split_, number_of_merged_;
+
+    bool isSplittable(size_t index_i);
+    bool isMergeable(size_t index_i);
+    size_t findMergePartner(size_t index_i);
+    void splitParticle(size_t index_i);
+    void mergeParticles(size_t index_i, size_t index_j);
+};
+} // namespace SPH
+#endif // PARTICLE_SPLIT_AND_MERGE_H
@@ -0,0 +1,74 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file    point_probe.h
+ * @brief   Interpolation of a particle variable at arbitrary points on demand.
+ * @details Different from observing with an observer body and a contact relation,
+ *          the probe points are given at the time of probing,
+ *          and the candidate neighbors are found directly
+ *          from the cell linked list of the target body without building neighborhoods.
+ *          Therefore, dense, moving or changing probes are sampled without setup overhead.
+ *          The cell linked list of the target body should be up to date,
+ *          which is the case after the configurations of the body are updated.
+ * @author  Xiangyu Hu
+ */
+
+#ifndef POINT_PROBE_H
+#define POINT_PROBE_H
+
+#include "base_general_dynamics.h"
+
+namespace SPH
+{
+/**
+ * @class PointProbe
+ * @brief Kernel interpolation of a variable of the target body at given points.
+ * Optionally, the kernel weights are corrected for the first-order consistency,
+ * as CorrectInterpolationKernelWeights does for an observer body.
+ * A batch of points is probed in parallel.
+ */
+template <typename DataType>
+class PointProbe
+{
+  public:
+    PointProbe(RealBody &target_body, const std::string &variable_name, bool use_kernel_correction = false);
+    virtual ~PointProbe(){};
+
+    DataType probe(const Vecd &point);
+    void probe(const StdVec<Vecd> &points, StdVec<DataType> &results);
+    StdVec<DataType> probe(const StdVec<Vecd> &points);
+
+  protected:
+    BaseParticles &particles_;
+    CellLinkedList &cell_linked_list_;
+    Kernel &kernel_;
+    bool use_kernel_correction_;
+    StdLargeVec<Real> &Vol_;
+    StdLargeVec<Vecd> &pos_;
+    StdLargeVec<DataType> &data_;
+
+    /** the correction for the kernel weight of a neighbor by W_ij - correction.dot(e_ij) * dW_ij */
+    Vecd computeWeightCorrection(const Vecd &point);
+};
+} // namespace SPH
+#endif // POINT_PROBE_H
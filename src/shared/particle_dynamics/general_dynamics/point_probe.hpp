@@ -0,0 +1,91 @@
+/**
+ * @file    point_probe.hpp
+ * @brief   Implementation of the interpolation at probe points.
+ * @author  Xiangyu Hu
+ */
+
+#pragma once
+
+#include "cell_linked_list.hpp"
+#include "point_probe.h"
+
+namespace SPH
+{
+//=================================================================================================//
+template <typename DataType>
+PointProbe<DataType>::PointProbe(RealBody &target_body, const std::string &variable_name,
+                                 bool use_kernel_correction)
+    : particles_(target_body.getBaseParticles()),
+      cell_linked_list_(*DynamicCast<CellLinkedList>(this, &target_body.getCellLinkedList())),
+      kernel_(*target_body.sph_adaptation_->getKernel()),
+      use_kernel_correction_(use_kernel_correction),
+      Vol_(*particles_.getVariableDataByName<Real>("VolumetricMeasure")),
+      pos_(*particles_.getVariableDataByName<Vecd>("Position")),
+      data_(*particles_.getVariableDataByName<DataType>(variable_name)) {}
+//=================================================================================================//
+template <typename DataType>
+Vecd PointProbe<DataType>::computeWeightCorrection(const Vecd &point)
+{
+    Vecd weight_correction = Vecd::Zero();
+    Matd local_configuration = Eps * Matd::Identity();
+    cell_linked_list_.searchNeighborsByPosition(
+        point, 1,
+        [&](const ListData &list_data)
+        {
+            size_t index_j = list_data.first;
+            Vecd displacement = point - pos_[index_j];
+            if (kernel_.checkIfWithinCutOffRadius(displacement))
+            {
+                Real r_ij = displacement.norm();
+                Vecd e_ij = displacement / (r_ij + TinyReal);
+                Vecd r_ji = -displacement;
+                weight_correction += kernel_.W(r_ij, displacement) * Vol_[index_j] * r_ji;
+                local_configuration += r_ji * (kernel_.dW(r_ij, displacement) * Vol_[index_j] * e_ij).transpose();
+            }
+        });
+    return local_configuration.inverse() * weight_correction;
+}
+//=================================================================================================//
+template <typename DataType>
+DataType PointProbe<DataType>::probe(const Vecd &point)
+{
+    Vecd correction = use_kernel_correction_ ? computeWeightCorrection(point) : Vecd::Zero();
+    DataType probed_quantity = ZeroData<DataType>::value;
+    Real ttl_weight(0);
+    cell_linked_list_.searchNeighborsByPosition(
+        point, 1,
+        [&](const ListData &list_data)
+        {
+            size_t index_j = list_data.first;
+            Vecd displacement = point - pos_[index_j];
+            if (kernel_.checkIfWithinCutOffRadius(displacement))
+            {
+                Real r_ij = displacement.norm();
+                Vecd e_ij = displacement / (r_ij + TinyReal);
+                Real W_ij = kernel_.W(r_ij, displacement) - correction.dot(e_ij) * kernel_.dW(r_ij, displacement);
+                Real weight_j = W_ij * Vol_[index_j];
+                probed_quantity += weight_j * data_[index_j];
+                ttl_weight += weight_j;
+            }
+        });
+    return probed_quantity / (ttl_weight + TinyReal);
+}
+//=================================================================================================//
+template <typename DataType>
+void PointProbe<DataType>::probe(const StdVec<Vecd> &points, StdVec<DataType> &results)
+{
+    results.resize(points.size());
+    particle_for(execution::ParallelPolicy(), IndexRange(0, points.size()),
+                 [&](size_t i)
+                 { results[i] = probe(points[i]); });
+}
+//=================================================================================================//
+template <typename DataType>
+StdVec<DataType> PointProbe<DataType>::probe(const StdVec<Vecd> &points)
+{
+    StdVec<DataType> results;
+    probe(points, results);
+    return results;
+}
+//=================================================================================================//
+} // namespace SPH
@@ -78,6 +78,16 @@ struct has_interaction<T, std::void_t<decltype(&T::interaction)>> : std::true_ty
 {
 };
 
+template <class T, class = void>
+struct has_initialization : std::false_type
+{
+};
+
+template <class T>
+struct has_initialization<T, std::void_t<decltype(&T::initialization)>> : std::true_type
+{
+};
+
 template <class T, class = void>
 struct has_update : std::false_type
 {
@@ -339,5 +349,60 @@ class Dynamics1Level : public InteractionDynamics<LocalDynamicsType, ExecutionPo
                      [&](size_t i) { this->update(i, dt); });
     };
 };
+
+/**
+ * @class ActiveParticleDynamics
+ * @brief Carry out the initialization, interaction and update steps, which the local dynamics has,
+ * only for the particles in a dynamic body part, such as the awake particles given by ActiveParticles.
+ * The local dynamics is constructed as for the other algorithms, i.e. on the whole body,
+ * so that any existing local dynamics can be restricted to the active particles.
+ */
+template <class LocalDynamicsType, class ExecutionPolicy = ParallelPolicy>
+class ActiveParticleDynamics : public BaseInteractionDynamics<LocalDynamicsType, ExecutionPolicy>
+{
+  public:
+    template <typename... Args>
+    ActiveParticleDynamics(BodyPartByParticle &active_particles, Args &&... args)
+        : BaseInteractionDynamics<LocalDynamicsType, ExecutionPolicy>(std::forward<Args>(args)...),
+          active_particles_(active_particles)
+    {
+        if (&active_particles.getSPHBody() != &this->getSPHBody())
+        {
+            std::cout << "\n Error: the active particles are not from the body of the dynamics!" << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+    };
+    virtual ~ActiveParticleDynamics(){};
+
+    virtual void runMainStep(Real dt) override
+    {
+        if constexpr (has_interaction<LocalDynamicsType>::value)
+            particle_for(ExecutionPolicy(),
+                         active_particles_.LoopRange(),
+                         [&](size_t i) { this->interaction(i, dt); });
+    };
+
+    virtual void exec(Real dt = 0.0) override
+    {
+        this->setUpdated();
+        this->setupDynamics(dt);
+
+        if constexpr (has_initialization<LocalDynamicsType>::value)
+            particle_for(ExecutionPolicy(),
+                         active_particles_.LoopRange(),
+                         [&](size_t i) { this->initialization(i, dt); });
+
+        this->runInteraction(dt);
+
+        if constexpr (has_update<LocalDynamicsType>::value)
+            particle_for(ExecutionPolicy(),
+                         active_particles_.LoopRange(),
+                         [&](size_t i) { this->update(i, dt); });
+    };
+
+  protected:
+    BodyPartByParticle &active_particles_;
+};
 } // namespace SPH
 #endif // PARTICLE_DYNAMICS_ALGORITHMS_H
@@ -282,7 +282,7 @@ struct ReduceLowerBound
 
 struct ReduceUpperBound
 {
-    Vecd reference_ = MinReal * Vecd::Ones();
+    Vecd reference_ = -MaxReal * Vecd::Ones();
     Vecd operator()(const Vecd &x, const Vecd &y) const
     {
         Vecd upper_bound;
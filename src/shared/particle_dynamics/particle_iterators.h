@@ -30,6 +30,7 @@
 #define PARTICLE_ITERATORS_H
 
 #include "base_data_package.h"
+#include "device_execution.h"
 #include "execution_policy.h"
 #include "sph_data_containers.h"
 
@@ -73,6 +74,24 @@ inline void particle_for(const ParallelPolicy &par, const IndexRange &particles_
         },
         ap);
 };
+
+/** The function is copied to the device, so that it should capture device data by value. */
+template <class LocalDynamicsFunction>
+inline void particle_for(const ParallelDevicePolicy &par_device, const IndexRange &particles_range,
+                         const LocalDynamicsFunction &local_dynamics_function)
+{
+#if SPHINXSYS_USE_SYCL
+    size_t begin = particles_range.begin();
+    execution::ExecutionQueue::getInstance()
+        .getQueue()
+        .parallel_for(sycl::range<1>(particles_range.size()),
+                      [=](sycl::item<1> item)
+                      { local_dynamics_function(begin + item.get_id(0)); })
+        .wait_and_throw();
+#else
+    particle_for(ParallelPolicy(), particles_range, local_dynamics_function);
+#endif
+};
 /**
  * Bodypart By Particle-wise iterators (for sequential and parallel computing).
  */
@@ -286,6 +305,34 @@ inline ReturnType particle_reduce(const ParallelPolicy &par, const IndexRange &p
             return operation(x, y);
         });
 };
+
+/** The function and the operation are copied to the device, so that they should capture device data by value. */
+template <class ReturnType, typename Operation, class LocalDynamicsFunction>
+inline ReturnType particle_reduce(const ParallelDevicePolicy &par_device, const IndexRange &particles_range,
+                                  ReturnType temp, Operation &&operation,
+                                  const LocalDynamicsFunction &local_dynamics_function)
+{
+#if SPHINXSYS_USE_SYCL
+    sycl::queue &sycl_queue = execution::ExecutionQueue::getInstance().getQueue();
+    ReturnType *result = sycl::malloc_shared<ReturnType>(1, sycl_queue);
+    *result = temp;
+    size_t begin = particles_range.begin();
+    std::decay_t<Operation> device_operation = operation;
+    sycl_queue
+        .submit([&](sycl::handler &cgh)
+                { cgh.parallel_for(sycl::range<1>(particles_range.size()),
+                                   sycl::reduction(result, temp, device_operation),
+                                   [=](sycl::item<1> item, auto &reduction)
+                                   { reduction.combine(local_dynamics_function(begin + item.get_id(0))); }); })
+        .wait_and_throw();
+    ReturnType reduced_value = *result;
+    sycl::free(result, sycl_queue);
+    return reduced_value;
+#else
+    return particle_reduce(ParallelPolicy(), particles_range, temp, std::forward<Operation>(operation),
+                           local_dynamics_function);
+#endif
+};
 /**
  * BodypartByParticle-wise reduce iterators (for sequential and parallel computing).
  */
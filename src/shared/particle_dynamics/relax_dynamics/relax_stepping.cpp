@@ -66,6 +66,17 @@ Real RelaxationScaling::outputResult(Real reduced_value)
     return 0.0625 * h_ref_ / (reduced_value + TinyReal);
 }
 //=================================================================================================//
+RelaxationResidueNorm::RelaxationResidueNorm(SPHBody &sph_body)
+    : LocalDynamicsReduce<ReduceSum<Real>>(sph_body),
+      DataDelegateSimple(sph_body),
+      residue_(*particles_->getVariableDataByName<Vecd>("ZeroOrderResidue")),
+      h_ref_(sph_body.sph_adaptation_->ReferenceSmoothingLength()) {}
+//=================================================================================================//
+Real RelaxationResidueNorm::reduce(size_t index_i, Real dt)
+{
+    return residue_[index_i].norm() * h_ref_;
+}
+//=================================================================================================//
 PositionRelaxation::PositionRelaxation(SPHBody &sph_body)
     : LocalDynamics(sph_body), DataDelegateSimple(sph_body),
       sph_adaptation_(sph_body.sph_adaptation_),
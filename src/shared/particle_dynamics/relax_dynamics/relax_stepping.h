@@ -128,6 +128,24 @@ class RelaxationScaling : public LocalDynamicsReduce<ReduceMax>,
     Real h_ref_;
 };
 
+/**
+ * @class RelaxationResidueNorm
+ * @brief Dimensionless magnitude of the zero-order residue of a particle.
+ * Used with Average<> to monitor the convergence of the relaxation.
+ */
+class RelaxationResidueNorm : public LocalDynamicsReduce<ReduceSum<Real>>,
+                              public DataDelegateSimple
+{
+  public:
+    explicit RelaxationResidueNorm(SPHBody &sph_body);
+    virtual ~RelaxationResidueNorm(){};
+    Real reduce(size_t index_i, Real dt = 0.0);
+
+  protected:
+    StdLargeVec<Vecd> &residue_;
+    Real h_ref_;
+};
+
 /**
  * @class PositionRelaxation
  * @brief update the particle position for a relaxation step
@@ -182,6 +200,52 @@ class RelaxationStep : public BaseDynamics<void>
     SimpleDynamics<ShapeSurfaceBounding> surface_bounding_;
 };
 
+/**
+ * @class RelaxationUntilConvergence
+ * @brief Drive a relaxation step until the average residue is small or stops decreasing,
+ * instead of running a fixed number of iterations.
+ * @details The averaged residue norm is evaluated every check interval.
+ * The relaxation has converged when the norm is below the absolute tolerance.
+ * It has stagnated when the relative change of the norm between two checks
+ * is below the relative tolerance, which also happens if the residue levels off
+ * at a value that is not small, e.g. for a resolution too coarse for the shape.
+ * Otherwise it terminates at the maximum iteration number.
+ * An absolute tolerance of zero, the default, stops on stagnation only.
+ * Combined with the Split particle generator, a coarse-to-fine relaxation is obtained:
+ * a coarse body (e.g. defineAdaptationRatios(1.15, 0.5)) is relaxed first,
+ * the target body is then generated by generateParticles<BaseParticles, Split>(coarse_body),
+ * so that only a few fine-level iterations are required for convergence.
+ * If the body particles are generated with the Cached generator, the relaxation is skipped
+ * when they are loaded from the cache and were relaxed with the same step type and
+ * convergence criteria, otherwise the relaxed particles are written to the cache.
+ */
+template <class RelaxationStepType>
+class RelaxationUntilConvergence : public BaseDynamics<size_t>
+{
+  public:
+    template <typename FirstArg, typename... OtherArgs>
+    explicit RelaxationUntilConvergence(FirstArg &&first_arg, OtherArgs &&...other_args);
+    virtual ~RelaxationUntilConvergence(){};
+    RelaxationStepType &getRelaxationStep() { return relaxation_step_; };
+    void setConvergenceCriteria(Real relative_tolerance, size_t check_interval,
+                                size_t max_iterations, Real absolute_tolerance = 0.0);
+    Real ResidueNorm() { return residue_norm_; };
+    /** whether the last relaxation reached the absolute tolerance */
+    bool isConverged() { return is_converged_; };
+    virtual size_t exec(Real dt = 0.0) override;
+
+  protected:
+    RealBody &real_body_;
+    RelaxationStepType relaxation_step_;
+    ReduceDynamics<Average<RelaxationResidueNorm>> relaxation_residue_norm_;
+    Real relative_tolerance_;
+    Real absolute_tolerance_;
+    size_t check_interval_;
+    size_t max_iterations_;
+    Real residue_norm_;
+    bool is_converged_;
+};
+
 using RelaxationStepInner = RelaxationStep<RelaxationResidue<Inner<>>>;
 using RelaxationStepLevelSetCorrectionInner = RelaxationStep<RelaxationResidue<Inner<LevelSetCorrection>>>;
 using RelaxationStepComplex = RelaxationStep<ComplexInteraction<RelaxationResidue<Inner<>, Contact<>>>>;
@@ -1,8 +1,11 @@
 #ifndef RELAX_STEPPING_HPP
 #define RELAX_STEPPING_HPP
 
+#include "data_hash.h"
 #include "relax_stepping.h"
 
+#include <typeinfo>
+
 namespace SPH
 {
 namespace relax_dynamics
@@ -48,6 +51,77 @@ void RelaxationStep<RelaxationResidueType>::exec(Real dt)
     surface_bounding_.exec();
 }
 //=================================================================================================//
+template <class RelaxationStepType>
+template <typename FirstArg, typename... OtherArgs>
+RelaxationUntilConvergence<RelaxationStepType>::
+    RelaxationUntilConvergence(FirstArg &&first_arg, OtherArgs &&...other_args)
+    : BaseDynamics<size_t>(first_arg.getSPHBody()),
+      real_body_(DynamicCast<RealBody>(this, first_arg.getSPHBody())),
+      relaxation_step_(first_arg, std::forward<OtherArgs>(other_args)...),
+      relaxation_residue_norm_(real_body_), relative_tolerance_(0.01), absolute_tolerance_(0.0),
+      check_interval_(50), max_iterations_(2000), residue_norm_(MaxReal), is_converged_(false) {}
+//=================================================================================================//
+template <class RelaxationStepType>
+void RelaxationUntilConvergence<RelaxationStepType>::
+    setConvergenceCriteria(Real relative_tolerance, size_t check_interval,
+                           size_t max_iterations, Real absolute_tolerance)
+{
+    relative_tolerance_ = relative_tolerance;
+    absolute_tolerance_ = absolute_tolerance;
+    check_interval_ = SMAX(check_interval, size_t(1));
+    max_iterations_ = max_iterations;
+}
+//=================================================================================================//
+template <class RelaxationStepType>
+size_t RelaxationUntilConvergence<RelaxationStepType>::exec(Real dt)
+{
+    DataHash relaxation_hash;
+    relaxation_hash.add(std::string(typeid(RelaxationStepType).name()));
+    relaxation_hash.add(relative_tolerance_).add(absolute_tolerance_).add(check_interval_).add(max_iterations_);
+    ParticleRelaxationCache *relaxation_cache = real_body_.getRelaxationCache();
+    if (relaxation_cache != nullptr && relaxation_cache->isRelaxedBy(relaxation_hash.Value()))
+    {
+        std::cout << "Relaxation of " << real_body_.getName() << " is skipped as the particles are cached." << std::endl;
+        return 0;
+    }
+    if (relaxation_cache != nullptr && relaxation_cache->isLoaded())
+    {
+        std::cout << "Cached particles of " << real_body_.getName()
+                  << " were relaxed differently and are relaxed again." << std::endl;
+    }
+
+    TickCount t1 = TickCount::now();
+    Real previous_norm = MaxReal;
+    is_converged_ = false;
+    size_t ite = 0;
+    while (ite < max_iterations_)
+    {
+        relaxation_step_.exec();
+        ite++;
+        if (ite % check_interval_ == 0)
+        {
+            residue_norm_ = relaxation_residue_norm_.exec();
+            std::cout << std::fixed << std::setprecision(9) << "Relaxation steps for "
+                      << real_body_.getName() << " N = " << ite
+                      << " averaged residue = " << residue_norm_ << "\n";
+            is_converged_ = residue_norm_ < absolute_tolerance_;
+            if (is_converged_ || ABS(previous_norm - residue_norm_) < relative_tolerance_ * previous_norm)
+                break;
+            previous_norm = residue_norm_;
+        }
+    }
+    TimeInterval tt = TickCount::now() - t1;
+    std::string termination = is_converged_ ? "converged" : (ite < max_iterations_ ? "stagnated" : "stopped");
+    std::cout << "Relaxation of " << real_body_.getName() << " " << termination << " after "
+              << ite << " iterations in " << tt.seconds() << " seconds." << std::endl;
+
+    if (relaxation_cache != nullptr)
+    {
+        relaxation_cache->writeParticleData(relaxation_hash.Value());
+    }
+    return ite;
+}
+//=================================================================================================//
 } // namespace relax_dynamics
 } // namespace SPH
 #endif // RELAX_STEPPING_HPP
@@ -180,6 +180,9 @@ class ConstrainSolidBodyMassCenter : public MotionConstraint<SPHBody>
 /**
  * @class ConstraintBySimBody
  * @brief Constrain by the motion computed from Simbody.
+ * @details The rigid motion of the mobilized body is extracted once per step in setupDynamics,
+ * so that the particle update is evaluated with Eigen only, without calling Simbody per particle.
+ * The kinematics follows findStationLocationVelocityAndAccelerationInGround of Simbody.
  */
 template <class DynamicsIdentifier>
 class ConstraintBySimBody : public MotionConstraint<DynamicsIdentifier>
@@ -198,6 +201,8 @@ class ConstraintBySimBody : public MotionConstraint<DynamicsIdentifier>
         simbody_state_ = &integ_.getState();
         MBsystem_.realize(*simbody_state_, SimTK::Stage::Acceleration);
         initial_mobod_origin_location_ = mobod_.getBodyOriginLocation(*simbody_state_);
+        initial_origin_location_ = SimTKToEigen(initial_mobod_origin_location_);
+        setupDynamics();
     };
     virtual ~ConstraintBySimBody(){};
 
@@ -205,25 +210,23 @@ class ConstraintBySimBody : public MotionConstraint<DynamicsIdentifier>
     {
         simbody_state_ = &integ_.getState();
         MBsystem_.realize(*simbody_state_, SimTK::Stage::Acceleration);
+        rotation_ = SimTKToEigen(static_cast<const SimTKMat33 &>(mobod_.getBodyRotation(*simbody_state_)));
+        origin_location_ = SimTKToEigen(mobod_.getBodyOriginLocation(*simbody_state_));
+        origin_velocity_ = SimTKToEigen(mobod_.getBodyOriginVelocity(*simbody_state_));
+        origin_acceleration_ = SimTKToEigen(mobod_.getBodyOriginAcceleration(*simbody_state_));
+        angular_velocity_ = SimTKToEigen(mobod_.getBodyAngularVelocity(*simbody_state_));
+        angular_acceleration_ = SimTKToEigen(mobod_.getBodyAngularAcceleration(*simbody_state_));
     };
     void update(size_t index_i, Real dt = 0.0)
     {
-        /** Change to SimTK::Vector. */
-        SimTKVec3 rr, pos, vel, acc;
-        rr = EigenToSimTK(upgradeToVec3d(this->pos0_[index_i])) - initial_mobod_origin_location_;
-        mobod_.findStationLocationVelocityAndAccelerationInGround(*simbody_state_, rr, pos, vel, acc);
-        /** this is how we calculate the particle position in after transform of MBbody.
-         * const SimTK::Rotation&  R_GB = mobod_.getBodyRotation(simbody_state);
-         * const SimTKVec3&      p_GB = mobod_.getBodyOriginLocation(simbody_state);
-         * const SimTKVec3 r = R_GB * rr; // re-express station vector p_BS in G (15 flops)
-         * base_particle_data_i.pos_  = (p_GB + r);
-         */
-        this->pos_[index_i] = degradeToVecd(SimTKToEigen(pos));
-        this->vel_[index_i] = degradeToVecd(SimTKToEigen(vel));
-        acc_[index_i] = degradeToVecd(SimTKToEigen(acc));
-
-        SimTKVec3 n = (mobod_.getBodyRotation(*simbody_state_) * EigenToSimTK(upgradeToVec3d(n0_[index_i])));
-        n_[index_i] = degradeToVecd(SimTKToEigen(n));
+        /** station vector re-expressed in ground */
+        Vec3d r = rotation_ * (upgradeToVec3d(this->pos0_[index_i]) - initial_origin_location_);
+        Vec3d angular_velocity_cross_r = angular_velocity_.cross(r);
+        this->pos_[index_i] = degradeToVecd(origin_location_ + r);
+        this->vel_[index_i] = degradeToVecd(origin_velocity_ + angular_velocity_cross_r);
+        acc_[index_i] = degradeToVecd(origin_acceleration_ + angular_acceleration_.cross(r) +
+                                      angular_velocity_.cross(angular_velocity_cross_r));
+        n_[index_i] = degradeToVecd(rotation_ * upgradeToVec3d(n0_[index_i]));
     };
 
   protected:
@@ -233,6 +236,10 @@ class ConstraintBySimBody : public MotionConstraint<DynamicsIdentifier>
     StdLargeVec<Vecd> &n_, &n0_, &acc_;
     const SimTK::State *simbody_state_;
     SimTKVec3 initial_mobod_origin_location_;
+    Vec3d initial_origin_location_;
+    Mat3d rotation_;
+    Vec3d origin_location_, origin_velocity_, origin_acceleration_;
+    Vec3d angular_velocity_, angular_acceleration_;
 };
 using ConstraintBodyBySimBody = ConstraintBySimBody<SPHBody>;
 using ConstraintBodyPartBySimBody = ConstraintBySimBody<BodyPartByParticle>;
@@ -241,6 +248,8 @@ using ConstraintBodyPartBySimBody = ConstraintBySimBody<BodyPartByParticle>;
  * @class TotalForceForSimBody
  * @brief Compute the force acting on the solid body part
  * for applying to simbody forces latter
+ * @details Force and torque are summed together in one reduction with Eigen types,
+ * and converted to a Simbody spatial vector per particle only for the reduction.
  */
 template <class DynamicsIdentifier>
 class TotalForceForSimBody
@@ -253,6 +262,7 @@ class TotalForceForSimBody
     SimTK::MobilizedBody &mobod_;
     SimTK::RungeKuttaMersonIntegrator &integ_;
     SimTKVec3 current_mobod_origin_location_;
+    Vec3d current_origin_location_;
 
   public:
     TotalForceForSimBody(DynamicsIdentifier &identifier,
@@ -276,16 +286,15 @@ class TotalForceForSimBody
         const SimTK::State *simbody_state = &integ_.getState();
         MBsystem_.realize(*simbody_state, SimTK::Stage::Acceleration);
         current_mobod_origin_location_ = mobod_.getBodyOriginLocation(*simbody_state);
+        current_origin_location_ = SimTKToEigen(current_mobod_origin_location_);
     };
 
     SimTK::SpatialVec reduce(size_t index_i, Real dt = 0.0)
     {
         Vecd force = force_[index_i] + force_prior_[index_i];
-        SimTKVec3 force_from_particle = EigenToSimTK(upgradeToVec3d(force));
-        SimTKVec3 displacement = EigenToSimTK(upgradeToVec3d(pos_[index_i])) - current_mobod_origin_location_;
-        SimTKVec3 torque_from_particle = SimTK::cross(displacement, force_from_particle);
-
-        return SimTK::SpatialVec(torque_from_particle, force_from_particle);
+        Vec3d force_from_particle = upgradeToVec3d(force);
+        Vec3d torque_from_particle = (upgradeToVec3d(pos_[index_i]) - current_origin_location_).cross(force_from_particle);
+        return SimTK::SpatialVec(EigenToSimTK(torque_from_particle), EigenToSimTK(force_from_particle));
     };
 };
 using TotalForceOnBodyForSimBody = TotalForceForSimBody<SPHBody>;
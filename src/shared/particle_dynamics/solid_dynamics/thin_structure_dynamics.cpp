@@ -132,6 +132,93 @@ ShellStressRelaxationFirstHalf::
         gaussian_point_ = three_gaussian_points_;
         gaussian_weight_ = three_gaussian_weights_;
     }
+
+    switch (number_of_gaussian_points)
+    {
+    case 1:
+        integrate_through_thickness_ = chooseThroughThicknessIntegration<1>();
+        break;
+    case 5:
+        integrate_through_thickness_ = chooseThroughThicknessIntegration<5>();
+        break;
+    default:
+        integrate_through_thickness_ = chooseThroughThicknessIntegration<3>();
+    }
+}
+//=================================================================================================//
+template <int NumberOfGaussianPoints>
+ShellStressRelaxationFirstHalf::ThroughThicknessIntegration
+ShellStressRelaxationFirstHalf::chooseThroughThicknessIntegration()
+{
+    /** Only the exact linear elastic material, not its derived ones, is evaluated without virtual call. */
+    return typeid(elastic_solid_) == typeid(LinearElasticSolid)
+               ? &ShellStressRelaxationFirstHalf::integrateThroughThickness<NumberOfGaussianPoints, true>
+               : &ShellStressRelaxationFirstHalf::integrateThroughThickness<NumberOfGaussianPoints, false>;
+}
+//=================================================================================================//
+template <int NumberOfGaussianPoints, bool IsLinearElastic>
+void ShellStressRelaxationFirstHalf::
+    integrateThroughThickness(size_t index_i, const Matd &transformation_matrix_0_to_current,
+                              Matd &resultant_stress, Matd &resultant_moment, Vecd &resultant_shear_stress)
+{
+    const Matd &F = F_[index_i];
+    const Matd &F_bending = F_bending_[index_i];
+    const Matd &dF_dt = dF_dt_[index_i];
+    const Matd &dF_bending_dt = dF_bending_dt_[index_i];
+    const Real thickness = thickness_[index_i];
+    const Matd transformation_matrix_0_to_current_transpose = transformation_matrix_0_to_current.transpose();
+    Matd numerical_damping_scaling_matrix = numerical_damping_scaling_matrix_;
+
+    for (int i = 0; i != NumberOfGaussianPoints; ++i)
+    {
+        Matd F_gaussian_point = F + gaussian_point_[i] * F_bending * thickness * 0.5;
+        Matd dF_gaussian_point_dt = dF_dt + gaussian_point_[i] * dF_bending_dt * thickness * 0.5;
+        Matd inverse_F_gaussian_point = F_gaussian_point.inverse();
+        Matd current_local_almansi_strain = transformation_matrix_0_to_current * 0.5 *
+                                            (Matd::Identity() - inverse_F_gaussian_point.transpose() * inverse_F_gaussian_point) *
+                                            transformation_matrix_0_to_current_transpose;
+
+        /** correct Almansi strain tensor according to plane stress problem. */
+        current_local_almansi_strain = getCorrectedAlmansiStrain(current_local_almansi_strain, nu_);
+
+        /** correct out-plane numerical damping. */
+        numerical_damping_scaling_matrix(Dimensions - 1, Dimensions - 1) = thickness_[i] < smoothing_length_ ? thickness_[i] : smoothing_length_;
+        Matd elastic_cauchy_stress;
+        if constexpr (IsLinearElastic)
+        {
+            elastic_cauchy_stress = static_cast<LinearElasticSolid &>(elastic_solid_)
+                                        .LinearElasticSolid::StressCauchy(current_local_almansi_strain, index_i);
+        }
+        else
+        {
+            elastic_cauchy_stress = elastic_solid_.StressCauchy(current_local_almansi_strain, index_i);
+        }
+        Matd cauchy_stress = elastic_cauchy_stress +
+                             transformation_matrix_0_to_current * F_gaussian_point *
+                                 elastic_solid_.NumericalDampingRightCauchy(F_gaussian_point, dF_gaussian_point_dt, numerical_damping_scaling_matrix, index_i) *
+                                 F_gaussian_point.transpose() * transformation_matrix_0_to_current_transpose / F_gaussian_point.determinant();
+
+        /** Impose modeling assumptions. */
+        cauchy_stress.col(Dimensions - 1) *= shear_correction_factor_;
+        cauchy_stress.row(Dimensions - 1) *= shear_correction_factor_;
+        cauchy_stress(Dimensions - 1, Dimensions - 1) = 0.0;
+
+        if (i == 0)
+        {
+            mid_surface_cauchy_stress_[index_i] = cauchy_stress;
+        }
+
+        /** Integrate Cauchy stress along thickness. */
+        resultant_stress +=
+            0.5 * thickness * gaussian_weight_[i] * cauchy_stress;
+        resultant_moment +=
+            0.5 * thickness * gaussian_weight_[i] * (cauchy_stress * gaussian_point_[i] * thickness * 0.5);
+        resultant_shear_stress -=
+            0.5 * thickness * gaussian_weight_[i] * cauchy_stress.col(Dimensions - 1);
+    }
+
+    resultant_stress.col(Dimensions - 1) = Vecd::Zero();
+    resultant_moment.col(Dimensions - 1) = Vecd::Zero();
 }
 //=================================================================================================//
 void ShellStressRelaxationFirstHalf::initialization(size_t index_i, Real dt)
@@ -163,46 +250,8 @@ void ShellStressRelaxationFirstHalf::initialization(size_t index_i, Real dt)
     Matd resultant_moment = Matd::Zero();
     Vecd resultant_shear_stress = Vecd::Zero();
 
-    for (int i = 0; i != number_of_gaussian_points_; ++i)
-    {
-        Matd F_gaussian_point = F_[index_i] + gaussian_point_[i] * F_bending_[index_i] * thickness_[index_i] * 0.5;
-        Matd dF_gaussian_point_dt = dF_dt_[index_i] + gaussian_point_[i] * dF_bending_dt_[index_i] * thickness_[index_i] * 0.5;
-        Matd inverse_F_gaussian_point = F_gaussian_point.inverse();
-        Matd current_local_almansi_strain = transformation_matrix_0_to_current * 0.5 *
-                                            (Matd::Identity() - inverse_F_gaussian_point.transpose() * inverse_F_gaussian_point) *
-                                            transformation_matrix_0_to_current.transpose();
-
-        /** correct Almansi strain tensor according to plane stress problem. */
-        current_local_almansi_strain = getCorrectedAlmansiStrain(current_local_almansi_strain, nu_);
-
-        /** correct out-plane numerical damping. */
-        numerical_damping_scaling_matrix_(Dimensions - 1, Dimensions - 1) = thickness_[i] < smoothing_length_ ? thickness_[i] : smoothing_length_;
-        Matd cauchy_stress = elastic_solid_.StressCauchy(current_local_almansi_strain, index_i) +
-                             transformation_matrix_0_to_current * F_gaussian_point *
-                                 elastic_solid_.NumericalDampingRightCauchy(F_gaussian_point, dF_gaussian_point_dt, numerical_damping_scaling_matrix_, index_i) *
-                                 F_gaussian_point.transpose() * transformation_matrix_0_to_current.transpose() / F_gaussian_point.determinant();
-
-        /** Impose modeling assumptions. */
-        cauchy_stress.col(Dimensions - 1) *= shear_correction_factor_;
-        cauchy_stress.row(Dimensions - 1) *= shear_correction_factor_;
-        cauchy_stress(Dimensions - 1, Dimensions - 1) = 0.0;
-
-        if (i == 0)
-        {
-            mid_surface_cauchy_stress_[index_i] = cauchy_stress;
-        }
-
-        /** Integrate Cauchy stress along thickness. */
-        resultant_stress +=
-            0.5 * thickness_[index_i] * gaussian_weight_[i] * cauchy_stress;
-        resultant_moment +=
-            0.5 * thickness_[index_i] * gaussian_weight_[i] * (cauchy_stress * gaussian_point_[i] * thickness_[index_i] * 0.5);
-        resultant_shear_stress -=
-            0.5 * thickness_[index_i] * gaussian_weight_[i] * cauchy_stress.col(Dimensions - 1);
-
-        resultant_stress.col(Dimensions - 1) = Vecd::Zero();
-        resultant_moment.col(Dimensions - 1) = Vecd::Zero();
-    }
+    (this->*integrate_through_thickness_)(index_i, transformation_matrix_0_to_current,
+                                           resultant_stress, resultant_moment, resultant_shear_stress);
 
     /** stress and moment in global coordinates for pair interaction */
     global_stress_[index_i] = J * current_transformation_matrix.transpose() *
@@ -188,6 +188,17 @@ class ShellStressRelaxationFirstHalf : public BaseShellRelaxation
     void initialization(size_t index_i, Real dt = 0.0);
 
     inline void interaction(size_t index_i, Real dt = 0.0)
+    {
+        hourglass_control_ ? interactionWithHourglassControl<true>(index_i, dt)
+                           : interactionWithHourglassControl<false>(index_i, dt);
+    };
+
+    void update(size_t index_i, Real dt = 0.0);
+
+  protected:
+    /** the hourglass control is decided at compile time out of the neighbor loop */
+    template <bool HourglassControl>
+    inline void interactionWithHourglassControl(size_t index_i, Real dt)
     {
         const Vecd &global_shear_stress_i = global_shear_stress_[index_i];
         const Matd &global_stress_i = global_stress_[index_i];
@@ -200,7 +211,7 @@ class ShellStressRelaxationFirstHalf : public BaseShellRelaxation
         {
             size_t index_j = inner_neighborhood.j_[n];
 
-            if (hourglass_control_)
+            if constexpr (HourglassControl)
             {
                 Vecd e_ij = inner_neighborhood.e_ij_[n];
                 Real r_ij = inner_neighborhood.r_ij_[n];
@@ -231,9 +242,6 @@ class ShellStressRelaxationFirstHalf : public BaseShellRelaxation
         dangular_vel_dt_[index_i] = getRotationFromPseudoNormal(local_dpseudo_n_d2t, rotation_[index_i], angular_vel_[index_i], dt);
     };
 
-    void update(size_t index_i, Real dt = 0.0);
-
-  protected:
     ElasticSolid &elastic_solid_;
     Real rho0_, inv_rho0_;
     Real smoothing_length_;
@@ -256,6 +264,16 @@ class ShellStressRelaxationFirstHalf : public BaseShellRelaxation
     int number_of_gaussian_points_;
     StdVec<Real> gaussian_point_;
     StdVec<Real> gaussian_weight_;
+
+    using ThroughThicknessIntegration = void (ShellStressRelaxationFirstHalf::*)(size_t, const Matd &, Matd &, Matd &, Vecd &);
+    /** chosen at construction by the number of Gaussian points and whether the material is linear elastic */
+    ThroughThicknessIntegration integrate_through_thickness_;
+    /** integrate the Cauchy stress at all Gaussian points along the thickness of a particle */
+    template <int NumberOfGaussianPoints, bool IsLinearElastic>
+    void integrateThroughThickness(size_t index_i, const Matd &transformation_matrix_0_to_current,
+                                   Matd &resultant_stress, Matd &resultant_moment, Vecd &resultant_shear_stress);
+    template <int NumberOfGaussianPoints>
+    ThroughThicknessIntegration chooseThroughThicknessIntegration();
 };
 
 /**
@@ -0,0 +1,92 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file particle_generator_cached.h
+ * @brief Particle generator reusing relaxed particles cached by previous runs.
+ * @details The cache is looked up before the wrapped generating method is used.
+ * When the cache is missed, the particles are generated as usual and
+ * the relaxation driver writes the relaxed particles to the cache.
+ * The wrapped generating method and its arguments are part of the cache key:
+ * shapes by their geometry hash, bodies, e.g. the coarse body for splitting,
+ * by their present particles and arithmetic values by their values.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef PARTICLE_GENERATOR_CACHED_H
+#define PARTICLE_GENERATOR_CACHED_H
+
+#include "base_body.h"
+#include "base_particle_generator.h"
+#include "data_hash.h"
+
+#include <typeinfo>
+
+namespace SPH
+{
+template <typename... Parameters> // generate particles from relaxation cache or by the given generating method
+class ParticleGenerator<BaseParticles, Cached, Parameters...>
+    : public ParticleGenerator<BaseParticles, Parameters...>
+{
+  public:
+    template <typename... Args>
+    ParticleGenerator(SPHBody &sph_body, BaseParticles &base_particles,
+                      const std::string &relaxation_method, Args &&...args)
+        : ParticleGenerator<BaseParticles, Parameters...>(sph_body, base_particles, std::forward<Args>(args)...),
+          relaxation_cache_(*sph_body.defineRelaxationCache(relaxation_method, generatorHash(args...))){};
+    virtual ~ParticleGenerator(){};
+
+    virtual void prepareGeometricData() override
+    {
+        if (!relaxation_cache_.readParticleData(this->position_, this->volumetric_measure_))
+        {
+            ParticleGenerator<BaseParticles, Parameters...>::prepareGeometricData();
+        }
+    };
+
+  protected:
+    ParticleRelaxationCache &relaxation_cache_;
+
+    template <typename... Args>
+    static uint64_t generatorHash(Args &...args)
+    {
+        DataHash generator_hash;
+        generator_hash.add(std::string(typeid(ParticleGenerator<BaseParticles, Parameters...>).name()));
+        (addGeneratorArgument(generator_hash, args), ...);
+        return generator_hash.Value();
+    };
+
+    template <typename DataType>
+    static void addGeneratorArgument(DataHash &generator_hash, DataType &argument)
+    {
+        if constexpr (std::is_base_of_v<Shape, DataType>)
+            generator_hash.add(argument.getGeometryHash());
+        else if constexpr (std::is_base_of_v<SPHBody, DataType>)
+            generator_hash.add(ParticleRelaxationCache::ParticleDataHash(argument));
+        else if constexpr (std::is_arithmetic_v<DataType>)
+            generator_hash.add(argument);
+        else
+            generator_hash.add(std::string(typeid(DataType).name()));
+    };
+};
+} // namespace SPH
+#endif // PARTICLE_GENERATOR_CACHED_H
@@ -2,6 +2,7 @@
 
 #include "adaptation.h"
 #include "base_body.h"
+#include "base_mesh.h"
 #include "complex_shape.h"
 
 namespace SPH
@@ -25,6 +26,75 @@ ParticleGenerator<BaseParticles, Lattice>::
     : ParticleGenerator<BaseParticles>(sph_body, base_particles),
       GeneratingMethod<Lattice>(sph_body) {}
 //=================================================================================================//
+void ParticleGenerator<BaseParticles, Lattice>::prepareGeometricData()
+{
+    BaseMesh mesh(domain_bounds_, lattice_spacing_, 0);
+    Real particle_volume = pow(lattice_spacing_, Dimensions);
+    Arrayi number_of_lattices = mesh.AllCellsFromAllGridPoints(mesh.AllGridPoints());
+
+    // Classify blocks of lattice points as outside (0), inside (1) or cut (2) by the shape surface
+    // from the signed distance at the block center, which is not larger than the true distance.
+    const int block_size = 8;
+    Arrayi number_of_blocks = (number_of_lattices + (block_size - 1) * Arrayi::Ones()) / block_size;
+    Real block_radius = 0.5 * sqrt(Real(Dimensions)) * Real(block_size - 1) * lattice_spacing_;
+    Real classify_threshold = block_radius + lattice_spacing_;
+    StdVec<Vecd> block_centers(number_of_blocks.prod());
+    for (size_t l = 0; l != block_centers.size(); ++l)
+    {
+        Arrayi first_lattice = mesh.transfer1DtoMeshIndex(number_of_blocks, l) * block_size;
+        Arrayi last_lattice = (first_lattice + (block_size - 1) * Arrayi::Ones()).min(number_of_lattices - Arrayi::Ones());
+        block_centers[l] = 0.5 * (mesh.CellPositionFromIndex(first_lattice) + mesh.CellPositionFromIndex(last_lattice));
+    }
+    StdVec<Real> block_signed_distances;
+    initial_shape_.findSignedDistances(block_centers, block_signed_distances);
+    StdVec<int> block_categories(block_centers.size());
+    for (size_t l = 0; l != block_centers.size(); ++l)
+    {
+        Real signed_distance = block_signed_distances[l];
+        block_categories[l] = signed_distance > classify_threshold ? 0 : (signed_distance < -classify_threshold ? 1 : 2);
+    }
+
+    // Interior blocks are filled without tests, only the lattice points in cut blocks are tested.
+    // Positions are collected slice by slice in parallel and in the lexicographic lattice order.
+    size_t number_of_slices = number_of_lattices[0];
+    size_t slice_size = number_of_slices == 0 ? 0 : size_t(number_of_lattices.prod()) / number_of_slices;
+    StdVec<StdVec<Vecd>> slice_positions(number_of_slices);
+    parallel_for(
+        IndexRange(0, number_of_slices),
+        [&](const IndexRange &r)
+        {
+            for (size_t slice = r.begin(); slice != r.end(); ++slice)
+            {
+                for (size_t l = slice * slice_size; l != (slice + 1) * slice_size; ++l)
+                {
+                    Arrayi lattice_index = mesh.transfer1DtoMeshIndex(number_of_lattices, l);
+                    int category = block_categories[mesh.transferMeshIndexTo1D(number_of_blocks, lattice_index / block_size)];
+                    if (category == 0)
+                        continue;
+
+                    Vecd particle_position = mesh.CellPositionFromIndex(lattice_index);
+                    if (category == 1 || initial_shape_.checkContain(particle_position))
+                    {
+                        slice_positions[slice].push_back(particle_position);
+                    }
+                }
+            }
+        },
+        ap);
+
+    // Concatenate in slice order so that the particle ordering is reproducible.
+    size_t total_number_of_particles = 0;
+    for (const StdVec<Vecd> &positions : slice_positions)
+        total_number_of_particles += positions.size();
+    position_.reserve(position_.size() + total_number_of_particles);
+    volumetric_measure_.reserve(volumetric_measure_.size() + total_number_of_particles);
+    for (const StdVec<Vecd> &positions : slice_positions)
+        for (const Vecd &particle_position : positions)
+        {
+            addPositionAndVolumetricMeasure(particle_position, particle_volume);
+        }
+}
+//=================================================================================================//
 ParticleGenerator<BaseParticles, Lattice, Adaptive>::
     ParticleGenerator(SPHBody &sph_body, BaseParticles &base_particles, Shape &target_shape)
     : ParticleGenerator<BaseParticles, Lattice>(sph_body, base_particles),
@@ -51,6 +121,60 @@ void ParticleGenerator<BaseParticles, Lattice, Adaptive>::
     }
 }
 //=================================================================================================//
+ParticleGenerator<BaseParticles, Split>::
+    ParticleGenerator(SPHBody &sph_body, BaseParticles &base_particles, SPHBody &coarse_body)
+    : ParticleGenerator<BaseParticles>(sph_body, base_particles),
+      GeneratingMethod<Lattice>(sph_body), coarse_body_(coarse_body) {}
+//=================================================================================================//
+void ParticleGenerator<BaseParticles, Split>::prepareGeometricData()
+{
+    Real coarse_spacing = coarse_body_.sph_adaptation_->ReferenceSpacing();
+    int split_number = int(std::round(coarse_spacing / lattice_spacing_));
+    if (split_number < 1 || ABS(Real(split_number) * lattice_spacing_ - coarse_spacing) > 0.01 * lattice_spacing_)
+    {
+        std::cout << "\n Error: the spacing of the coarse body " << coarse_body_.getName()
+                  << " is not a multiple of the particle spacing!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+
+    BaseParticles &coarse_particles = coarse_body_.getBaseParticles();
+    StdLargeVec<Vecd> &coarse_position = *coarse_particles.getVariableDataByName<Vecd>("Position");
+    size_t number_of_coarse_particles = coarse_particles.TotalRealParticles();
+    Arrayi split_lattices = split_number * Arrayi::Ones();
+    size_t number_of_children = split_lattices.prod();
+    BaseMesh split_mesh(split_lattices);
+    StdVec<Vecd> children_positions(number_of_coarse_particles * number_of_children);
+    parallel_for(
+        IndexRange(0, number_of_coarse_particles),
+        [&](const IndexRange &r)
+        {
+            for (size_t i = r.begin(); i != r.end(); ++i)
+            {
+                for (size_t n = 0; n != number_of_children; ++n)
+                {
+                    Arrayi child_index = split_mesh.transfer1DtoMeshIndex(split_lattices, n);
+                    Vecd child_offset =
+                        ((child_index.cast<Real>() + 0.5) / Real(split_number) - 0.5).matrix() * coarse_spacing;
+                    children_positions[i * number_of_children + n] = coarse_position[i] + child_offset;
+                }
+            }
+        },
+        ap);
+
+    // Only the children inside the body shape are kept, in the order of the coarse particles.
+    StdVec<int> is_contained;
+    initial_shape_.checkContains(children_positions, is_contained);
+    Real particle_volume = pow(lattice_spacing_, Dimensions);
+    for (size_t l = 0; l != children_positions.size(); ++l)
+    {
+        if (is_contained[l])
+        {
+            addPositionAndVolumetricMeasure(children_positions[l], particle_volume);
+        }
+    }
+}
+//=================================================================================================//
 ParticleGenerator<SurfaceParticles, Lattice>::
     ParticleGenerator(SPHBody &sph_body, SurfaceParticles &surface_particles, Real thickness)
     : ParticleGenerator<SurfaceParticles>(sph_body, surface_particles),
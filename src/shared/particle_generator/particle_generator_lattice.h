@@ -76,6 +76,19 @@ class ParticleGenerator<BaseParticles, Lattice, Adaptive> : public ParticleGener
     virtual void addPositionAndVolumetricMeasure(const Vecd &position, Real volume) override;
 };
 
+template <> // For generating particles by splitting the relaxed particles of a coarser body into sub-lattices
+class ParticleGenerator<BaseParticles, Split>
+    : public ParticleGenerator<BaseParticles>, public GeneratingMethod<Lattice>
+{
+  public:
+    ParticleGenerator(SPHBody &sph_body, BaseParticles &base_particles, SPHBody &coarse_body);
+    virtual ~ParticleGenerator(){};
+    virtual void prepareGeometricData() override;
+
+  protected:
+    SPHBody &coarse_body_;
+};
+
 template <> // For generating surface particles from lattice positions using reduced order approach
 class ParticleGenerator<SurfaceParticles, Lattice>
     : public ParticleGenerator<SurfaceParticles>, public GeneratingMethod<Lattice>
@@ -0,0 +1,26 @@
+#include "particle_generator_shared.h"
+
+#include "base_body.h"
+
+namespace SPH
+{
+//=================================================================================================//
+void SharedParticleData::captureParticleData(SPHBody &sph_body)
+{
+    BaseParticles &base_particles = sph_body.getBaseParticles();
+    StdLargeVec<Vecd> &position = *base_particles.getVariableDataByName<Vecd>("Position");
+    StdLargeVec<Real> &volumetric_measure = *base_particles.getVariableDataByName<Real>("VolumetricMeasure");
+    size_t total_particles = base_particles.TotalRealParticles();
+
+    position_.assign(position.begin(), position.begin() + total_particles);
+    volumetric_measure_.assign(volumetric_measure.begin(), volumetric_measure.begin() + total_particles);
+    is_captured_ = true;
+}
+//=================================================================================================//
+void SharedParticleData::copyParticleData(StdLargeVec<Vecd> &position, StdLargeVec<Real> &volumetric_measure)
+{
+    position.insert(position.end(), position_.begin(), position_.end());
+    volumetric_measure.insert(volumetric_measure.end(), volumetric_measure_.begin(), volumetric_measure_.end());
+}
+//=================================================================================================//
+} // namespace SPH
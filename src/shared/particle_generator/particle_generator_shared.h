@@ -0,0 +1,93 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file particle_generator_shared.h
+ * @brief Particle generator reusing relaxed particles shared by the bodies of
+ * several case variants run in the same process, e.g. in a parametric sweep.
+ * @details The first body generates its particles with the wrapped generating method.
+ * After the relaxation, its particles are captured in the shared data by an explicit call of captureParticleData,
+ * as only the case knows when the relaxation is finished.
+ * All later bodies start from copies of them without generating or relaxing again.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef PARTICLE_GENERATOR_SHARED_H
+#define PARTICLE_GENERATOR_SHARED_H
+
+#include "base_particle_generator.h"
+
+namespace SPH
+{
+/**
+ * @class SharedParticleData
+ * @brief Geometric data, i.e. position and volumetric measure, of relaxed particles.
+ * The data are captured once and only read afterwards.
+ */
+class SharedParticleData
+{
+  public:
+    SharedParticleData(){};
+    virtual ~SharedParticleData(){};
+
+    bool isCaptured() { return is_captured_; };
+    size_t TotalParticles() { return position_.size(); };
+    /** Capture the present positions and volumetric measures of the real particles of the body. */
+    void captureParticleData(SPHBody &sph_body);
+    /** Append the captured data to the geometric data of a particle generator. */
+    void copyParticleData(StdLargeVec<Vecd> &position, StdLargeVec<Real> &volumetric_measure);
+
+  protected:
+    bool is_captured_ = false;
+    StdLargeVec<Vecd> position_;
+    StdLargeVec<Real> volumetric_measure_;
+};
+
+template <typename... Parameters> // generate particles from shared data or by the given generating method
+class ParticleGenerator<BaseParticles, Shared, Parameters...>
+    : public ParticleGenerator<BaseParticles, Parameters...>
+{
+  public:
+    template <typename... Args>
+    ParticleGenerator(SPHBody &sph_body, BaseParticles &base_particles,
+                      SharedParticleData &shared_particle_data, Args &&...args)
+        : ParticleGenerator<BaseParticles, Parameters...>(sph_body, base_particles, std::forward<Args>(args)...),
+          shared_particle_data_(shared_particle_data){};
+    virtual ~ParticleGenerator(){};
+
+    virtual void prepareGeometricData() override
+    {
+        if (shared_particle_data_.isCaptured())
+        {
+            shared_particle_data_.copyParticleData(this->position_, this->volumetric_measure_);
+        }
+        else
+        {
+            ParticleGenerator<BaseParticles, Parameters...>::prepareGeometricData();
+        }
+    };
+
+  protected:
+    SharedParticleData &shared_particle_data_;
+};
+} // namespace SPH
+#endif // PARTICLE_GENERATOR_SHARED_H
@@ -0,0 +1,129 @@
+#include "particle_relaxation_cache.h"
+
+#include "base_body.h"
+#include "base_particles.h"
+#include "data_hash.h"
+#include "io_environment.h"
+#include "sph_system.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <typeinfo>
+namespace fs = std::filesystem;
+
+namespace SPH
+{
+//=================================================================================================//
+ParticleRelaxationCache::ParticleRelaxationCache(SPHBody &sph_body, const std::string &relaxation_method,
+                                                 uint64_t generator_hash)
+    : sph_body_(sph_body), is_loaded_(false), cached_relaxation_hash_(0)
+{
+    SPHSystem &sph_system = sph_body.getSPHSystem();
+    if (!sph_system.RelaxationCache() || !sph_system.hasIOEnvironment())
+        return;
+
+    cache_folder_ = sph_system.getIOEnvironment().cache_folder_ + "/relaxation";
+    SPHAdaptation &sph_adaptation = *sph_body.sph_adaptation_;
+    DataHash cache_hash;
+    cache_hash.add(std::string("RelaxedParticles_v2")).add(relaxation_method).add(generator_hash);
+    cache_hash.add(Dimensions).add(sizeof(Real)).add(sph_body.getInitialShape().getGeometryHash());
+    cache_hash.add(std::string(typeid(sph_adaptation).name()));
+    cache_hash.add(sph_adaptation.ReferenceSpacing()).add(sph_adaptation.ReferenceSmoothingLength());
+    cache_hash.add(sph_adaptation.LocalRefinementLevel()).add(sph_adaptation.MinimumSpacing());
+    cache_hash.add(sph_adaptation.getKernel()->Name());
+    cache_key_ = cache_hash.HexString();
+}
+//=================================================================================================//
+std::string ParticleRelaxationCache::CacheFilePath()
+{
+    return cache_folder_ + "/" + sph_body_.getName() + "_" + cache_key_ + ".bin";
+}
+//=================================================================================================//
+bool ParticleRelaxationCache::readParticleData(StdLargeVec<Vecd> &position, StdLargeVec<Real> &volumetric_measure)
+{
+    if (!isActive() || !fs::exists(CacheFilePath()))
+        return false;
+
+    std::ifstream cache_file(CacheFilePath(), std::ios::binary);
+    size_t key_size = 0;
+    cache_file.read(reinterpret_cast<char *>(&key_size), sizeof(size_t));
+    std::string key_in_file(key_size < 64 ? key_size : 0, ' ');
+    cache_file.read(&key_in_file[0], key_in_file.size());
+    uint64_t relaxation_hash = 0;
+    cache_file.read(reinterpret_cast<char *>(&relaxation_hash), sizeof(uint64_t));
+    size_t total_particles = 0;
+    cache_file.read(reinterpret_cast<char *>(&total_particles), sizeof(size_t));
+    if (!cache_file || key_in_file != cache_key_)
+    {
+        std::cout << "\n Warning: relaxation cache file " << CacheFilePath()
+                  << " does not match, the particles will be relaxed again." << std::endl;
+        return false;
+    }
+
+    StdLargeVec<Vecd> cached_position(total_particles);
+    StdLargeVec<Real> cached_volumetric_measure(total_particles);
+    cache_file.read(reinterpret_cast<char *>(cached_position.data()), sizeof(Vecd) * total_particles);
+    cache_file.read(reinterpret_cast<char *>(cached_volumetric_measure.data()), sizeof(Real) * total_particles);
+    if (!cache_file)
+    {
+        std::cout << "\n Warning: relaxation cache file " << CacheFilePath()
+                  << " is incomplete, the particles will be relaxed again." << std::endl;
+        return false;
+    }
+
+    position.insert(position.end(), cached_position.begin(), cached_position.end());
+    volumetric_measure.insert(volumetric_measure.end(),
+                              cached_volumetric_measure.begin(), cached_volumetric_measure.end());
+    is_loaded_ = true;
+    cached_relaxation_hash_ = relaxation_hash;
+    std::cout << "\n Relaxed particles of " << sph_body_.getName()
+              << " are loaded from " << CacheFilePath() << std::endl;
+    return true;
+}
+//=================================================================================================//
+void ParticleRelaxationCache::writeParticleData(uint64_t relaxation_hash)
+{
+    if (!isActive())
+        return;
+
+    BaseParticles &base_particles = sph_body_.getBaseParticles();
+    StdLargeVec<Vecd> &position = *base_particles.getVariableDataByName<Vecd>("Position");
+    StdLargeVec<Real> &volumetric_measure = *base_particles.getVariableDataByName<Real>("VolumetricMeasure");
+    size_t total_particles = base_particles.TotalRealParticles();
+
+    if (!fs::exists(cache_folder_))
+    {
+        fs::create_directories(cache_folder_);
+    }
+    // write to a temporary file first so that a partially written file is never read
+    std::string temporary_file_path =
+        CacheFilePath() + "." + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+    {
+        std::ofstream cache_file(temporary_file_path, std::ios::binary | std::ios::trunc);
+        size_t key_size = cache_key_.size();
+        cache_file.write(reinterpret_cast<const char *>(&key_size), sizeof(size_t));
+        cache_file.write(cache_key_.data(), key_size);
+        cache_file.write(reinterpret_cast<const char *>(&relaxation_hash), sizeof(uint64_t));
+        cache_file.write(reinterpret_cast<const char *>(&total_particles), sizeof(size_t));
+        cache_file.write(reinterpret_cast<const char *>(position.data()), sizeof(Vecd) * total_particles);
+        cache_file.write(reinterpret_cast<const char *>(volumetric_measure.data()), sizeof(Real) * total_particles);
+    }
+    fs::rename(temporary_file_path, CacheFilePath());
+}
+//=================================================================================================//
+uint64_t ParticleRelaxationCache::ParticleDataHash(SPHBody &sph_body)
+{
+    BaseParticles &base_particles = sph_body.getBaseParticles();
+    StdLargeVec<Vecd> &position = *base_particles.getVariableDataByName<Vecd>("Position");
+    StdLargeVec<Real> &volumetric_measure = *base_particles.getVariableDataByName<Real>("VolumetricMeasure");
+    size_t total_particles = base_particles.TotalRealParticles();
+
+    DataHash particle_data_hash;
+    particle_data_hash.add(total_particles);
+    particle_data_hash.addBytes(position.data(), sizeof(Vecd) * total_particles);
+    particle_data_hash.addBytes(volumetric_measure.data(), sizeof(Real) * total_particles);
+    return particle_data_hash.Value();
+}
+//=================================================================================================//
+} // namespace SPH
@@ -0,0 +1,81 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file particle_relaxation_cache.h
+ * @brief Relaxed particle distributions cached on disk and reused by later runs.
+ * @details The cache key is the hash of the body shape, the resolution and adaptation
+ * parameters, the particle generator and its arguments, such as the target shape or
+ * the particles of the coarse body, and a user given name of the relaxation method.
+ * The relaxation step type and convergence criteria are stored with the particles,
+ * so that particles relaxed differently are only used as initial guess.
+ * Particle positions and volumetric measures are stored in binary form.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef PARTICLE_RELAXATION_CACHE_H
+#define PARTICLE_RELAXATION_CACHE_H
+
+#include "base_data_package.h"
+#include "large_data_containers.h"
+
+#include <cstdint>
+#include <string>
+
+namespace SPH
+{
+class SPHBody;
+
+/**
+ * @class ParticleRelaxationCache
+ * @brief Read and write the relaxed particles of a body keyed by geometry and numerical setup.
+ * @details The cache is inactive, i.e. the key is empty, when the relaxation cache
+ * of the SPH system is switched off (default) or no IO environment is set.
+ */
+class ParticleRelaxationCache
+{
+  public:
+    ParticleRelaxationCache(SPHBody &sph_body, const std::string &relaxation_method, uint64_t generator_hash);
+    virtual ~ParticleRelaxationCache(){};
+
+    bool isActive() { return !cache_key_.empty(); };
+    /** Whether the particles of the body have been loaded from the cache. */
+    bool isLoaded() { return is_loaded_; };
+    /** Whether the loaded particles have been relaxed with the given relaxation. */
+    bool isRelaxedBy(uint64_t relaxation_hash) { return is_loaded_ && cached_relaxation_hash_ == relaxation_hash; };
+    std::string CacheFilePath();
+    /** Read cached particle data, return false if no matching cache file is found. */
+    bool readParticleData(StdLargeVec<Vecd> &position, StdLargeVec<Real> &volumetric_measure);
+    /** Write the present particle positions and volumetric measures of the body relaxed by the given relaxation. */
+    void writeParticleData(uint64_t relaxation_hash);
+    /** Hash of the present real particle positions and volumetric measures of a body. */
+    static uint64_t ParticleDataHash(SPHBody &sph_body);
+
+  protected:
+    SPHBody &sph_body_;
+    std::string cache_folder_;
+    std::string cache_key_;
+    bool is_loaded_;
+    uint64_t cached_relaxation_hash_;
+};
+} // namespace SPH
+#endif // PARTICLE_RELAXATION_CACHE_H
@@ -0,0 +1,81 @@
+#include "device_configuration.h"
+
+namespace SPH
+{
+//=================================================================================================//
+DeviceConfiguration::~DeviceConfiguration()
+{
+    freeDeviceNeighborhoods();
+}
+//=================================================================================================//
+void DeviceConfiguration::freeDeviceNeighborhoods()
+{
+    if (device_neighborhoods_.offset_ != nullptr)
+    {
+        freeDeviceData(device_neighborhoods_.offset_);
+        freeDeviceData(device_neighborhoods_.j_);
+        freeDeviceData(device_neighborhoods_.W_ij_);
+        freeDeviceData(device_neighborhoods_.dW_ij_);
+        freeDeviceData(device_neighborhoods_.r_ij_);
+        freeDeviceData(device_neighborhoods_.e_ij_);
+        device_neighborhoods_ = {nullptr, nullptr, nullptr, nullptr, nullptr, nullptr};
+    }
+}
+//=================================================================================================//
+void DeviceConfiguration::copyToDevice(const ParticleConfiguration &configuration, size_t total_real_particles)
+{
+    offset_.resize(total_real_particles + 1);
+    offset_[0] = 0;
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        offset_[i + 1] = offset_[i] + configuration[i].current_size_;
+    }
+    size_t total_neighbors = offset_[total_real_particles];
+    j_.resize(total_neighbors);
+    W_ij_.resize(total_neighbors);
+    dW_ij_.resize(total_neighbors);
+    r_ij_.resize(total_neighbors);
+    e_ij_.resize(total_neighbors);
+
+    parallel_for(
+        IndexRange(0, total_real_particles),
+        [&](const IndexRange &r)
+        {
+            for (size_t i = r.begin(); i != r.end(); ++i)
+            {
+                const Neighborhood &neighborhood = configuration[i];
+                for (size_t n = 0; n != neighborhood.current_size_; ++n)
+                {
+                    size_t k = offset_[i] + n;
+                    j_[k] = neighborhood.j_[n];
+                    W_ij_[k] = neighborhood.W_ij_[n];
+                    dW_ij_[k] = neighborhood.dW_ij_[n];
+                    r_ij_[k] = neighborhood.r_ij_[n];
+                    e_ij_[k] = neighborhood.e_ij_[n];
+                }
+            }
+        },
+        ap);
+
+    if (total_real_particles + 1 > particles_capacity_ || total_neighbors > neighbors_capacity_)
+    {
+        freeDeviceNeighborhoods();
+        particles_capacity_ = offset_.capacity();
+        neighbors_capacity_ = j_.capacity();
+        device_neighborhoods_.offset_ = allocateDeviceData<size_t>(particles_capacity_);
+        device_neighborhoods_.j_ = allocateDeviceData<size_t>(neighbors_capacity_);
+        device_neighborhoods_.W_ij_ = allocateDeviceData<Real>(neighbors_capacity_);
+        device_neighborhoods_.dW_ij_ = allocateDeviceData<Real>(neighbors_capacity_);
+        device_neighborhoods_.r_ij_ = allocateDeviceData<Real>(neighbors_capacity_);
+        device_neighborhoods_.e_ij_ = allocateDeviceData<Vecd>(neighbors_capacity_);
+    }
+
+    SPH::copyToDevice(offset_.data(), device_neighborhoods_.offset_, total_real_particles + 1);
+    SPH::copyToDevice(j_.data(), device_neighborhoods_.j_, total_neighbors);
+    SPH::copyToDevice(W_ij_.data(), device_neighborhoods_.W_ij_, total_neighbors);
+    SPH::copyToDevice(dW_ij_.data(), device_neighborhoods_.dW_ij_, total_neighbors);
+    SPH::copyToDevice(r_ij_.data(), device_neighborhoods_.r_ij_, total_neighbors);
+    SPH::copyToDevice(e_ij_.data(), device_neighborhoods_.e_ij_, total_neighbors);
+}
+//=================================================================================================//
+} // namespace SPH
@@ -0,0 +1,80 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file    device_configuration.h
+ * @brief   The device-resident copy of a particle configuration.
+ * @details The neighborhoods are flattened in compressed rows,
+ *          i.e. the neighbors of particle i are in the range [offset_[i], offset_[i + 1]).
+ * @author  Xiangyu Hu
+ */
+
+#ifndef DEVICE_CONFIGURATION_H
+#define DEVICE_CONFIGURATION_H
+
+#include "device_execution.h"
+#include "neighborhood.h"
+
+namespace SPH
+{
+/**
+ * @struct DeviceNeighborhoods
+ * @brief The device pointers of the flattened neighborhoods,
+ * which are captured by value in the device functions.
+ */
+struct DeviceNeighborhoods
+{
+    size_t *offset_;
+    size_t *j_;
+    Real *W_ij_;
+    Real *dW_ij_;
+    Real *r_ij_;
+    Vecd *e_ij_;
+};
+
+/**
+ * @class DeviceConfiguration
+ * @brief Flatten a particle configuration on the host and copy it to the device.
+ */
+class DeviceConfiguration
+{
+  public:
+    DeviceConfiguration(){};
+    DeviceConfiguration(const DeviceConfiguration &) = delete;
+    DeviceConfiguration &operator=(const DeviceConfiguration &) = delete;
+    ~DeviceConfiguration();
+
+    void copyToDevice(const ParticleConfiguration &configuration, size_t total_real_particles);
+    DeviceNeighborhoods &getDeviceNeighborhoods() { return device_neighborhoods_; };
+
+  protected:
+    StdLargeVec<size_t> offset_, j_;
+    StdLargeVec<Real> W_ij_, dW_ij_, r_ij_;
+    StdLargeVec<Vecd> e_ij_;
+    size_t particles_capacity_ = 0;
+    size_t neighbors_capacity_ = 0;
+    DeviceNeighborhoods device_neighborhoods_ = {nullptr, nullptr, nullptr, nullptr, nullptr, nullptr};
+
+    void freeDeviceNeighborhoods();
+};
+} // namespace SPH
+#endif // DEVICE_CONFIGURATION_H
@@ -22,6 +22,23 @@ void Neighborhood::removeANeighbor(size_t neighbor_n)
     e_ij_[neighbor_n] = e_ij_[current_size_];
 }
 //=================================================================================================//
+size_t Neighborhood::AllocatedBytes() const
+{
+    return j_.capacity() * sizeof(size_t) + W_ij_.capacity() * sizeof(Real) +
+           dW_ij_.capacity() * sizeof(Real) + r_ij_.capacity() * sizeof(Real) +
+           e_ij_.capacity() * sizeof(Vecd);
+}
+//=================================================================================================//
+size_t ParticleConfigurationBytes(const ParticleConfiguration &configuration)
+{
+    size_t bytes = configuration.capacity() * sizeof(Neighborhood);
+    for (const Neighborhood &neighborhood : configuration)
+    {
+        bytes += neighborhood.AllocatedBytes();
+    }
+    return bytes;
+}
+//=================================================================================================//
 void NeighborBuilder::createNeighbor(Neighborhood &neighborhood, const Real &distance,
                                      const Vecd &displacement, size_t index_j)
 {
@@ -62,8 +62,12 @@ class Neighborhood
     ~Neighborhood(){};
 
     void removeANeighbor(size_t neighbor_n);
+    /** memory allocated for the neighbor data, not including the neighborhood itself */
+    size_t AllocatedBytes() const;
 };
 using ParticleConfiguration = StdLargeVec<Neighborhood>;
+/** memory allocated for a particle configuration, including its neighbor data */
+size_t ParticleConfigurationBytes(const ParticleConfiguration &configuration);
 
 /**
  * @class NeighborBuilder
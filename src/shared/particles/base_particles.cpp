@@ -21,7 +21,8 @@ BaseParticles::BaseParticles(SPHBody &sph_body, BaseMaterial *base_material)
       copy_particle_data_(all_particle_data_),
       write_restart_variable_to_xml_(variables_to_restart_, restart_xml_parser_),
       write_reload_variable_to_xml_(variables_to_reload_, reload_xml_parser_),
-      read_restart_variable_from_xml_(variables_to_restart_, restart_xml_parser_)
+      read_restart_variable_from_xml_(variables_to_restart_, restart_xml_parser_),
+      collect_unshared_variables_(all_discrete_variables_)
 {
     sph_body.assignBaseParticles(this);
 }
@@ -214,6 +215,13 @@ void BaseParticles::readParticleFromXmlForRestart(std::string &filefullpath)
     read_restart_variable_from_xml_(this);
 }
 //=================================================================================================//
+StdVec<std::string> BaseParticles::getUnsharedVariableNames()
+{
+    StdVec<std::string> variable_names;
+    collect_unshared_variables_(this, variable_names);
+    return variable_names;
+}
+//=================================================================================================//
 void BaseParticles::writeToXmlForReloadParticle(std::string &filefullpath)
 {
     resizeXmlDocForParticles(reload_xml_parser_);
@@ -164,6 +164,12 @@ class BaseParticles
     template <typename DataType>
     void addVariableToReload(const std::string &name);
     inline const ParticleVariables &getVariablesToReload() const { return variables_to_reload_; }
+    ParticleVariables &AllDiscreteVariables() { return all_discrete_variables_; };
+    /** variables registered but not requested by name or registered again afterwards, and not written,
+     *  restarted, reloaded or sorted. As the access through the reference kept by the registering method
+     *  is not counted, these variables may still be read by that method; they are only used by one method,
+     *  e.g. as its local buffer, and are the candidates for checking unnecessary memory. */
+    StdVec<std::string> getUnsharedVariableNames();
     //----------------------------------------------------------------------
     // Particle data for sorting
     //----------------------------------------------------------------------
@@ -261,9 +267,17 @@ class BaseParticles
         void operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables, BaseParticles *base_particles);
     };
 
+    struct CollectUnsharedVariables
+    {
+        template <typename DataType>
+        void operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
+                        BaseParticles *base_particles, StdVec<std::string> &variable_names);
+    };
+
     OperationOnDataAssemble<ParticleData, CopyParticleData> copy_particle_data_;
     OperationOnDataAssemble<ParticleVariables, WriteAParticleVariableToXml> write_restart_variable_to_xml_, write_reload_variable_to_xml_;
     OperationOnDataAssemble<ParticleVariables, ReadAParticleVariableFromXml> read_restart_variable_from_xml_;
+    OperationOnDataAssemble<ParticleVariables, CollectUnsharedVariables> collect_unshared_variables_;
 };
 } // namespace SPH
 #endif // BASE_PARTICLES_H
@@ -23,7 +23,7 @@ StdLargeVec<DataType> *BaseParticles::
 {
     if (variable->DataField() == nullptr)
     {
-        variable->allocateDataField(particles_bound_, initial_value);
+        variable->allocateDataField(particles_bound_, initial_value, body_name_);
     }
     else
     {
@@ -109,6 +109,10 @@ StdLargeVec<DataType> *BaseParticles::registerSharedVariable(const std::string &
         constexpr int type_index = DataTypeIndex<DataType>::value;
         std::get<type_index>(all_particle_data_).push_back(variable->DataField());
     }
+    else
+    {
+        variable->markAccessed();
+    }
 
     return variable->DataField();
 }
@@ -125,6 +129,7 @@ StdLargeVec<DataType> *BaseParticles::registerSharedVariableFrom(
         std::cout << __FILE__ << ':' << __LINE__ << std::endl;
         exit(1);
     }
+    variable->markAccessed();
 
     StdLargeVec<DataType> &old_data = *variable->DataField();
     return registerSharedVariable<DataType>(new_name, [&](size_t index)
@@ -164,6 +169,7 @@ DiscreteVariable<DataType> *BaseParticles::getVariableByName(const std::string &
         std::cout << __FILE__ << ':' << __LINE__ << std::endl;
         exit(1);
     }
+    variable->markAccessed();
     return variable;
 }
 //=================================================================================================//
@@ -257,6 +263,25 @@ operator()(DataContainerAddressKeeper<StdLargeVec<DataType>> &data_keeper, size_
 }
 //=================================================================================================//
 template <typename DataType>
+void BaseParticles::CollectUnsharedVariables::
+operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
+           BaseParticles *base_particles, StdVec<std::string> &variable_names)
+{
+    for (DiscreteVariable<DataType> *variable : variables)
+    {
+        const std::string &name = variable->Name();
+        if (variable->AccessCount() == 0 &&
+            findVariableByName<DataType>(base_particles->variables_to_write_, name) == nullptr &&
+            findVariableByName<DataType>(base_particles->variables_to_restart_, name) == nullptr &&
+            findVariableByName<DataType>(base_particles->variables_to_reload_, name) == nullptr &&
+            findVariableByName<DataType>(base_particles->sortable_variables_, name) == nullptr)
+        {
+            variable_names.push_back(name);
+        }
+    }
+}
+//=================================================================================================//
+template <typename DataType>
 void BaseParticles::WriteAParticleVariableToXml::
 operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables)
 {
@@ -52,18 +52,20 @@ class RegressionTestDynamicTimeWarping : public RegressionTestTimeAverage<Observ
     StdVec<Real> dtw_distance_, dtw_distance_new_; /* the container of DTW distance between each pairs. */
 
     /** the method used for calculating the p_norm. (calculateDTWDistance) */
-    Real calculatePNorm(Real variable_a, Real variable_b)
+    static Real calculatePNorm(Real variable_a, Real variable_b)
     {
         return std::abs(variable_a - variable_b);
     };
     template <typename Variable>
-    Real calculatePNorm(const Variable &variable_a, const Variable variable_b)
+    static Real calculatePNorm(const Variable &variable_a, const Variable variable_b)
     {
         return (variable_a - variable_b).norm();
     };
 
-    /** the local constrained method used for calculating the dtw distance between two lines. */
-    StdVec<Real> calculateDTWDistance(BiVector<VariableType> dataset_a_, BiVector<VariableType> dataset_b_);
+    /** the local constrained method used for calculating the dtw distance between two lines,
+     *  with rolling rows of linear memory and in parallel for all observations. */
+    StdVec<Real> calculateDTWDistance(const BiVector<VariableType> &dataset_a_, const BiVector<VariableType> &dataset_b_);
+    static Real calculateDTWDistance(const StdVec<VariableType> &series_a, const StdVec<VariableType> &series_b, int window_size);
 
   public:
     template <typename... Args>
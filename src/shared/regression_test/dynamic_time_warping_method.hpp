@@ -14,40 +14,75 @@ namespace SPH
 {
 //=================================================================================================//
 template <class ObserveMethodType>
-StdVec<Real> RegressionTestDynamicTimeWarping<ObserveMethodType>::calculateDTWDistance(BiVector<VariableType> dataset_a_, BiVector<VariableType> dataset_b_)
+StdVec<Real> RegressionTestDynamicTimeWarping<ObserveMethodType>::
+    calculateDTWDistance(const BiVector<VariableType> &dataset_a_, const BiVector<VariableType> &dataset_b_)
 {
-    /* define the container to hold the dtw distance.*/
-    StdVec<Real> dtw_distance;
+    int window_size_ = 5;
     for (int observation_index = 0; observation_index != this->observation_; ++observation_index)
     {
-        int window_size_ = 5;
         int a_length = dataset_a_[observation_index].size();
         int b_length = dataset_b_[observation_index].size();
-
         if (b_length > 1.1 * a_length || b_length < 0.9 * a_length)
         {
             std::cout << "\n Error: please check the time step change, because the data length changed a lot !" << std::endl;
             std::cout << __FILE__ << ':' << __LINE__ << std::endl;
             exit(1);
         }
+    }
 
-        /** create a 2D vector with [a_length, b_length] to contain the local DTW distance value. */
-        BiVector<Real> local_dtw_distance(a_length, StdVec<Real>(b_length, 0));
-        local_dtw_distance[0][0] = calculatePNorm(dataset_a_[observation_index][0], dataset_b_[observation_index][0]);
-        for (int index_i = 1; index_i < a_length; ++index_i)
-            local_dtw_distance[index_i][0] = local_dtw_distance[index_i - 1][0] + calculatePNorm(dataset_a_[observation_index][index_i], dataset_b_[observation_index][0]);
-        for (int index_j = 1; index_j < b_length; ++index_j)
-            local_dtw_distance[0][index_j] = local_dtw_distance[0][index_j - 1] + calculatePNorm(dataset_a_[observation_index][0], dataset_b_[observation_index][index_j]);
+    /* define the container to hold the dtw distance.*/
+    StdVec<Real> dtw_distance(this->observation_, 0);
+    parallel_for(
+        IndexRange(0, this->observation_),
+        [&](const IndexRange &r)
+        {
+            for (size_t observation_index = r.begin(); observation_index != r.end(); ++observation_index)
+            {
+                dtw_distance[observation_index] = calculateDTWDistance(
+                    dataset_a_[observation_index], dataset_b_[observation_index], window_size_);
+            }
+        },
+        ap);
+    return dtw_distance;
+};
+//=================================================================================================//
+template <class ObserveMethodType>
+Real RegressionTestDynamicTimeWarping<ObserveMethodType>::
+    calculateDTWDistance(const StdVec<VariableType> &series_a, const StdVec<VariableType> &series_b, int window_size)
+{
+    /** identical lines give zero distance along the diagonal. */
+    if (series_a == series_b)
+        return 0.0;
+
+    int a_length = series_a.size();
+    int b_length = series_b.size();
+    /** Two rolling rows give the same values as the former dense [a_length, b_length] matrix,
+     *  in which the entries outside of the locality constraint stay zero. */
+    StdVec<Real> previous_row(b_length, 0), current_row(b_length, 0);
+    previous_row[0] = calculatePNorm(series_a[0], series_b[0]);
+    for (int index_j = 1; index_j < b_length; ++index_j)
+        previous_row[index_j] = previous_row[index_j - 1] + calculatePNorm(series_a[0], series_b[index_j]);
 
-        /** add locality constraint */
-        window_size_ = SMAX(window_size_, ABS(a_length - b_length));
-        for (int index_i = 1; index_i != a_length; ++index_i)
-            for (int index_j = SMAX(1, index_i - window_size_); index_j != SMIN(b_length, index_i + window_size_); ++index_j)
-                local_dtw_distance[index_i][index_j] = calculatePNorm(dataset_a_[observation_index][index_i], dataset_b_[observation_index][index_j]) +
-                                                       SMIN(local_dtw_distance[index_i - 1][index_j], local_dtw_distance[index_i][index_j - 1], local_dtw_distance[index_i - 1][index_j - 1]);
-        dtw_distance.push_back(local_dtw_distance[a_length - 1][b_length - 1]);
+    /** add locality constraint */
+    window_size = SMAX(window_size, ABS(a_length - b_length));
+    std::pair<int, int> previous_band(1, b_length); /* entries written in previous row */
+    std::pair<int, int> stale_band(0, 0);           /* entries left in current row from two rows before */
+    for (int index_i = 1; index_i < a_length; ++index_i)
+    {
+        for (int index_j = stale_band.first; index_j < stale_band.second; ++index_j)
+            current_row[index_j] = 0;
+        current_row[0] = previous_row[0] + calculatePNorm(series_a[index_i], series_b[0]);
+
+        std::pair<int, int> band(SMAX(1, index_i - window_size), SMIN(b_length, index_i + window_size));
+        for (int index_j = band.first; index_j < band.second; ++index_j)
+            current_row[index_j] = calculatePNorm(series_a[index_i], series_b[index_j]) +
+                                   SMIN(previous_row[index_j], current_row[index_j - 1], previous_row[index_j - 1]);
+
+        std::swap(previous_row, current_row);
+        stale_band = previous_band;
+        previous_band = band;
     }
-    return dtw_distance;
+    return previous_row[b_length - 1];
 };
 //=================================================================================================//
 template <class ObserveMethodType>
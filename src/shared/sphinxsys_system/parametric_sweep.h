@@ -0,0 +1,146 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file parametric_sweep.h
+ * @brief Running the variants of one case in one process with
+ * shared shapes, level sets and relaxed particles.
+ * @details Each variant builds its own SPH system, bodies, particles and dynamics,
+ * i.e. all mutable states, and writes to its own output and restart subfolders.
+ * The immutable geometric data, shapes, level sets and relaxed particles,
+ * are defined once by the sweep and only read by the variants.
+ * The variants run back-to-back, as the physical time is a global static variable.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef PARAMETRIC_SWEEP_H
+#define PARAMETRIC_SWEEP_H
+
+#include "adaptation.h"
+#include "base_particle_dynamics.h"
+#include "level_set_shape.h"
+#include "particle_generator_shared.h"
+
+namespace SPH
+{
+/**
+ * @class ParametricSweep
+ * @brief Driver of the variants of a case given by a set of parameters.
+ * The case is a function or lambda with the signature
+ * void(const std::string &variant_name, const VariantParameters &parameters),
+ * in which the SPH system is created with setIOEnvironment(delete_output, variant_name)
+ * and the bodies are built from the shared shapes and particle data of the sweep.
+ */
+template <typename VariantParameters>
+class ParametricSweep
+{
+    StdVec<SharedPtr<Shape>> shared_shapes_;
+    UniquePtrsKeeper<SharedParticleData> shared_particle_data_keeper_;
+    StdVec<SharedParticleData *> shared_particle_data_;
+
+  public:
+    ParametricSweep(){};
+    virtual ~ParametricSweep(){};
+
+    ParametricSweep &addVariant(const std::string &variant_name, const VariantParameters &parameters)
+    {
+        for (auto &name : variant_names_)
+        {
+            if (name == variant_name)
+            {
+                std::cout << "\n Error: the variant " << variant_name << " is already defined!" << std::endl;
+                std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+                exit(1);
+            }
+        }
+        variant_names_.push_back(variant_name);
+        variant_parameters_.push_back(parameters);
+        return *this;
+    };
+
+    size_t NumberOfVariants() { return variant_names_.size(); };
+
+    /** Shape shared by the bodies of all variants, to be given to the body constructor. */
+    template <class ShapeType, typename... Args>
+    SharedPtr<ShapeType> defineSharedShape(Args &&...args)
+    {
+        SharedPtr<ShapeType> shape_ptr = makeShared<ShapeType>(std::forward<Args>(args)...);
+        shared_shapes_.push_back(shape_ptr);
+        return shape_ptr;
+    };
+
+    /** Level set shape shared by the bodies of all variants.
+     * The variants are required to use the same reference resolution for the body. */
+    SharedPtr<LevelSetShape> defineSharedLevelSetShape(Shape &shape, Real resolution_ref, Real refinement_ratio = 1.0)
+    {
+        return defineSharedShape<LevelSetShape>(shape, makeShared<SPHAdaptation>(resolution_ref), refinement_ratio);
+    };
+
+    /** Relaxed particles captured by the first variant and reused by the later ones. */
+    SharedParticleData &defineSharedParticleData()
+    {
+        SharedParticleData *shared_particle_data = shared_particle_data_keeper_.template createPtr<SharedParticleData>();
+        shared_particle_data_.push_back(shared_particle_data);
+        return *shared_particle_data;
+    };
+
+    /** Run the variants in the order they are added.
+     * The sweep does not know when the relaxation of a body is finished.
+     * Therefore, the first variant, which generates the particles from the shared particle data,
+     * has to relax them and then call captureParticleData of that data explicitly.
+     * The later variants start from the captured particles and skip the relaxation,
+     * e.g. by checking isCaptured of the shared particle data before relaxing.
+     * A shared particle data not captured by the first variant is an error. */
+    template <class VariantCase>
+    void run(const VariantCase &variant_case)
+    {
+        for (size_t i = 0; i != variant_names_.size(); ++i)
+        {
+            std::cout << "\n Parametric sweep: running variant " << variant_names_[i]
+                      << " (" << i + 1 << " of " << variant_names_.size() << ")" << std::endl;
+            TickCount t1 = TickCount::now();
+            GlobalStaticVariables::physical_time_ = 0.0;
+            variant_case(variant_names_[i], variant_parameters_[i]);
+            TimeInterval tt = TickCount::now() - t1;
+            std::cout << " Parametric sweep: variant " << variant_names_[i]
+                      << " finished in " << tt.seconds() << " seconds." << std::endl;
+
+            for (SharedParticleData *shared_particle_data : shared_particle_data_)
+            {
+                if (!shared_particle_data->isCaptured())
+                {
+                    std::cout << "\n Error: the shared particle data is not captured by the variant "
+                              << variant_names_[i] << "!" << std::endl;
+                    std::cout << " Call captureParticleData after the particle relaxation." << std::endl;
+                    std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+                    exit(1);
+                }
+            }
+        }
+    };
+
+  protected:
+    StdVec<std::string> variant_names_;
+    StdVec<VariantParameters> variant_parameters_;
+};
+} // namespace SPH
+#endif // PARAMETRIC_SWEEP_H
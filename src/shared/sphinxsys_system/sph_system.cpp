@@ -3,6 +3,10 @@
 #include "all_body_relations.h"
 #include "base_body.h"
 #include "elastic_dynamics.h"
+#include "memory_footprint.h"
+
+#include <tbb/task_arena.h>
+#include <tbb/task_group.h>
 
 namespace SPH
 {
@@ -12,7 +16,9 @@ SPHSystem::SPHSystem(BoundingBox system_domain_bounds, Real resolution_ref, size
       resolution_ref_(resolution_ref),
       tbb_global_control_(tbb::global_control::max_allowed_parallelism, number_of_threads),
       io_environment_(nullptr), run_particle_relaxation_(false), reload_particles_(false),
-      restart_step_(0), generate_regression_data_(false), state_recording_(true) {}
+      restart_step_(0), generate_regression_data_(false), state_recording_(true),
+      use_level_set_cache_(false), use_relaxation_cache_(false), use_mesh_cache_(false),
+      memory_report_(false) {}
 //=================================================================================================//
 IOEnvironment &SPHSystem::getIOEnvironment()
 {
@@ -28,19 +34,75 @@ IOEnvironment &SPHSystem::getIOEnvironment()
 
 void SPHSystem::initializeSystemCellLinkedLists()
 {
+    updateSystemCellLinkedLists();
+}
+//=================================================================================================//
+void SPHSystem::initializeSystemConfigurations()
+{
+    updateSystemConfigurations();
+
+    if (memory_report_)
+    {
+        writeMemoryReport();
+        MemoryFootprint::writeReportAtExit();
+    }
+}
+//=================================================================================================//
+void SPHSystem::updateSystemCellLinkedLists()
+{
+    // the tasks are isolated, so that a thread waiting within the nested parallel loops of one task
+    // does not take over an unrelated task of this group
+    tbb::task_group body_tasks;
     for (auto &body : real_bodies_)
     {
-        DynamicCast<RealBody>(this, body)->updateCellLinkedList();
+        RealBody *real_body = DynamicCast<RealBody>(this, body);
+        body_tasks.run([real_body]()
+                       { tbb::this_task_arena::isolate([real_body]()
+                                                       { real_body->updateCellLinkedList(); }); });
     }
+    body_tasks.wait();
 }
 //=================================================================================================//
-void SPHSystem::initializeSystemConfigurations()
+void SPHSystem::updateSystemConfigurations()
 {
+    // each relation writes only its own configuration and reads the cell linked lists,
+    // so that all relations, also those of the same body, are independent,
+    // and the tasks are isolated as those updating the cell linked lists
+    tbb::task_group body_tasks;
     for (auto &body : sph_bodies_)
     {
-        for (size_t i = 0; i < body->body_relations_.size(); i++)
+        body_tasks.run([body]()
+                       { tbb::this_task_arena::isolate(
+                             [body]()
+                             {
+                                 tbb::task_group relation_tasks;
+                                 for (auto &relation : body->body_relations_)
+                                 {
+                                     relation_tasks.run([relation]()
+                                                        { tbb::this_task_arena::isolate([relation]()
+                                                                                        { relation->updateConfiguration(); }); });
+                                 }
+                                 relation_tasks.wait();
+                             }); });
+    }
+    body_tasks.wait();
+}
+//=================================================================================================//
+void SPHSystem::writeMemoryReport(std::ostream &out)
+{
+    MemoryFootprint::writeReport(out);
+    for (auto &body : sph_bodies_)
+    {
+        StdVec<std::string> unshared_variables = body->getBaseParticles().getUnsharedVariableNames();
+        if (!unshared_variables.empty())
         {
-            body->body_relations_[i]->updateConfiguration();
+            out << " Variables of " << body->getName()
+                << " not requested by other methods after registration (used only by the registering method, if at all):";
+            for (const std::string &name : unshared_variables)
+            {
+                out << " " << name;
+            }
+            out << std::endl;
         }
     }
 }
@@ -71,6 +133,10 @@ SPHSystem *SPHSystem::handleCommandlineOptions(int ac, char *av[])
         desc.add_options()("regression", po::value<bool>(), "Regression test.");
         desc.add_options()("state_recording", po::value<bool>(), "State recording in output folder.");
         desc.add_options()("restart_step", po::value<int>(), "Run form a restart file.");
+        desc.add_options()("level_set_cache", po::value<bool>(), "Reuse level set data cached in previous runs.");
+        desc.add_options()("relaxation_cache", po::value<bool>(), "Reuse relaxed particles cached in previous runs.");
+        desc.add_options()("mesh_cache", po::value<bool>(), "Reuse parsed ANSYS meshes cached in previous runs.");
+        desc.add_options()("memory_report", po::value<bool>(), "Report memory footprint and particle variables not shared after registration.");
 
         po::variables_map vm;
         po::store(po::parse_command_line(ac, av, desc), vm);
@@ -141,6 +207,54 @@ SPHSystem *SPHSystem::handleCommandlineOptions(int ac, char *av[])
             std::cout << "Restart inactivated, i.e. restart_step ("
                       << restart_step_ << ").\n";
         }
+
+        if (vm.count("level_set_cache"))
+        {
+            use_level_set_cache_ = vm["level_set_cache"].as<bool>();
+            std::cout << "Level set cache was set to "
+                      << vm["level_set_cache"].as<bool>() << ".\n";
+        }
+        else
+        {
+            std::cout << "Level set cache was set to default ("
+                      << use_level_set_cache_ << ").\n";
+        }
+
+        if (vm.count("relaxation_cache"))
+        {
+            use_relaxation_cache_ = vm["relaxation_cache"].as<bool>();
+            std::cout << "Relaxation cache was set to "
+                      << vm["relaxation_cache"].as<bool>() << ".\n";
+        }
+        else
+        {
+            std::cout << "Relaxation cache was set to default ("
+                      << use_relaxation_cache_ << ").\n";
+        }
+
+        if (vm.count("mesh_cache"))
+        {
+            use_mesh_cache_ = vm["mesh_cache"].as<bool>();
+            std::cout << "Mesh cache was set to "
+                      << vm["mesh_cache"].as<bool>() << ".\n";
+        }
+        else
+        {
+            std::cout << "Mesh cache was set to default ("
+                      << use_mesh_cache_ << ").\n";
+        }
+
+        if (vm.count("memory_report"))
+        {
+            memory_report_ = vm["memory_report"].as<bool>();
+            std::cout << "Memory report was set to "
+                      << vm["memory_report"].as<bool>() << ".\n";
+        }
+        else
+        {
+            std::cout << "Memory report was set to default ("
+                      << memory_report_ << ").\n";
+        }
     }
     catch (std::exception &e)
     {
@@ -162,4 +276,10 @@ SPHSystem *SPHSystem::setIOEnvironment(bool delete_output)
     return this;
 }
 //=================================================================================================//
+SPHSystem *SPHSystem::setIOEnvironment(bool delete_output, const std::string &variant_name)
+{
+    io_environment_ = io_ptr_keeper_.createPtr<IOEnvironment>(*this, delete_output, variant_name);
+    return this;
+}
+//=================================================================================================//
 } // namespace SPH
@@ -78,6 +78,8 @@ class SPHSystem
     SPHSystem *handleCommandlineOptions(int ac, char *av[]);
 #endif
     SPHSystem *setIOEnvironment(bool delete_output = true);
+    /** Output and restart folders in subfolders named by the variant, e.g. of a parametric sweep. */
+    SPHSystem *setIOEnvironment(bool delete_output, const std::string &variant_name);
     IOEnvironment &getIOEnvironment();
     void setRunParticleRelaxation(bool run_particle_relaxation) { run_particle_relaxation_ = run_particle_relaxation; };
     bool RunParticleRelaxation() { return run_particle_relaxation_; };
@@ -89,10 +91,26 @@ class SPHSystem
     void setStateRecording(bool state_recording) { state_recording_ = state_recording; };
     void setRestartStep(size_t restart_step) { restart_step_ = restart_step; };
     size_t RestartStep() { return restart_step_; };
+    void setLevelSetCache(bool use_level_set_cache) { use_level_set_cache_ = use_level_set_cache; };
+    bool LevelSetCache() { return use_level_set_cache_; };
+    void setRelaxationCache(bool use_relaxation_cache) { use_relaxation_cache_ = use_relaxation_cache; };
+    bool RelaxationCache() { return use_relaxation_cache_; };
+    void setMeshCache(bool use_mesh_cache) { use_mesh_cache_ = use_mesh_cache; };
+    bool MeshCache() { return use_mesh_cache_; };
+    void setMemoryReport(bool memory_report) { memory_report_ = memory_report; };
+    bool MemoryReport() { return memory_report_; };
+    bool hasIOEnvironment() { return io_environment_ != nullptr; };
     /** Initialize cell linked list for the SPH system. */
     void initializeSystemCellLinkedLists();
     /** Initialize particle configuration for the SPH system. */
     void initializeSystemConfigurations();
+    /** Update the cell linked lists of all real bodies, the bodies concurrently. */
+    void updateSystemCellLinkedLists();
+    /** Update the configurations of all body relations, the bodies and their relations concurrently.
+     * The cell linked lists of all bodies are required to be updated before. */
+    void updateSystemConfigurations();
+    /** write the memory footprint and the particle variables not shared after registration. */
+    void writeMemoryReport(std::ostream &out = std::cout);
     /** get the min time step from all bodies. */
     Real getSmallestTimeStepAmongSolidBodies(Real CFL = 0.6);
     Real ReferenceResolution() { return resolution_ref_; };
@@ -108,6 +126,10 @@ class SPHSystem
     size_t restart_step_;           /**< restart step */
     bool generate_regression_data_; /**< run and generate or enhance the regression test data set. */
     bool state_recording_;          /**< Record state in output folder. */
+    bool use_level_set_cache_;      /**< reuse level set data cached from previous runs, off by default. */
+    bool use_relaxation_cache_;     /**< reuse relaxed particles cached from previous runs, off by default. */
+    bool use_mesh_cache_;           /**< reuse parsed ANSYS meshes cached from previous runs, off by default. */
+    bool memory_report_;            /**< report memory footprint after the configurations are initialized. */
 };
 } // namespace SPH
 #endif // SPH_SYSTEM_H
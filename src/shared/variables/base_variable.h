@@ -31,6 +31,8 @@
 #define BASE_VARIABLES_H
 
 #include "base_data_package.h"
+#include "memory_footprint.h"
+
 #include <cstring>
 #include <stdio.h>
 
@@ -42,9 +44,13 @@ class BaseVariable
     explicit BaseVariable(const std::string &name) : name_(name){};
     virtual ~BaseVariable(){};
     std::string Name() const { return name_; };
+    /** count the requests of the variable after its registration */
+    void markAccessed() { access_count_++; };
+    size_t AccessCount() const { return access_count_; };
 
   private:
     const std::string name_;
+    size_t access_count_ = 0;
 };
 
 template <typename DataType>
@@ -67,15 +73,26 @@ class DiscreteVariable : public BaseVariable
   public:
     DiscreteVariable(const std::string &name)
         : BaseVariable(name), data_field_(nullptr){};
-    virtual ~DiscreteVariable() { delete data_field_; };
+    virtual ~DiscreteVariable()
+    {
+        MemoryFootprint::release(footprint_entry_);
+        delete data_field_;
+    };
     StdLargeVec<DataType> *DataField() { return data_field_; };
-    void allocateDataField(const size_t size, const DataType &initial_value)
+    void allocateDataField(const size_t size, const DataType &initial_value,
+                           const std::string &owner_name = "")
     {
         data_field_ = new StdLargeVec<DataType>(size, initial_value);
+        /** the data field is resized when particle bounds increase, so its size is evaluated lazily */
+        footprint_entry_ = MemoryFootprint::recordDynamic(
+            owner_name, Name(), "ParticleVariable",
+            [this]()
+            { return data_field_->capacity() * sizeof(DataType); });
     }
 
   private:
     StdLargeVec<DataType> *data_field_;
+    size_t footprint_entry_ = MemoryFootprint::NoEntry;
 };
 
 template <typename DataType>
@@ -85,17 +102,25 @@ class MeshVariable : public BaseVariable
     using PackageData = PackageDataMatrix<DataType, 4>;
     MeshVariable(const std::string &name, size_t data_size)
         : BaseVariable(name), data_field_(nullptr){};
-    virtual ~MeshVariable() { delete[] data_field_; };
+    virtual ~MeshVariable()
+    {
+        MemoryFootprint::release(footprint_entry_);
+        delete[] data_field_;
+    };
 
     // void setDataField(PackageData* mesh_data){ data_field_ = mesh_data; };
     PackageData *DataField() { return data_field_; };
-    void allocateAllMeshVariableData(const size_t size)
+    void allocateAllMeshVariableData(const size_t size, const std::string &owner_name = "")
     {
+        MemoryFootprint::release(footprint_entry_);
         data_field_ = new PackageData[size];
+        footprint_entry_ = MemoryFootprint::record(owner_name, Name(), "MeshDataPackage",
+                                                   size * sizeof(PackageData));
     }
 
   private:
     PackageData *data_field_;
+    size_t footprint_entry_ = MemoryFootprint::NoEntry;
 };
 
 template <typename DataType, template <typename VariableDataType> class VariableType>
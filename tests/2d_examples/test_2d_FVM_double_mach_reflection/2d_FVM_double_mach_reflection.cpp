@@ -35,8 +35,9 @@ int main(int ac, char *av[])
     //	Define the main numerical methods used in the simulation.
     //	Note that there may be data dependence on the constructors of these methods.
     //----------------------------------------------------------------------
-    InteractionWithUpdate<fluid_dynamics::EulerianCompressibleIntegration1stHalfHLLCRiemann> pressure_relaxation(water_block_inner);
-    InteractionWithUpdate<fluid_dynamics::EulerianCompressibleIntegration2ndHalfHLLCRiemann> density_relaxation(water_block_inner);
+    // face-based integration solves the Riemann problem once for each cell interface
+    fluid_dynamics::EulerianCompressibleFaceIntegration1stHalfHLLCRiemann pressure_relaxation(water_block_inner);
+    fluid_dynamics::EulerianCompressibleFaceIntegration2ndHalfHLLCRiemann density_relaxation(water_block_inner);
 
     SimpleDynamics<DMFInitialCondition> initial_condition(wave_block);
     GhostCreationFromMesh ghost_creation(wave_block, ansys_mesh, ghost_boundary);
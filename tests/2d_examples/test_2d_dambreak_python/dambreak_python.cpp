@@ -6,6 +6,7 @@
  * @author	Luhui Han, Chi Zhang and Xiangyu Hu
  */
 #include "sphinxsys.h"         //SPHinXsys Library.
+#include "io_python.h"         //Binding layer for python.
 #include <pybind11/pybind11.h> //pybind11 Library.
 namespace py = pybind11;
 using namespace SPH; // Namespace cite here.
@@ -91,7 +92,7 @@ class PreSettingCase : public Parameter
 //----------------------------------------------------------------------
 //  Define environment.
 //----------------------------------------------------------------------
-class Environment : public PreSettingCase
+class Environment : public PreSettingCase, public PythonSimulationControl
 {
   protected:
     //----------------------------------------------------------------------
@@ -120,6 +121,7 @@ class Environment : public PreSettingCase
 
     ReduceDynamics<fluid_dynamics::AdvectionTimeStepSize> fluid_advection_time_step;
     ReduceDynamics<fluid_dynamics::AcousticTimeStepSize> fluid_acoustic_time_step;
+    ReduceDynamics<TotalMechanicalEnergy> water_mechanical_energy;
     //----------------------------------------------------------------------
     //	Define the methods for I/O operations, observations
     //	and regression tests of the simulation.
@@ -137,6 +139,7 @@ class Environment : public PreSettingCase
     int observation_sample_interval = screen_output_interval * 2;
     int restart_output_interval = screen_output_interval * 10;
     Real output_interval = 0.1;
+    size_t number_of_iterations = 0;
     //----------------------------------------------------------------------
     //	Statistics for CPU time
     //----------------------------------------------------------------------
@@ -149,7 +152,7 @@ class Environment : public PreSettingCase
 
   public:
     explicit Environment(int set_restart_step)
-        : PreSettingCase(),
+        : PreSettingCase(), PythonSimulationControl(0.1),
           water_block_inner(water_block),
           water_wall_contact(water_block, {&wall_boundary}),
           water_block_complex(water_block_inner, water_wall_contact),
@@ -162,6 +165,7 @@ class Environment : public PreSettingCase
           fluid_density_by_summation(water_block_inner, water_wall_contact),
           fluid_advection_time_step(water_block, U_ref),
           fluid_acoustic_time_step(water_block),
+          water_mechanical_energy(water_block, gravity),
           body_states_recording(sph_system),
           restart_io(sph_system),
           write_water_mechanical_energy(water_block, gravity),
@@ -193,6 +197,12 @@ class Environment : public PreSettingCase
         body_states_recording.writeToFile();
         write_water_mechanical_energy.writeToFile(sph_system.RestartStep());
         write_recorded_water_pressure.writeToFile(sph_system.RestartStep());
+        number_of_iterations = sph_system.RestartStep();
+        //----------------------------------------------------------------------
+        //	Expose data to python.
+        //----------------------------------------------------------------------
+        exposeBody(water_block);
+        exposeReducedQuantity("TotalMechanicalEnergy", water_mechanical_energy);
     }
 
     virtual ~Environment(){};
@@ -204,69 +214,70 @@ class Environment : public PreSettingCase
         return 1;
     }
     //----------------------------------------------------------------------
-    //	Main loop starts here.
+    //	One time step of the main loop, also used for control from python.
     //----------------------------------------------------------------------
-    void runCase(Real End_time)
+    virtual Real advanceStep() override
     {
-        /** Set restart number of iterations. */
-        size_t number_of_iterations = sph_system.RestartStep();
-        while (GlobalStaticVariables::physical_time_ < End_time)
+        /** outer loop for dual-time criteria time-stepping. */
+        time_instance = TickCount::now();
+        Real advection_dt = fluid_advection_time_step.exec();
+        fluid_density_by_summation.exec();
+        interval_computing_time_step += TickCount::now() - time_instance;
+
+        time_instance = TickCount::now();
+        Real relaxation_time = 0.0;
+        Real acoustic_dt = 0.0;
+        while (relaxation_time < advection_dt)
         {
-            Real integration_time = 0.0;
-            /** Integrate time (loop) until the next output time. */
-            while (integration_time < output_interval)
-            {
-                /** outer loop for dual-time criteria time-stepping. */
-                time_instance = TickCount::now();
-                Real advection_dt = fluid_advection_time_step.exec();
-                fluid_density_by_summation.exec();
-                interval_computing_time_step += TickCount::now() - time_instance;
+            /** inner loop for dual-time criteria time-stepping.  */
+            acoustic_dt = fluid_acoustic_time_step.exec();
+            fluid_pressure_relaxation.exec(acoustic_dt);
+            fluid_density_relaxation.exec(acoustic_dt);
+            relaxation_time += acoustic_dt;
+            GlobalStaticVariables::physical_time_ += acoustic_dt;
+        }
+        interval_computing_fluid_pressure_relaxation += TickCount::now() - time_instance;
 
-                time_instance = TickCount::now();
-                Real relaxation_time = 0.0;
-                Real acoustic_dt = 0.0;
-                while (relaxation_time < advection_dt)
-                {
-                    /** inner loop for dual-time criteria time-stepping.  */
-                    acoustic_dt = fluid_acoustic_time_step.exec();
-                    fluid_pressure_relaxation.exec(acoustic_dt);
-                    fluid_density_relaxation.exec(acoustic_dt);
-                    relaxation_time += acoustic_dt;
-                    integration_time += acoustic_dt;
-                    GlobalStaticVariables::physical_time_ += acoustic_dt;
-                }
-                interval_computing_fluid_pressure_relaxation += TickCount::now() - time_instance;
+        /** screen output, write body reduced values and restart files  */
+        if (number_of_iterations % screen_output_interval == 0)
+        {
+            std::cout << std::fixed << std::setprecision(9) << "N=" << number_of_iterations << "	Time = "
+                      << GlobalStaticVariables::physical_time_
+                      << "	advection_dt = " << advection_dt << "	acoustic_dt = " << acoustic_dt << "\n";
 
-                /** screen output, write body reduced values and restart files  */
-                if (number_of_iterations % screen_output_interval == 0)
-                {
-                    std::cout << std::fixed << std::setprecision(9) << "N=" << number_of_iterations << "	Time = "
-                              << GlobalStaticVariables::physical_time_
-                              << "	advection_dt = " << advection_dt << "	acoustic_dt = " << acoustic_dt << "\n";
+            if (number_of_iterations % observation_sample_interval == 0 && number_of_iterations != sph_system.RestartStep())
+            {
+                write_water_mechanical_energy.writeToFile(number_of_iterations);
+                write_recorded_water_pressure.writeToFile(number_of_iterations);
+            }
+            if (number_of_iterations % restart_output_interval == 0)
+                restart_io.writeToFile(number_of_iterations);
+        }
+        number_of_iterations++;
 
-                    if (number_of_iterations % observation_sample_interval == 0 && number_of_iterations != sph_system.RestartStep())
-                    {
-                        write_water_mechanical_energy.writeToFile(number_of_iterations);
-                        write_recorded_water_pressure.writeToFile(number_of_iterations);
-                    }
-                    if (number_of_iterations % restart_output_interval == 0)
-                        restart_io.writeToFile(number_of_iterations);
-                }
-                number_of_iterations++;
+        /** Update cell linked list and configuration. */
+        time_instance = TickCount::now();
+        water_block.updateCellLinkedListWithParticleSort(100);
+        water_block_complex.updateConfiguration();
+        fluid_observer_contact.updateConfiguration();
+        interval_updating_configuration += TickCount::now() - time_instance;
 
-                /** Update cell linked list and configuration. */
-                time_instance = TickCount::now();
-                water_block.updateCellLinkedListWithParticleSort(100);
-                water_block_complex.updateConfiguration();
-                fluid_observer_contact.updateConfiguration();
-                interval_updating_configuration += TickCount::now() - time_instance;
-            }
+        return relaxation_time;
+    }
 
-            body_states_recording.writeToFile();
-            TickCount t2 = TickCount::now();
-            TickCount t3 = TickCount::now();
-            interval += t3 - t2;
-        }
+    virtual void writeOutput() override
+    {
+        TickCount t2 = TickCount::now();
+        body_states_recording.writeToFile();
+        TickCount t3 = TickCount::now();
+        interval += t3 - t2;
+    }
+    //----------------------------------------------------------------------
+    //	Main loop starts here.
+    //----------------------------------------------------------------------
+    void runCase(Real End_time)
+    {
+        advanceToTime(End_time);
         TickCount t4 = TickCount::now();
 
         TickCount::interval_t tt;
@@ -299,8 +310,9 @@ class Environment : public PreSettingCase
 /** test_2d_dambreak_python should be same with the project name */
 PYBIND11_MODULE(test_2d_dambreak_python, m)
 {
-    py::class_<Environment>(m, "dambreak_from_sph_cpp")
-        .def(py::init<const int &>())
+    py::class_<Environment> environment(m, "dambreak_from_sph_cpp");
+    environment.def(py::init<const int &>())
         .def("CmakeTest", &Environment::cmakeTest)
         .def("RunCase", &Environment::runCase);
+    bindSimulationControl(environment);
 }
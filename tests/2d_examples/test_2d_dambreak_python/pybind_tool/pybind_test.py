@@ -3,6 +3,7 @@ import os
 import sys
 import platform
 import argparse
+import numpy as np
 # add dynamic link library or shared object to python env
 # attention: match current python version with the version exposing the cpp code
 sys_str = platform.system()
@@ -23,6 +24,30 @@ sys.path.append(path)
 import test_2d_dambreak_python as test_2d
 
 
+def check_particle_data_views(project):
+    # the views have the layout of the particle data
+    number_of_particles = project.NumberOfParticles("WaterBody")
+    pressure = project.GetParticleData("WaterBody", "Pressure")
+    assert pressure.shape == (number_of_particles,), pressure.shape
+    assert pressure.strides == (pressure.itemsize,), pressure.strides
+    position = project.GetParticleData("WaterBody", "Position")
+    assert position.shape == (number_of_particles, 2), position.shape
+    assert position.strides == (2 * position.itemsize, position.itemsize), position.strides
+    assert np.shares_memory(pressure, project.GetParticleData("WaterBody", "Pressure"))
+
+    # a write through a view is seen by the reduce dynamics in cpp
+    mass = project.GetParticleData("WaterBody", "Mass")
+    velocity = project.GetParticleData("WaterBody", "Velocity")
+    mechanical_energy = project.GetReducedQuantity("TotalMechanicalEnergy")
+    kinetic_energy = 0.5 * np.sum(mass * np.sum(velocity * velocity, axis=1))
+    assert kinetic_energy > 0.0
+    velocity[:] = 0.0
+    potential_energy = project.GetReducedQuantity("TotalMechanicalEnergy")
+    assert abs(potential_energy - (mechanical_energy - kinetic_energy)) <= 1.0e-8 * abs(mechanical_energy), \
+        (mechanical_energy, kinetic_energy, potential_energy)
+    print("Particle data views are checked.")
+
+
 def run_case():
     parser = argparse.ArgumentParser()
     # set case parameters
@@ -34,6 +59,11 @@ def run_case():
     project = test_2d.dambreak_from_sph_cpp(case.restart_step)
     if project.CmakeTest() == 1:
         project.RunCase(case.end_time)
+        # access the particle data without copy and the reduced quantities without output files
+        pressure = project.GetParticleData("WaterBody", "Pressure")
+        print("Maximum pressure of WaterBody: ", pressure.max())
+        print("Reduced quantities: ", project.GetReducedQuantities())
+        check_particle_data_views(project)
     else:
         print("check path: ", path)
         
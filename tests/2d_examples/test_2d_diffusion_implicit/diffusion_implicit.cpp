@@ -0,0 +1,169 @@
+/**
+ * @file 	diffusion_implicit.cpp
+ * @brief 	Implicit diffusion with a time step much larger than the explicit stability limit
+ *          is compared with the explicit Runge-Kutta solution of the same body.
+ * @author 	Chi Zhang and Xiangyu Hu
+ */
+#include "sphinxsys.h" //SPHinXsys Library
+#include <gtest/gtest.h>
+using namespace SPH; // Namespace cite here
+//----------------------------------------------------------------------
+//	Basic geometry parameters and numerical setup.
+//----------------------------------------------------------------------
+Real L = 1.0;
+Real H = 0.2;
+Real resolution_ref = H / 8.0;
+BoundingBox system_domain_bounds(Vec2d(0.0, 0.0), Vec2d(L, H));
+//----------------------------------------------------------------------
+//	Basic parameters for material properties.
+//----------------------------------------------------------------------
+Real diffusion_coeff = 1.0;
+//----------------------------------------------------------------------
+//	Geometric shapes used in the case.
+//----------------------------------------------------------------------
+class DiffusionBlock : public MultiPolygonShape
+{
+  public:
+    explicit DiffusionBlock(const std::string &shape_name) : MultiPolygonShape(shape_name)
+    {
+        std::vector<Vecd> shape;
+        shape.push_back(Vecd(0.0, 0.0));
+        shape.push_back(Vecd(0.0, H));
+        shape.push_back(Vecd(L, H));
+        shape.push_back(Vecd(L, 0.0));
+        shape.push_back(Vecd(0.0, 0.0));
+        multi_polygon_.addAPolygon(shape, ShapeBooleanOps::add);
+    }
+};
+//----------------------------------------------------------------------
+//	Application dependent initial condition.
+//----------------------------------------------------------------------
+class DiffusionInitialCondition : public LocalDynamics, public DataDelegateSimple
+{
+  public:
+    explicit DiffusionInitialCondition(SPHBody &sph_body)
+        : LocalDynamics(sph_body), DataDelegateSimple(sph_body),
+          pos_(*particles_->getVariableDataByName<Vecd>("Position")),
+          phi_(*particles_->registerSharedVariable<Real>("Phi")){};
+
+    void update(size_t index_i, Real dt)
+    {
+        phi_[index_i] = 1.0 + cos(Pi * pos_[index_i][0] / L);
+    };
+
+  protected:
+    StdLargeVec<Vecd> &pos_;
+    StdLargeVec<Real> &phi_;
+};
+//----------------------------------------------------------------------
+//	Specify diffusion relaxation methods.
+//----------------------------------------------------------------------
+using ExplicitDiffusionRelaxation =
+    DiffusionRelaxationRK2<DiffusionRelaxation<Inner<KernelGradientInner>, BaseDiffusion>>;
+using ImplicitDiffusionRelaxation =
+    DiffusionBodyRelaxationImplicit<BaseDiffusion, KernelGradientInner, KernelGradientContact>;
+//----------------------------------------------------------------------
+//	Test case.
+//----------------------------------------------------------------------
+void diffusion_implicit(Real implicit_weight, Real implicit_time_step)
+{
+    //----------------------------------------------------------------------
+    //	Build up the environment of a SPHSystem.
+    //----------------------------------------------------------------------
+    SPHSystem sph_system(system_domain_bounds, resolution_ref);
+    //----------------------------------------------------------------------
+    //	Creating bodies, materials and particles.
+    //----------------------------------------------------------------------
+    SolidBody explicit_body(sph_system, makeShared<DiffusionBlock>("ExplicitBlock"));
+    IsotropicDiffusion *explicit_diffusion =
+        explicit_body.defineMaterial<IsotropicDiffusion>("Phi", diffusion_coeff);
+    explicit_body.generateParticles<BaseParticles, Lattice>();
+
+    SolidBody implicit_body(sph_system, makeShared<DiffusionBlock>("ImplicitBlock"));
+    IsotropicDiffusion *implicit_diffusion =
+        implicit_body.defineMaterial<IsotropicDiffusion>("Phi", diffusion_coeff);
+    implicit_body.generateParticles<BaseParticles, Lattice>();
+    //----------------------------------------------------------------------
+    //	Define body relation map.
+    //----------------------------------------------------------------------
+    InnerRelation explicit_body_inner(explicit_body);
+    InnerRelation implicit_body_inner(implicit_body);
+    //----------------------------------------------------------------------
+    //	Define the main numerical methods used in the simulation.
+    //----------------------------------------------------------------------
+    ExplicitDiffusionRelaxation explicit_relaxation(explicit_body_inner, explicit_diffusion);
+    ImplicitDiffusionRelaxation implicit_relaxation(ConstructorArgs(implicit_body_inner, implicit_diffusion));
+    implicit_relaxation.setImplicitWeight(implicit_weight);
+    implicit_relaxation.setSolverTolerance(1.0e-8, 500);
+
+    SimpleDynamics<DiffusionInitialCondition> explicit_initial_condition(explicit_body);
+    SimpleDynamics<DiffusionInitialCondition> implicit_initial_condition(implicit_body);
+    GetDiffusionTimeStepSize get_time_step_size(explicit_body, *explicit_diffusion);
+    //----------------------------------------------------------------------
+    //	Prepare the simulation with cell linked list, configuration
+    //	and case specified initial condition.
+    //----------------------------------------------------------------------
+    sph_system.initializeSystemCellLinkedLists();
+    sph_system.initializeSystemConfigurations();
+    explicit_initial_condition.exec();
+    implicit_initial_condition.exec();
+    //----------------------------------------------------------------------
+    //	Integrate both bodies to the same end time.
+    //----------------------------------------------------------------------
+    Real end_time = 0.05;
+    Real explicit_time_step = get_time_step_size.exec();
+    ASSERT_GT(implicit_time_step, 10.0 * explicit_time_step);
+
+    Real physical_time = 0.0;
+    size_t implicit_iterations = 0;
+    while (physical_time < end_time - TinyReal)
+    {
+        Real dt = SMIN(implicit_time_step, end_time - physical_time);
+        implicit_relaxation.exec(dt);
+        implicit_iterations += implicit_relaxation.NumberOfIterations();
+        EXPECT_LT(implicit_relaxation.NumberOfIterations(), 500);
+
+        Real integration_time = 0.0;
+        while (integration_time < dt - TinyReal)
+        {
+            Real explicit_dt = SMIN(explicit_time_step, dt - integration_time);
+            explicit_relaxation.exec(explicit_dt);
+            integration_time += explicit_dt;
+        }
+        physical_time += dt;
+    }
+    //----------------------------------------------------------------------
+    //	Both bodies have identical particle distributions.
+    //----------------------------------------------------------------------
+    BaseParticles &explicit_particles = explicit_body.getBaseParticles();
+    BaseParticles &implicit_particles = implicit_body.getBaseParticles();
+    ASSERT_EQ(explicit_particles.TotalRealParticles(), implicit_particles.TotalRealParticles());
+    StdLargeVec<Real> &explicit_phi = *explicit_particles.getVariableDataByName<Real>("Phi");
+    StdLargeVec<Real> &implicit_phi = *implicit_particles.getVariableDataByName<Real>("Phi");
+    Real max_difference = 0.0;
+    for (size_t i = 0; i != explicit_particles.TotalRealParticles(); ++i)
+    {
+        max_difference = SMAX(max_difference, ABS(explicit_phi[i] - implicit_phi[i]));
+    }
+    std::cout << "Total BiCGSTAB iterations: " << implicit_iterations
+              << "\t Maximum difference to explicit solution: " << max_difference << std::endl;
+    EXPECT_LT(max_difference, 2.0e-2);
+}
+
+TEST(diffusion_implicit, backward_euler)
+{
+    diffusion_implicit(1.0, 5.0e-3);
+}
+
+TEST(diffusion_implicit, crank_nicolson)
+{
+    diffusion_implicit(0.5, 5.0e-3);
+}
+//----------------------------------------------------------------------
+//	Main program starts here.
+//----------------------------------------------------------------------
+int main(int ac, char *av[])
+{
+    testing::InitGoogleTest(&ac, av);
+    return RUN_ALL_TESTS();
+}
@@ -52,6 +52,7 @@ int main(int ac, char *av[])
     //----------------------------------------------------------------------
     InnerRelation water_block_inner(water_block);
     ContactRelation water_block_contact(water_block, {&cylinder});
+    water_block_contact.useLevelSetFilter(cylinder); // the cylinder is fixed
     ContactRelation cylinder_contact(cylinder, {&water_block});
     ContactRelation fluid_observer_contact(fluid_observer, {&water_block});
     //----------------------------------------------------------------------
@@ -19,15 +19,18 @@ else:
     path_2 = 'lib'
 path = os.path.join(path_1, path_2)
 sys.path.append(path)
+# reader of the binary time series of the observed quantities
+sys.path.append(os.path.abspath('../../../../../PythonScriptStore/RegressionTest'))
+from time_series_reader import TimeSeries
 
 # change import depending on the project name
 import test_3d_thin_plate_python as test_3d
 
 # set file names
-dat_file_name = 'PlateObserver_Position.dat'
+observer_file_name = 'PlateObserver_Position.bin'
 vtp_file_name_0 = 'PlateBody_0000000000.vtp'
 vtp_file_name_1 = 'PlateBody_0000000001.vtp'
-dat_split = dat_file_name.split('.')[0]
+observer_split = observer_file_name.split('.')[0]
 vtp_split_0 = vtp_file_name_0.split('.')[0]
 vtp_split_1 = vtp_file_name_1.split('.')[0]
 
@@ -46,18 +49,17 @@ def run_case(value):
         print("check path: ", path)
 
 def net_displacement(file_path, output_file):
-    with open(file_path, 'r') as infile:
-        lines = infile.readlines()
-    
-    first_line_values = lines[1].strip().split()
-    first_value = float(first_line_values[3])
-    
-    last_line_values = lines[-1].strip().split()
-    last_time = float(last_line_values[0])
-    last_value = float(last_line_values[3])
+    time_series = TimeSeries(file_path)
+    # position of the first observation point
+    positions = time_series.column('Position[0]')
+
+    first_value = positions[0][2]
+
+    last_time = time_series.times[-1]
+    last_value = positions[-1][2]
     displacement_z = last_value - first_value
-    
-    displacement_x = float(last_line_values[1]) - float(first_line_values[1])
+
+    displacement_x = positions[-1][0] - positions[0][0]
     
     with open(output_file, 'a') as outfile:
         outfile.write("run_time = " + str(last_time) + ", displacement in Z direction = " + str(displacement_z) + '\n')
@@ -66,8 +68,8 @@ def net_displacement(file_path, output_file):
 
 # copy vtp files from the output folder to the multiple_runs_output folder
 def copy_files(output_folder):
-    source_files = ['output/PlateObserver_Position.dat', 'output/PlateBody_0000000000.vtp', 'output/PlateBody_0000000001.vtp']
-    destination_files = [output_folder + dat_file_name, output_folder + vtp_file_name_0, output_folder + vtp_file_name_1]
+    source_files = ['output/PlateObserver_Position.bin', 'output/PlateBody_0000000000.vtp', 'output/PlateBody_0000000001.vtp']
+    destination_files = [output_folder + observer_file_name, output_folder + vtp_file_name_0, output_folder + vtp_file_name_1]
 
     for index, source_file in enumerate(source_files):
         # Read the content of the source file
@@ -79,9 +81,9 @@ def copy_files(output_folder):
 
 # rename the files in the multiple_runs_output folder
 def rename_files(value, output_folder):
-    old_file_name = [output_folder + dat_file_name, output_folder + vtp_file_name_0, output_folder + vtp_file_name_1]
+    old_file_name = [output_folder + observer_file_name, output_folder + vtp_file_name_0, output_folder + vtp_file_name_1]
     # new_file_name = [(output_folder + 'PlateObserver_Position_' + value + '.dat'), (output_folder + 'PlateBody_0000000000_' + value + '.vtp'), (output_folder + 'PlateBody_0000000001_' + value + '.vtp')]
-    new_file_name = [(output_folder + dat_split + '_' + value + '.dat'), (output_folder + vtp_split_0 + '_' + value + '.vtp'), (output_folder + vtp_split_1 + '_' + value + '.vtp')]
+    new_file_name = [(output_folder + observer_split + '_' + value + '.bin'), (output_folder + vtp_split_0 + '_' + value + '.vtp'), (output_folder + vtp_split_1 + '_' + value + '.vtp')]
     
     for index, file in enumerate(old_file_name):
         try:
@@ -93,7 +95,7 @@ def rename_files(value, output_folder):
 
 if __name__ == "__main__":
 
-    file_path = 'output/PlateObserver_Position.dat'
+    file_path = 'output/PlateObserver_Position.bin'
     output_folder = 'multiple_runs_output/'
     output_file = output_folder + 'Displacements.dat'
     #values = [6.5, 12.5, 25, 50, 75, 100, 125, 150, 175, 200]
@@ -125,7 +127,7 @@ if __name__ == "__main__":
     for index,value in enumerate(values):
         print(f"For loading_factor = {value} :")
         # new_file_name = [(output_folder + 'PlateObserver_Position_' +  + '.dat'), (output_folder + 'PlateBody_0000000000_' +  + '.vtp'), (output_folder + 'PlateBody_0000000001_' + str(index) + '.vtp')]
-        new_file_name = [(output_folder + dat_split + '_' + str(index) + '.dat'), (output_folder + vtp_split_0 + '_' + str(index) + '.vtp'), (output_folder + vtp_split_1 + '_' + str(index) + '.vtp')]
+        new_file_name = [(output_folder + observer_split + '_' + str(index) + '.bin'), (output_folder + vtp_split_0 + '_' + str(index) + '.vtp'), (output_folder + vtp_split_1 + '_' + str(index) + '.vtp')]
         print("\t" + new_file_name[0])
         print("\t" + new_file_name[1])
         print("\t" + new_file_name[2])
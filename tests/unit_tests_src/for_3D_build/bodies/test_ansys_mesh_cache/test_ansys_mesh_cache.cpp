@@ -0,0 +1,72 @@
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+std::string mesh_fullpath = "./input/Channel_ICEM.msh";
+BoundingBox system_domain_bounds(Vec3d(-0.3, 0.0, 0.0), Vec3d(0.469846, 0.5, 0.03));
+
+void expectSameMesh(ANSYSMesh &mesh, ANSYSMesh &reference_mesh)
+{
+    EXPECT_EQ(mesh.MinMeshEdge(), reference_mesh.MinMeshEdge());
+    EXPECT_EQ(mesh.types_of_boundary_condition_, reference_mesh.types_of_boundary_condition_);
+    EXPECT_EQ(mesh.node_coordinates_, reference_mesh.node_coordinates_);
+    EXPECT_EQ(mesh.elements_centroids_, reference_mesh.elements_centroids_);
+    EXPECT_EQ(mesh.elements_volumes_, reference_mesh.elements_volumes_);
+    EXPECT_EQ(mesh.elements_nodes_connection_, reference_mesh.elements_nodes_connection_);
+    EXPECT_EQ(mesh.mesh_topology_, reference_mesh.mesh_topology_);
+}
+
+class test_ANSYSMeshCache : public testing::Test
+{
+  protected:
+    std::string cache_folder_ = "./cache/mesh";
+    UniquePtr<ANSYSMesh> parsed_mesh_;
+
+    void SetUp() override
+    {
+        fs::remove_all(cache_folder_);
+        parsed_mesh_ = makeUnique<ANSYSMesh>(mesh_fullpath);
+        ASSERT_FALSE(parsed_mesh_->node_coordinates_.empty());
+        ASSERT_FALSE(parsed_mesh_->mesh_topology_.empty());
+    }
+};
+
+TEST_F(test_ANSYSMeshCache, test_offByDefault)
+{
+    SPHSystem sph_system(system_domain_bounds, parsed_mesh_->MinMeshEdge());
+    sph_system.setIOEnvironment();
+    EXPECT_FALSE(sph_system.MeshCache());
+    ANSYSMesh mesh(sph_system, mesh_fullpath);
+    EXPECT_FALSE(fs::exists(cache_folder_));
+    expectSameMesh(mesh, *parsed_mesh_);
+}
+
+TEST_F(test_ANSYSMeshCache, test_loadFromCache)
+{
+    SPHSystem sph_system(system_domain_bounds, parsed_mesh_->MinMeshEdge());
+    sph_system.setMeshCache(true);
+    sph_system.setIOEnvironment();
+    EXPECT_EQ(cache_folder_, sph_system.getIOEnvironment().cache_folder_ + "/mesh");
+
+    // the first mesh is parsed and written to the cache
+    testing::internal::CaptureStdout();
+    ANSYSMesh first_mesh(sph_system, mesh_fullpath);
+    EXPECT_EQ(testing::internal::GetCapturedStdout().find("is loaded from"), std::string::npos);
+    ASSERT_TRUE(fs::exists(cache_folder_));
+    EXPECT_EQ(std::distance(fs::directory_iterator(cache_folder_), fs::directory_iterator{}), 1);
+    expectSameMesh(first_mesh, *parsed_mesh_);
+
+    // the second mesh is loaded from the cache
+    testing::internal::CaptureStdout();
+    ANSYSMesh second_mesh(sph_system, mesh_fullpath);
+    EXPECT_NE(testing::internal::GetCapturedStdout().find("is loaded from"), std::string::npos);
+    EXPECT_EQ(std::distance(fs::directory_iterator(cache_folder_), fs::directory_iterator{}), 1);
+    expectSameMesh(second_mesh, *parsed_mesh_);
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
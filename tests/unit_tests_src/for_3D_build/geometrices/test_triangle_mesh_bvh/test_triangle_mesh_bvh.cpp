@@ -0,0 +1,137 @@
+#include "triangle_mesh_bvh.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+class TriangleMeshBVHSphere : public testing::Test
+{
+  protected:
+    TriangleMeshBVH bvh_;
+    StdVec<Vec3d> probe_points_;
+
+    void SetUp() override
+    {
+        // unit sphere tessellated by latitude and longitude
+        int number_of_longitudes = 64;
+        int number_of_latitudes = 32;
+        StdVec<Vec3d> vertices;
+        StdVec<Array3i> faces;
+        for (int j = 0; j <= number_of_latitudes; ++j)
+            for (int i = 0; i != number_of_longitudes; ++i)
+            {
+                Real theta = Pi * (Real)j / (Real)number_of_latitudes;
+                Real phi = 2.0 * Pi * (Real)i / (Real)number_of_longitudes;
+                vertices.push_back(Vec3d(sin(theta) * cos(phi), sin(theta) * sin(phi), cos(theta)));
+            }
+        for (int j = 0; j != number_of_latitudes; ++j)
+            for (int i = 0; i != number_of_longitudes; ++i)
+            {
+                int a = j * number_of_longitudes + i;
+                int b = j * number_of_longitudes + (i + 1) % number_of_longitudes;
+                int c = a + number_of_longitudes;
+                int d = b + number_of_longitudes;
+                faces.push_back(Array3i(a, c, b));
+                faces.push_back(Array3i(b, c, d));
+            }
+        bvh_.build(vertices, faces);
+
+        for (int k = -7; k <= 7; ++k)
+            for (int j = -7; j <= 7; ++j)
+                for (int i = -7; i <= 7; ++i)
+                {
+                    probe_points_.push_back(0.2 * Vec3d((Real)i, (Real)j, (Real)k) + Vec3d(0.013, 0.007, 0.011));
+                }
+    }
+};
+
+TEST_F(TriangleMeshBVHSphere, test_findClosestPoint)
+{
+    for (const Vec3d &probe_point : probe_points_)
+    {
+        Real distance = (bvh_.findClosestPoint(probe_point) - probe_point).norm();
+        EXPECT_NEAR(fabs(probe_point.norm() - 1.0), distance, 0.01);
+    }
+}
+
+TEST_F(TriangleMeshBVHSphere, test_checkContain)
+{
+    for (const Vec3d &probe_point : probe_points_)
+    {
+        if (fabs(probe_point.norm() - 1.0) > 0.01)
+        {
+            EXPECT_EQ(probe_point.norm() < 1.0, bvh_.checkContain(probe_point));
+        }
+    }
+}
+
+TEST_F(TriangleMeshBVHSphere, test_batch_queries)
+{
+    StdVec<Vec3d> closest_points;
+    StdVec<int> is_contained;
+    bvh_.findClosestPoints(probe_points_, closest_points);
+    bvh_.checkContains(probe_points_, is_contained);
+    for (size_t i = 0; i != probe_points_.size(); ++i)
+    {
+        EXPECT_EQ(bvh_.findClosestPoint(probe_points_[i]), closest_points[i]);
+        EXPECT_EQ(bvh_.checkContain(probe_points_[i]), is_contained[i] != 0);
+    }
+}
+
+TEST_F(TriangleMeshBVHSphere, test_isClosed)
+{
+    EXPECT_TRUE(bvh_.isClosed());
+}
+
+TEST(TriangleMeshBVHOpenSurface, test_checkContain)
+{
+    // a square with its normal in z direction, not closed
+    StdVec<Vec3d> vertices = {Vec3d(-1.0, -1.0, 0.0), Vec3d(1.0, -1.0, 0.0),
+                              Vec3d(1.0, 1.0, 0.0), Vec3d(-1.0, 1.0, 0.0)};
+    StdVec<Array3i> faces = {Array3i(0, 1, 2), Array3i(0, 2, 3)};
+    TriangleMeshBVH bvh;
+    bvh.build(vertices, faces);
+    EXPECT_FALSE(bvh.isClosed());
+
+    // the side of the closest face decides, also beyond the bounds of the mesh
+    EXPECT_TRUE(bvh.checkContain(Vec3d(0.3, 0.2, -0.1)));
+    EXPECT_TRUE(bvh.checkContain(Vec3d(0.3, 0.2, -5.0)));
+    EXPECT_FALSE(bvh.checkContain(Vec3d(0.3, 0.2, 0.1)));
+    EXPECT_FALSE(bvh.checkContain(Vec3d(-0.4, 0.7, 5.0)));
+}
+
+TEST(TriangleMeshBVHEmpty, test_queries)
+{
+    // vertices without faces give no hierarchy to traverse
+    StdVec<Vec3d> vertices = {Vec3d(0.0, 0.0, 0.0), Vec3d(1.0, 0.0, 0.0), Vec3d(0.0, 1.0, 0.0)};
+    StdVec<Array3i> faces;
+    TriangleMeshBVH bvh;
+    bvh.build(vertices, faces);
+    EXPECT_FALSE(bvh.isBuilt());
+    EXPECT_FALSE(bvh.isClosed());
+    EXPECT_EQ(bvh.NumberOfFaces(), size_t(0));
+
+    StdVec<Vec3d> probe_points = {Vec3d(0.1, 0.1, 0.0), Vec3d(-2.0, 3.0, 1.0)};
+    for (const Vec3d &probe_point : probe_points)
+    {
+        int face_index = 0;
+        EXPECT_EQ(bvh.findClosestPoint(probe_point, face_index), probe_point);
+        EXPECT_EQ(face_index, -1);
+        EXPECT_FALSE(bvh.checkContain(probe_point));
+    }
+
+    StdVec<int> is_contained;
+    bvh.checkContains(probe_points, is_contained);
+    EXPECT_EQ(is_contained, StdVec<int>(probe_points.size(), 0));
+
+    // a rebuild with faces after the empty one works as a fresh build
+    faces.push_back(Array3i(0, 1, 2));
+    bvh.build(vertices, faces);
+    EXPECT_TRUE(bvh.isBuilt());
+    EXPECT_NEAR((bvh.findClosestPoint(Vec3d(0.2, 0.2, 0.5)) - Vec3d(0.2, 0.2, 0.0)).norm(), 0.0, 1.0e-12);
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
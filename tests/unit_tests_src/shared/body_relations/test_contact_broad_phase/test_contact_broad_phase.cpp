@@ -0,0 +1,174 @@
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+Real resolution_ref = 0.025;
+BoundingBox system_domain_bounds(Vec3d(-1.0, -0.5, -0.5), Vec3d(1.0, 0.5, 0.5));
+Vec3d halfsize_cube(0.1, 0.1, 0.1);
+
+/** the sorted neighbor indices of each particle */
+StdVec<StdVec<size_t>> sortedNeighbors(ParticleConfiguration &configuration, size_t total_particles)
+{
+    StdVec<StdVec<size_t>> neighbors(total_particles);
+    for (size_t i = 0; i != total_particles; ++i)
+    {
+        Neighborhood &neighborhood = configuration[i];
+        neighbors[i].assign(neighborhood.j_.begin(), neighborhood.j_.begin() + neighborhood.current_size_);
+        std::sort(neighbors[i].begin(), neighbors[i].end());
+    }
+    return neighbors;
+}
+
+size_t countNeighbors(ParticleConfiguration &configuration, size_t total_particles)
+{
+    size_t number_of_neighbors = 0;
+    for (size_t i = 0; i != total_particles; ++i)
+        number_of_neighbors += configuration[i].current_size_;
+    return number_of_neighbors;
+}
+
+class test_ContactBroadPhase : public testing::Test
+{
+  protected:
+    SPHSystem sph_system_{system_domain_bounds, resolution_ref};
+    // the separated cube is far from the others, the middle cube touches the right cube
+    // by a shared face and overlaps the upper cube
+    SolidBody separated_cube_{sph_system_, makeShared<TransformShape<GeometricShapeBox>>(
+                                               Transform(Vec3d(-0.6, 0.0, 0.0)), halfsize_cube, "SeparatedCube")};
+    SolidBody middle_cube_{sph_system_, makeShared<TransformShape<GeometricShapeBox>>(
+                                            Transform(Vec3d(0.0, 0.0, 0.0)), halfsize_cube, "MiddleCube")};
+    SolidBody right_cube_{sph_system_, makeShared<TransformShape<GeometricShapeBox>>(
+                                           Transform(Vec3d(0.2, 0.0, 0.0)), halfsize_cube, "RightCube")};
+    SolidBody upper_cube_{sph_system_, makeShared<TransformShape<GeometricShapeBox>>(
+                                           Transform(Vec3d(0.0, 0.15, 0.0)), halfsize_cube, "UpperCube")};
+
+    void SetUp() override
+    {
+        for (SolidBody *cube : {&separated_cube_, &middle_cube_, &right_cube_, &upper_cube_})
+        {
+            cube->defineMaterial<Solid>();
+            cube->generateParticles<BaseParticles, Lattice>();
+        }
+        sph_system_.initializeSystemCellLinkedLists();
+    }
+};
+
+TEST_F(test_ContactBroadPhase, test_overlappingPairs)
+{
+    ContactBroadPhase broad_phase({&separated_cube_, &middle_cube_, &right_cube_, &upper_cube_});
+    broad_phase.update();
+
+    EXPECT_FALSE(broad_phase.isOverlapping(separated_cube_, middle_cube_));
+    EXPECT_FALSE(broad_phase.isOverlapping(separated_cube_, right_cube_));
+    EXPECT_FALSE(broad_phase.isOverlapping(separated_cube_, upper_cube_));
+    EXPECT_TRUE(broad_phase.isOverlapping(middle_cube_, right_cube_));
+    EXPECT_TRUE(broad_phase.isOverlapping(right_cube_, middle_cube_));
+    EXPECT_TRUE(broad_phase.isOverlapping(middle_cube_, upper_cube_));
+    EXPECT_TRUE(broad_phase.isOverlapping(separated_cube_, separated_cube_));
+
+    // the boxes enclose the particles inflated by the cutoff radius
+    Real cutoff_radius = middle_cube_.sph_adaptation_->getKernel()->CutOffRadius();
+    BoundingBox middle_box = broad_phase.getBoundingBox(middle_cube_);
+    Vec3d particle_bound = halfsize_cube - 0.5 * resolution_ref * Vec3d::Ones();
+    EXPECT_LT((middle_box.first_ + particle_bound + cutoff_radius * Vec3d::Ones()).norm(), 1.0e-12);
+    EXPECT_LT((middle_box.second_ - particle_bound - cutoff_radius * Vec3d::Ones()).norm(), 1.0e-12);
+}
+
+TEST_F(test_ContactBroadPhase, test_activeContacts)
+{
+    ContactBroadPhase broad_phase({&separated_cube_, &middle_cube_, &right_cube_, &upper_cube_});
+    ContactRelation middle_contact(middle_cube_, {&separated_cube_, &right_cube_, &upper_cube_});
+    ContactRelation separated_contact(separated_cube_, {&middle_cube_, &right_cube_});
+    broad_phase.subscribeRelation(middle_contact);
+    broad_phase.subscribeRelation(separated_contact);
+    // the relations not subscribed search all contact bodies
+    ContactRelation middle_reference_contact(middle_cube_, {&separated_cube_, &right_cube_, &upper_cube_});
+    ContactRelation separated_reference_contact(separated_cube_, {&middle_cube_, &right_cube_});
+
+    size_t middle_particles = middle_cube_.getBaseParticles().TotalRealParticles();
+    size_t separated_particles = separated_cube_.getBaseParticles().TotalRealParticles();
+    auto updateConfigurations = [&]()
+    {
+        broad_phase.update();
+        middle_contact.updateConfiguration();
+        separated_contact.updateConfiguration();
+        middle_reference_contact.updateConfiguration();
+        separated_reference_contact.updateConfiguration();
+    };
+
+    // all contacts are active before the first update
+    EXPECT_TRUE(separated_contact.isContactActive(0));
+    EXPECT_TRUE(separated_contact.hasActiveContact());
+
+    updateConfigurations();
+    EXPECT_FALSE(middle_contact.isContactActive(0));
+    EXPECT_TRUE(middle_contact.isContactActive(1));
+    EXPECT_TRUE(middle_contact.isContactActive(2));
+    EXPECT_TRUE(middle_contact.hasActiveContact());
+    EXPECT_EQ(countNeighbors(middle_contact.contact_configuration_[0], middle_particles), size_t(0));
+    for (size_t k = 1; k != 3; ++k)
+    {
+        EXPECT_GT(countNeighbors(middle_contact.contact_configuration_[k], middle_particles), size_t(0));
+        EXPECT_EQ(sortedNeighbors(middle_contact.contact_configuration_[k], middle_particles),
+                  sortedNeighbors(middle_reference_contact.contact_configuration_[k], middle_particles));
+    }
+
+    // the separated cube has no active contact, but the dynamics runs once more to clear the contact forces
+    EXPECT_FALSE(separated_contact.isContactActive(0));
+    EXPECT_FALSE(separated_contact.isContactActive(1));
+    EXPECT_TRUE(separated_contact.hasActiveContact());
+    updateConfigurations();
+    EXPECT_FALSE(separated_contact.hasActiveContact());
+    for (size_t k = 0; k != 2; ++k)
+    {
+        EXPECT_EQ(countNeighbors(separated_contact.contact_configuration_[k], separated_particles), size_t(0));
+        EXPECT_EQ(countNeighbors(separated_reference_contact.contact_configuration_[k], separated_particles), size_t(0));
+    }
+
+    // the separated cube is moved to touch the right cube from the other side
+    StdLargeVec<Vecd> &pos = separated_cube_.getBaseParticles().ParticlePositions();
+    for (size_t i = 0; i != separated_particles; ++i)
+        pos[i] += Vec3d(1.0, 0.0, 0.0);
+    separated_cube_.updateCellLinkedList();
+    updateConfigurations();
+    EXPECT_FALSE(separated_contact.isContactActive(0));
+    EXPECT_TRUE(separated_contact.isContactActive(1));
+    EXPECT_TRUE(separated_contact.hasActiveContact());
+    EXPECT_EQ(countNeighbors(separated_contact.contact_configuration_[0], separated_particles), size_t(0));
+    EXPECT_GT(countNeighbors(separated_contact.contact_configuration_[1], separated_particles), size_t(0));
+    EXPECT_EQ(sortedNeighbors(separated_contact.contact_configuration_[1], separated_particles),
+              sortedNeighbors(separated_reference_contact.contact_configuration_[1], separated_particles));
+}
+
+TEST_F(test_ContactBroadPhase, test_setActiveContacts)
+{
+    ContactRelation middle_contact(middle_cube_, {&right_cube_, &upper_cube_});
+    size_t middle_particles = middle_cube_.getBaseParticles().TotalRealParticles();
+
+    // a pair set inactive is skipped even when the bodies are in contact
+    middle_contact.setActiveContacts({true, false});
+    middle_contact.updateConfiguration();
+    EXPECT_TRUE(middle_contact.hasActiveContact());
+    EXPECT_GT(countNeighbors(middle_contact.contact_configuration_[0], middle_particles), size_t(0));
+    EXPECT_EQ(countNeighbors(middle_contact.contact_configuration_[1], middle_particles), size_t(0));
+
+    middle_contact.setActiveContacts({false, false});
+    middle_contact.updateConfiguration();
+    EXPECT_TRUE(middle_contact.hasActiveContact());
+    EXPECT_EQ(countNeighbors(middle_contact.contact_configuration_[0], middle_particles), size_t(0));
+    middle_contact.setActiveContacts({false, false});
+    EXPECT_FALSE(middle_contact.hasActiveContact());
+
+    middle_contact.setActiveContacts({false, true});
+    middle_contact.updateConfiguration();
+    EXPECT_TRUE(middle_contact.hasActiveContact());
+    EXPECT_EQ(countNeighbors(middle_contact.contact_configuration_[0], middle_particles), size_t(0));
+    EXPECT_GT(countNeighbors(middle_contact.contact_configuration_[1], middle_particles), size_t(0));
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
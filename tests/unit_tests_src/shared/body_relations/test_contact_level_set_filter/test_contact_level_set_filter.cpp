@@ -0,0 +1,87 @@
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+Real resolution_ref = 0.05;
+Real BW = 4.0 * resolution_ref;
+Vec3d halfsize_water(0.5, 0.5, 0.5);
+Vec3d halfsize_outer(0.5 + BW, 0.5 + BW, 0.5 + BW);
+BoundingBox system_domain_bounds(-halfsize_outer, halfsize_outer);
+
+/** a closed box wall around the water block */
+class WallBoundary : public ComplexShape
+{
+  public:
+    explicit WallBoundary(const std::string &shape_name) : ComplexShape(shape_name)
+    {
+        add<GeometricShapeBox>(halfsize_outer);
+        subtract<GeometricShapeBox>(halfsize_water);
+    }
+};
+
+/** the sorted neighbor indices of each particle */
+StdVec<StdVec<size_t>> sortedNeighbors(ParticleConfiguration &configuration, size_t total_particles)
+{
+    StdVec<StdVec<size_t>> neighbors(total_particles);
+    for (size_t i = 0; i != total_particles; ++i)
+    {
+        Neighborhood &neighborhood = configuration[i];
+        neighbors[i].assign(neighborhood.j_.begin(), neighborhood.j_.begin() + neighborhood.current_size_);
+        std::sort(neighbors[i].begin(), neighbors[i].end());
+    }
+    return neighbors;
+}
+
+TEST(test_ContactRelation, test_levelSetFilter)
+{
+    SPHSystem sph_system(system_domain_bounds, resolution_ref);
+    FluidBody water_block(sph_system, makeShared<GeometricShapeBox>(halfsize_water, "WaterBody"));
+    water_block.defineMaterial<WeaklyCompressibleFluid>(1.0, 10.0);
+    water_block.generateParticles<BaseParticles, Lattice>();
+    SolidBody wall_boundary(sph_system, makeShared<WallBoundary>("WallBoundary"));
+    wall_boundary.defineBodyLevelSetShape();
+    wall_boundary.defineMaterial<Solid>();
+    wall_boundary.generateParticles<BaseParticles, Lattice>();
+
+    ContactRelation water_wall_contact(water_block, {&wall_boundary});
+    ContactRelation filtered_water_wall_contact(water_block, {&wall_boundary});
+    filtered_water_wall_contact.useLevelSetFilter(wall_boundary);
+    SimpleDynamics<relax_dynamics::RandomizeParticlePosition> random_water_particles(water_block);
+
+    BaseParticles &water_particles = water_block.getBaseParticles();
+    size_t total_particles = water_particles.TotalRealParticles();
+    auto expectSameNeighbors = [&]()
+    {
+        water_block.updateCellLinkedList();
+        water_wall_contact.updateConfiguration();
+        filtered_water_wall_contact.updateConfiguration();
+        StdVec<StdVec<size_t>> neighbors =
+            sortedNeighbors(water_wall_contact.contact_configuration_[0], total_particles);
+        StdVec<StdVec<size_t>> filtered_neighbors =
+            sortedNeighbors(filtered_water_wall_contact.contact_configuration_[0], total_particles);
+        size_t particles_with_neighbors = 0;
+        for (size_t i = 0; i != total_particles; ++i)
+        {
+            EXPECT_EQ(filtered_neighbors[i], neighbors[i]);
+            if (!neighbors[i].empty())
+                particles_with_neighbors++;
+        }
+        // both the particles near the wall and those in the middle of the block are checked
+        EXPECT_GT(particles_with_neighbors, size_t(0));
+        EXPECT_LT(particles_with_neighbors, total_particles);
+    };
+
+    sph_system.initializeSystemCellLinkedLists();
+    expectSameNeighbors();
+
+    // the filter depends only on the static wall, so that it holds after the water particles have moved
+    random_water_particles.exec(0.25);
+    expectSameNeighbors();
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
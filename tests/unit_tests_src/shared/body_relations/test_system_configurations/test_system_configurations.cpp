@@ -0,0 +1,151 @@
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+#include <tbb/global_control.h>
+#include <tbb/task_arena.h>
+
+using namespace SPH;
+
+Real resolution_ref = 0.05;
+Real BW = 4.0 * resolution_ref;
+Vec3d halfsize_water(0.5, 0.5, 0.5);
+Vec3d halfsize_outer(0.5 + BW, 0.5 + BW, 0.5 + BW);
+Vec3d halfsize_cube(0.1, 0.1, 0.1);
+BoundingBox system_domain_bounds(-halfsize_outer, halfsize_outer);
+int number_of_updates = 3;
+int number_of_threads = 4;
+
+/** a closed box wall around the water block */
+class WallBoundary : public ComplexShape
+{
+  public:
+    explicit WallBoundary(const std::string &shape_name) : ComplexShape(shape_name)
+    {
+        add<GeometricShapeBox>(halfsize_outer);
+        subtract<GeometricShapeBox>(halfsize_water);
+    }
+};
+
+/** the sorted neighbor indices of all configurations of all relations in the system */
+StdVec<StdVec<size_t>> sortedSystemNeighbors(SPHSystem &sph_system)
+{
+    StdVec<StdVec<size_t>> neighbors;
+    auto appendNeighbors = [&](ParticleConfiguration &configuration, size_t total_particles)
+    {
+        for (size_t i = 0; i != total_particles; ++i)
+        {
+            Neighborhood &neighborhood = configuration[i];
+            neighbors.emplace_back(neighborhood.j_.begin(), neighborhood.j_.begin() + neighborhood.current_size_);
+            std::sort(neighbors.back().begin(), neighbors.back().end());
+        }
+    };
+
+    for (auto &body : sph_system.sph_bodies_)
+    {
+        size_t total_particles = body->getBaseParticles().TotalRealParticles();
+        for (auto &relation : body->body_relations_)
+        {
+            if (BaseInnerRelation *inner_relation = dynamic_cast<BaseInnerRelation *>(relation))
+                appendNeighbors(inner_relation->inner_configuration_, total_particles);
+            if (BaseContactRelation *contact_relation = dynamic_cast<BaseContactRelation *>(relation))
+                for (auto &configuration : contact_relation->contact_configuration_)
+                    appendNeighbors(configuration, total_particles);
+        }
+    }
+    return neighbors;
+}
+
+size_t countNeighbors(const StdVec<StdVec<size_t>> &neighbors)
+{
+    size_t number_of_neighbors = 0;
+    for (const StdVec<size_t> &particle_neighbors : neighbors)
+        number_of_neighbors += particle_neighbors.size();
+    return number_of_neighbors;
+}
+
+TEST(test_SPHSystem, test_updateSystemConfigurations)
+{
+    SPHSystem sph_system(system_domain_bounds, resolution_ref);
+    FluidBody water_block(sph_system, makeShared<GeometricShapeBox>(halfsize_water, "WaterBody"));
+    water_block.defineMaterial<WeaklyCompressibleFluid>(1.0, 10.0);
+    water_block.generateParticles<BaseParticles, Lattice>();
+    SolidBody wall_boundary(sph_system, makeShared<WallBoundary>("WallBoundary"));
+    wall_boundary.defineMaterial<Solid>();
+    wall_boundary.generateParticles<BaseParticles, Lattice>();
+    // the two cubes touch each other within the water
+    SolidBody left_cube(sph_system, makeShared<TransformShape<GeometricShapeBox>>(
+                                        Transform(Vec3d(-0.1, 0.0, 0.0)), halfsize_cube, "LeftCube"));
+    left_cube.defineMaterial<Solid>();
+    left_cube.generateParticles<BaseParticles, Lattice>();
+    SolidBody right_cube(sph_system, makeShared<TransformShape<GeometricShapeBox>>(
+                                         Transform(Vec3d(0.1, 0.0, 0.0)), halfsize_cube, "RightCube"));
+    right_cube.defineMaterial<Solid>();
+    right_cube.generateParticles<BaseParticles, Lattice>();
+
+    // several relations for the same body, which are updated concurrently
+    InnerRelation water_block_inner(water_block);
+    ContactRelation water_block_contact(water_block, {&wall_boundary, &left_cube, &right_cube});
+    ContactRelation wall_water_contact(wall_boundary, {&water_block});
+    InnerRelation left_cube_inner(left_cube);
+    SelfSurfaceContactRelation left_cube_self_contact(left_cube);
+    SurfaceContactRelation left_right_contact(left_cube, {&right_cube});
+    ContactRelation left_water_contact(left_cube, {&water_block});
+    InnerRelation right_cube_inner(right_cube);
+    SurfaceContactRelation right_left_contact(right_cube, {&left_cube});
+    ContactRelation right_water_contact(right_cube, {&water_block});
+
+    SimpleDynamics<relax_dynamics::RandomizeParticlePosition> random_water_particles(water_block);
+    SimpleDynamics<relax_dynamics::RandomizeParticlePosition> random_left_cube_particles(left_cube);
+    SimpleDynamics<relax_dynamics::RandomizeParticlePosition> random_right_cube_particles(right_cube);
+
+    // the tasks run concurrently also with fewer cores than threads
+    tbb::global_control thread_limit(tbb::global_control::max_allowed_parallelism, number_of_threads);
+    tbb::task_arena arena(number_of_threads);
+    arena.execute(
+        [&]()
+        {
+            sph_system.initializeSystemCellLinkedLists();
+            for (int update = 0; update != number_of_updates; ++update)
+            {
+                sph_system.updateSystemConfigurations();
+                StdVec<StdVec<size_t>> neighbors = sortedSystemNeighbors(sph_system);
+
+                // the same relations are updated one after another
+                for (auto &body : sph_system.sph_bodies_)
+                    for (auto &relation : body->body_relations_)
+                        relation->updateConfiguration();
+                StdVec<StdVec<size_t>> sequential_neighbors = sortedSystemNeighbors(sph_system);
+
+                EXPECT_GT(countNeighbors(sequential_neighbors), size_t(0));
+                ASSERT_EQ(neighbors.size(), sequential_neighbors.size());
+                for (size_t n = 0; n != neighbors.size(); ++n)
+                {
+                    EXPECT_EQ(neighbors[n], sequential_neighbors[n]);
+                }
+
+                random_water_particles.exec(0.25);
+                random_left_cube_particles.exec(0.25);
+                random_right_cube_particles.exec(0.25);
+                sph_system.updateSystemCellLinkedLists();
+            }
+        });
+
+    // each relation has found neighbors
+    for (ParticleConfiguration *configuration :
+         {&water_block_inner.inner_configuration_, &water_block_contact.contact_configuration_[0],
+          &water_block_contact.contact_configuration_[1], &wall_water_contact.contact_configuration_[0],
+          &left_cube_inner.inner_configuration_, &left_cube_self_contact.inner_configuration_,
+          &left_right_contact.contact_configuration_[0], &left_water_contact.contact_configuration_[0],
+          &right_cube_inner.inner_configuration_, &right_left_contact.contact_configuration_[0]})
+    {
+        size_t number_of_neighbors = 0;
+        for (Neighborhood &neighborhood : *configuration)
+            number_of_neighbors += neighborhood.current_size_;
+        EXPECT_GT(number_of_neighbors, size_t(0));
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
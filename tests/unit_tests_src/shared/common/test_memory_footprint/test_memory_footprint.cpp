@@ -0,0 +1,96 @@
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+TEST(test_MemoryFootprint, test_recordAndRelease)
+{
+    size_t live_bytes = MemoryFootprint::LiveBytes();
+    size_t entry_id = MemoryFootprint::record("TestOwner", "TestAllocation", "TestSubsystem", 1000);
+    EXPECT_NE(entry_id, MemoryFootprint::NoEntry);
+    EXPECT_EQ(MemoryFootprint::LiveBytes(), live_bytes + 1000);
+    EXPECT_GE(MemoryFootprint::PeakBytes(), live_bytes + 1000);
+
+    MemoryFootprint::release(entry_id);
+    EXPECT_EQ(MemoryFootprint::LiveBytes(), live_bytes);
+    EXPECT_GE(MemoryFootprint::PeakBytes(), live_bytes + 1000);
+
+    // releasing no entry or a released entry changes nothing
+    MemoryFootprint::release(MemoryFootprint::NoEntry);
+    MemoryFootprint::release(entry_id);
+    EXPECT_EQ(MemoryFootprint::LiveBytes(), live_bytes);
+}
+
+TEST(test_MemoryFootprint, test_dynamicEntry)
+{
+    size_t live_bytes = MemoryFootprint::LiveBytes();
+    StdVec<double> buffer;
+    size_t entry_id = MemoryFootprint::recordDynamic(
+        "TestOwner", "TestBuffer", "TestSubsystem",
+        [&]()
+        { return buffer.capacity() * sizeof(double); });
+    EXPECT_EQ(MemoryFootprint::LiveBytes(), live_bytes);
+
+    // the size is evaluated when the live total is computed
+    buffer.reserve(2000);
+    EXPECT_EQ(MemoryFootprint::LiveBytes(), live_bytes + buffer.capacity() * sizeof(double));
+    EXPECT_GE(MemoryFootprint::PeakBytes(), live_bytes + buffer.capacity() * sizeof(double));
+
+    MemoryFootprint::release(entry_id);
+    EXPECT_EQ(MemoryFootprint::LiveBytes(), live_bytes);
+}
+
+TEST(test_MemoryFootprint, test_writeReport)
+{
+    size_t entry_id = MemoryFootprint::record("ReportOwner", "ReportAllocation", "ReportSubsystem", 3 * 1024 * 1024);
+    std::ostringstream report;
+    MemoryFootprint::writeReport(report);
+    MemoryFootprint::release(entry_id);
+
+    EXPECT_NE(report.str().find("ReportOwner"), std::string::npos);
+    EXPECT_NE(report.str().find("ReportAllocation"), std::string::npos);
+    EXPECT_NE(report.str().find("ReportSubsystem"), std::string::npos);
+    EXPECT_NE(report.str().find("3.00 MB"), std::string::npos);
+}
+
+TEST(test_MemoryFootprint, test_particleVariables)
+{
+    BoundingBox system_domain_bounds(Vec3d(-1.0, -1.0, -1.0), Vec3d(1.0, 1.0, 1.0));
+    SPHSystem sph_system(system_domain_bounds, 0.1);
+    SolidBody block(sph_system, makeShared<GeometricShapeBox>(0.5 * Vec3d::Ones(), "Block"));
+    block.defineMaterial<Solid>();
+    block.generateParticles<BaseParticles, Lattice>();
+    BaseParticles &particles = block.getBaseParticles();
+
+    // the data field of a registered variable is accounted with the body as owner
+    size_t live_bytes = MemoryFootprint::LiveBytes();
+    StdLargeVec<Real> &local_quantity = *particles.registerSharedVariable<Real>("LocalQuantity");
+    EXPECT_GE(MemoryFootprint::LiveBytes(), live_bytes + local_quantity.size() * sizeof(Real));
+    std::ostringstream report;
+    MemoryFootprint::writeReport(report);
+    EXPECT_NE(report.str().find("LocalQuantity"), std::string::npos);
+
+    // a variable used only through the reference kept by the registering method is not shared
+    StdVec<std::string> unshared_variables = particles.getUnsharedVariableNames();
+    EXPECT_NE(std::find(unshared_variables.begin(), unshared_variables.end(), "LocalQuantity"),
+              unshared_variables.end());
+
+    // a variable requested by another method is shared
+    particles.registerSharedVariable<Real>("SharedQuantity");
+    particles.getVariableDataByName<Real>("SharedQuantity");
+    unshared_variables = particles.getUnsharedVariableNames();
+    EXPECT_EQ(std::find(unshared_variables.begin(), unshared_variables.end(), "SharedQuantity"),
+              unshared_variables.end());
+
+    // a written variable is not reported
+    particles.addVariableToWrite<Real>("LocalQuantity");
+    unshared_variables = particles.getUnsharedVariableNames();
+    EXPECT_EQ(std::find(unshared_variables.begin(), unshared_variables.end(), "LocalQuantity"),
+              unshared_variables.end());
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,88 @@
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+Real resolution_ref = 0.05;
+BoundingBox system_domain_bounds(Vec3d(-0.5, -0.5, -0.5), Vec3d(0.5, 0.5, 0.5));
+Vec3d halfsize_block(0.25, 0.25, 0.25);
+Real rho0_s = 1.0;
+Real poisson = 0.3;
+int relaxation_steps = 20;
+
+struct VariantRecord
+{
+    int relaxation_steps_ = 0;
+    std::string output_folder_;
+    StdLargeVec<Vecd> position_;
+};
+
+TEST(test_ParametricSweep, test_sharedRelaxedParticles)
+{
+    ParametricSweep<Real> parametric_sweep;
+    parametric_sweep.addVariant("Soft", 1.0).addVariant("Stiff", 10.0);
+    SharedPtr<GeometricShapeBox> block_shape =
+        parametric_sweep.defineSharedShape<GeometricShapeBox>(halfsize_block, "Block");
+    SharedPtr<LevelSetShape> block_level_set_shape =
+        parametric_sweep.defineSharedLevelSetShape(*block_shape, resolution_ref);
+    SharedParticleData &shared_particle_data = parametric_sweep.defineSharedParticleData();
+
+    std::map<std::string, VariantRecord> variant_records;
+    parametric_sweep.run(
+        [&](const std::string &variant_name, const Real &youngs_modulus)
+        {
+            SPHSystem sph_system(system_domain_bounds, resolution_ref);
+            sph_system.setIOEnvironment(true, variant_name);
+            SolidBody block(sph_system, block_level_set_shape);
+            block.defineMaterial<SaintVenantKirchhoffSolid>(rho0_s, youngs_modulus, poisson);
+            block.generateParticles<BaseParticles, Shared, Lattice>(shared_particle_data);
+
+            VariantRecord &variant_record = variant_records[variant_name];
+            variant_record.output_folder_ = sph_system.getIOEnvironment().output_folder_;
+            if (!shared_particle_data.isCaptured())
+            {
+                using namespace relax_dynamics;
+                InnerRelation block_inner(block);
+                SimpleDynamics<RandomizeParticlePosition> random_block_particles(block);
+                RelaxationStepInner relaxation_step_inner(block_inner);
+                random_block_particles.exec(0.25);
+                relaxation_step_inner.SurfaceBounding().exec();
+                for (int k = 0; k != relaxation_steps; ++k)
+                {
+                    relaxation_step_inner.exec();
+                    variant_record.relaxation_steps_++;
+                }
+                shared_particle_data.captureParticleData(block);
+            }
+
+            BaseParticles &particles = block.getBaseParticles();
+            StdLargeVec<Vecd> &pos = *particles.getVariableDataByName<Vecd>("Position");
+            variant_record.position_.assign(pos.begin(), pos.begin() + particles.TotalRealParticles());
+        });
+
+    // only the first variant generates and relaxes the particles
+    const VariantRecord &soft_record = variant_records["Soft"];
+    const VariantRecord &stiff_record = variant_records["Stiff"];
+    EXPECT_EQ(soft_record.relaxation_steps_, relaxation_steps);
+    EXPECT_EQ(stiff_record.relaxation_steps_, 0);
+    EXPECT_EQ(shared_particle_data.TotalParticles(), soft_record.position_.size());
+
+    // the second variant starts from the relaxed particles of the first one
+    ASSERT_EQ(stiff_record.position_.size(), soft_record.position_.size());
+    for (size_t i = 0; i != soft_record.position_.size(); ++i)
+    {
+        EXPECT_EQ(stiff_record.position_[i], soft_record.position_[i]);
+    }
+
+    // each variant writes into its own output folder
+    EXPECT_EQ(fs::path(soft_record.output_folder_), fs::path("./output/Soft"));
+    EXPECT_EQ(fs::path(stiff_record.output_folder_), fs::path("./output/Stiff"));
+    EXPECT_TRUE(fs::exists(soft_record.output_folder_));
+    EXPECT_TRUE(fs::exists(stiff_record.output_folder_));
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
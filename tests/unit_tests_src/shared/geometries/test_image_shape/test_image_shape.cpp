@@ -0,0 +1,146 @@
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+/** Writes a segmentation image of unsigned char voxels centered at the origin. */
+template <typename LabelFunction>
+std::string writeSegmentationImage(const std::string &file_name, const Array3i &number_of_voxels, Real spacing,
+                                   const LabelFunction &label_at)
+{
+    Vec3d offset = -0.5 * spacing * (number_of_voxels - 1).cast<Real>().matrix();
+    std::ofstream header_file(file_name + ".mhd");
+    header_file << "ObjectType = Image\n";
+    header_file << "NDims = 3\n";
+    header_file << "BinaryData = True\n";
+    header_file << "BinaryDataByteOrderMSB = False\n";
+    header_file << "TransformMatrix = 1 0 0 0 1 0 0 0 1\n";
+    header_file << "Offset = " << offset[0] << " " << offset[1] << " " << offset[2] << "\n";
+    header_file << "ElementSpacing = " << spacing << " " << spacing << " " << spacing << "\n";
+    header_file << "DimSize = " << number_of_voxels[0] << " " << number_of_voxels[1] << " " << number_of_voxels[2] << "\n";
+    header_file << "ElementType = MET_UCHAR\n";
+    header_file << "ElementDataFile = " << file_name + ".raw\n";
+    header_file.close();
+
+    StdVec<unsigned char> labels;
+    for (int z = 0; z < number_of_voxels[2]; z++)
+        for (int y = 0; y < number_of_voxels[1]; y++)
+            for (int x = 0; x < number_of_voxels[0]; x++)
+            {
+                Vec3d voxel_center = offset + spacing * Vec3d(x, y, z);
+                labels.push_back(label_at(voxel_center));
+            }
+    std::ofstream raw_file(file_name + ".raw", std::ios::binary | std::ios::out);
+    raw_file.write((const char *)labels.data(), labels.size());
+    raw_file.close();
+    return "./" + file_name + ".mhd";
+}
+
+TEST(test_ImageShape, test_distanceTransformOfVoxelisedSphere)
+{
+    int number_of_voxels = 40;
+    Real spacing = 0.02;
+    Real radius = 0.25;
+    std::string file_path = writeSegmentationImage(
+        "VoxelisedSphere", Array3i::Constant(number_of_voxels), spacing,
+        [&](const Vec3d &position)
+        { return position.norm() < radius ? 1 : 0; });
+
+    ImageMHD<float, 3> image(file_path);
+    image.convertMaskToSignedDistance(0.5);
+
+    // the voxelised surface deviates from the sphere by less than one voxel spacing,
+    // checked at the voxel centers not on the image boundary, which may not be probed due to round-off
+    Real offset = -0.5 * Real(number_of_voxels - 1) * spacing;
+    Real max_error = 0.0;
+    for (int z = 1; z < number_of_voxels - 1; z++)
+        for (int y = 1; y < number_of_voxels - 1; y++)
+            for (int x = 1; x < number_of_voxels - 1; x++)
+            {
+                Vec3d voxel_center = Vec3d(offset, offset, offset) + spacing * Vec3d(x, y, z);
+                Real analytic_distance = voxel_center.norm() - radius;
+                max_error = SMAX(max_error, ABS(image.findValueAtPoint(voxel_center) - analytic_distance));
+            }
+    EXPECT_LT(max_error, spacing);
+
+    // the interpolated signed distance in between voxel centers
+    for (Real distance : {-0.1, -0.03, 0.03, 0.1})
+    {
+        Vec3d probe_point = (radius + distance) * Vec3d(1.0, 2.0, 3.0).normalized();
+        EXPECT_NEAR(image.findValueAtPoint(probe_point), distance, spacing);
+        EXPECT_GT(image.findNormalAtPoint(probe_point).dot(probe_point.normalized()), 0.95);
+    }
+}
+
+TEST(test_ImageShape, test_checkContainOnLabelImage)
+{
+    Real spacing = 0.02;
+    Real radius = 0.25;
+    // the lower half of a sphere is labeled 1, the upper half 2 and the background 0
+    std::string file_path = writeSegmentationImage(
+        "LabeledSphere", Array3i::Constant(40), spacing,
+        [&](const Vec3d &position)
+        { return position.norm() < radius ? (position[2] < 0.0 ? 1 : 2) : 0; });
+
+    ImageShapeFromSegmentation upper_half(file_path, 2, "UpperHalf");
+    ImageShapeFromSegmentation whole_sphere(file_path, 0, "WholeSphere");
+
+    StdVec<Vec3d> upper_points = {Vec3d(0.0, 0.0, 0.15), Vec3d(0.1, -0.1, 0.05), Vec3d(-0.1, 0.0, 0.1)};
+    StdVec<Vec3d> lower_points = {Vec3d(0.0, 0.0, -0.15), Vec3d(0.1, -0.1, -0.05), Vec3d(-0.1, 0.0, -0.1)};
+    StdVec<Vec3d> background_points = {Vec3d(0.0, 0.0, 0.33), Vec3d(0.2, 0.2, 0.1), Vec3d(0.0, -0.3, -0.1)};
+    for (const Vec3d &point : upper_points)
+    {
+        EXPECT_TRUE(upper_half.checkContain(point));
+        EXPECT_TRUE(whole_sphere.checkContain(point));
+    }
+    for (const Vec3d &point : lower_points)
+    {
+        EXPECT_FALSE(upper_half.checkContain(point));
+        EXPECT_TRUE(whole_sphere.checkContain(point));
+    }
+    for (const Vec3d &point : background_points)
+    {
+        EXPECT_FALSE(upper_half.checkContain(point));
+        EXPECT_FALSE(whole_sphere.checkContain(point));
+    }
+    // points beyond the image are outside
+    EXPECT_FALSE(whole_sphere.checkContain(Vec3d(0.0, 0.0, 1.0)));
+}
+
+TEST(test_ImageShape, test_probeOneSliceImage)
+{
+    int number_of_voxels = 40;
+    Real spacing = 0.02;
+    Real radius = 0.25;
+    // a disk in an image of a single slice, which is probed only in the plane of the slice
+    std::string file_path = writeSegmentationImage(
+        "VoxelisedDisk", Array3i(number_of_voxels, number_of_voxels, 1), spacing,
+        [&](const Vec3d &position)
+        { return position.norm() < radius ? 1 : 0; });
+
+    ImageMHD<float, 3> image(file_path);
+    image.convertMaskToSignedDistance(0.5);
+
+    for (Real distance : {-0.1, -0.03, 0.03, 0.1})
+    {
+        Vec3d probe_point = (radius + distance) * Vec3d(1.0, 2.0, 0.0).normalized();
+        EXPECT_NEAR(image.findValueAtPoint(probe_point), distance, spacing);
+        Vec3d normal = image.findNormalAtPoint(probe_point);
+        EXPECT_GT(normal.dot(probe_point.normalized()), 0.95);
+        EXPECT_EQ(normal[2], 0.0);
+    }
+    // the voxel centers on the image boundary give the values of the voxels
+    Real offset = -0.5 * Real(number_of_voxels - 1) * spacing;
+    Vec3d corner(offset, offset, 0.0);
+    EXPECT_NEAR(image.findValueAtPoint(corner), corner.norm() - radius, spacing);
+    EXPECT_NEAR(image.findValueAtPoint(-corner), corner.norm() - radius, spacing);
+    // points off the slice cannot be probed
+    EXPECT_EQ(image.findValueAtPoint(Vec3d(0.0, 0.0, 0.5 * spacing)), image.findValueAtPoint(Vec3d(0.0, 0.0, 1.0)));
+    EXPECT_EQ(image.findGradientAtPoint(Vec3d(0.0, 0.0, 0.5 * spacing)), Vec3d::Zero());
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
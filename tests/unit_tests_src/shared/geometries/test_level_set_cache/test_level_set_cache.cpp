@@ -0,0 +1,70 @@
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+/** A block with an optional small notch on one face, away from the points of a coarse lattice. */
+SharedPtr<ComplexShape> createBlock(Real notch_halfsize)
+{
+    SharedPtr<ComplexShape> block = makeShared<ComplexShape>("Block");
+    block->add<GeometricShapeBox>(Vec3d(0.5, 0.5, 0.5));
+    if (notch_halfsize > 0.0)
+    {
+        Transform notch_transform(Vec3d(0.5, 0.07, 0.07));
+        block->subtract<TransformShape<GeometricShapeBox>>(notch_transform, notch_halfsize * Vec3d::Ones());
+    }
+    return block;
+}
+
+size_t countCacheFiles(const std::string &cache_folder)
+{
+    size_t number_of_files = 0;
+    if (fs::exists(cache_folder))
+    {
+        for (const auto &entry : fs::directory_iterator(cache_folder))
+        {
+            if (entry.is_regular_file())
+                number_of_files++;
+        }
+    }
+    return number_of_files;
+}
+
+TEST(test_LevelSetCache, test_geometryHash)
+{
+    EXPECT_EQ(createBlock(0.0)->getGeometryHash(), createBlock(0.0)->getGeometryHash());
+    EXPECT_NE(createBlock(0.0)->getGeometryHash(), createBlock(0.01)->getGeometryHash());
+    EXPECT_NE(createBlock(0.01)->getGeometryHash(), createBlock(0.011)->getGeometryHash());
+}
+
+TEST(test_LevelSetCache, test_changedShapeMissesCache)
+{
+    BoundingBox system_domain_bounds(Vec3d(-1.0, -1.0, -1.0), Vec3d(1.0, 1.0, 1.0));
+    SPHSystem sph_system(system_domain_bounds, 0.05);
+    sph_system.setLevelSetCache(true);
+    sph_system.setIOEnvironment();
+    std::string cache_folder = sph_system.getIOEnvironment().cache_folder_ + "/level_set";
+    fs::remove_all(cache_folder);
+
+    RealBody original_block(sph_system, createBlock(0.0), "OriginalBlock");
+    original_block.defineBodyLevelSetShape();
+    size_t number_of_files = countCacheFiles(cache_folder);
+    EXPECT_GT(number_of_files, 0);
+
+    // a changed geometry is not found in the cache and adds its own level set file
+    RealBody notched_block(sph_system, createBlock(0.01), "NotchedBlock");
+    notched_block.defineBodyLevelSetShape();
+    EXPECT_GT(countCacheFiles(cache_folder), number_of_files);
+    number_of_files = countCacheFiles(cache_folder);
+
+    // the unchanged geometry is loaded from the cache without adding files
+    RealBody same_block(sph_system, createBlock(0.0), "SameBlock");
+    same_block.defineBodyLevelSetShape();
+    EXPECT_EQ(countCacheFiles(cache_folder), number_of_files);
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,183 @@
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+Real scalarValue(size_t row, size_t column) { return 0.1 * Real(row) + Real(column) + 1.0e-3; };
+Vecd vectorValue(size_t row) { return Vecd::Ones() * Real(row) + Vecd::UnitX() * 0.25; };
+
+/** write rows from first_row to last_row with a small buffer so that the rows are flushed several times */
+void writeRows(TimeSeriesWriter &writer, size_t first_row, size_t last_row)
+{
+    for (size_t row = first_row; row != last_row; ++row)
+    {
+        writer.beginRow(0.01 * Real(row));
+        writer.writeValue(scalarValue(row, 0));
+        writer.writeValue(vectorValue(row));
+        writer.writeValue(scalarValue(row, 2));
+        writer.endRow();
+    }
+}
+
+void addColumns(TimeSeriesWriter &writer)
+{
+    writer.addColumn("Energy", Real(0));
+    writer.addColumn("Position", Vecd::Zero());
+    writer.addColumn("Pressure", Real(0));
+}
+
+void expectRows(TimeSeriesReader &reader, size_t number_of_rows)
+{
+    ASSERT_EQ(reader.NumberOfRows(), number_of_rows);
+    for (size_t row = 0; row != number_of_rows; ++row)
+    {
+        Real energy, pressure;
+        Vecd position;
+        reader.getValue(row, 0, energy);
+        reader.getValue(row, 1, position);
+        reader.getValue(row, 2, pressure);
+        EXPECT_EQ(reader.Times()[row], 0.01 * Real(row));
+        EXPECT_EQ(energy, scalarValue(row, 0));
+        EXPECT_EQ(position, vectorValue(row));
+        EXPECT_EQ(pressure, scalarValue(row, 2));
+    }
+}
+
+TEST(test_TimeSeries, test_writeAndRead)
+{
+    std::string filefullpath = "./time_series_mixed.bin";
+    fs::remove(filefullpath);
+    {
+        TimeSeriesWriter writer(filefullpath, 4);
+        addColumns(writer);
+        writeRows(writer, 0, 10);
+
+        // two full buffers are in the file, the last two rows are still buffered
+        TimeSeriesReader reader(filefullpath);
+        EXPECT_EQ(reader.NumberOfRows(), size_t(8));
+    }
+    // the remaining rows are flushed on destruction
+    TimeSeriesReader reader(filefullpath);
+    EXPECT_EQ(reader.ColumnNames(), StdVec<std::string>({"Energy", "Position", "Pressure"}));
+    EXPECT_EQ(reader.ColumnComponents(), StdVec<int>({1, Dimensions, 1}));
+    expectRows(reader, 10);
+}
+
+TEST(test_TimeSeries, test_appendWithSameHeader)
+{
+    std::string filefullpath = "./time_series_append.bin";
+    fs::remove(filefullpath);
+    {
+        TimeSeriesWriter writer(filefullpath, 3);
+        addColumns(writer);
+        writeRows(writer, 0, 7);
+    }
+    {
+        // as by a restarted run with the same columns
+        TimeSeriesWriter writer(filefullpath, 3);
+        addColumns(writer);
+        writeRows(writer, 7, 12);
+    }
+    TimeSeriesReader appended_reader(filefullpath);
+    expectRows(appended_reader, 12);
+
+    {
+        // other columns start a new file
+        TimeSeriesWriter writer(filefullpath, 3);
+        writer.addColumn("Energy", Real(0));
+        writer.beginRow(0.0);
+        writer.writeValue(Real(1));
+        writer.endRow();
+    }
+    TimeSeriesReader new_reader(filefullpath);
+    EXPECT_EQ(new_reader.NumberOfRows(), size_t(1));
+    EXPECT_EQ(new_reader.ColumnNames(), StdVec<std::string>({"Energy"}));
+}
+
+TEST(test_TimeSeries, test_getAllValues)
+{
+    std::string scalar_filefullpath = "./time_series_scalar.bin";
+    std::string vector_filefullpath = "./time_series_vector.bin";
+    fs::remove(scalar_filefullpath);
+    fs::remove(vector_filefullpath);
+    size_t number_of_rows = 9;
+    {
+        TimeSeriesWriter scalar_writer(scalar_filefullpath, 2);
+        TimeSeriesWriter vector_writer(vector_filefullpath, 2);
+        scalar_writer.addColumn("A", Real(0));
+        scalar_writer.addColumn("B", Real(0));
+        vector_writer.addColumn("Velocity", Vecd::Zero());
+        for (size_t row = 0; row != number_of_rows; ++row)
+        {
+            scalar_writer.beginRow(Real(row));
+            scalar_writer.writeValue(scalarValue(row, 0));
+            scalar_writer.writeValue(scalarValue(row, 1));
+            scalar_writer.endRow();
+            vector_writer.beginRow(Real(row));
+            vector_writer.writeValue(vectorValue(row));
+            vector_writer.endRow();
+        }
+    }
+
+    BiVector<Real> scalar_values = TimeSeriesReader(scalar_filefullpath).getAllValues<Real>();
+    BiVector<Vecd> vector_values = TimeSeriesReader(vector_filefullpath).getAllValues<Vecd>();
+    ASSERT_EQ(scalar_values.size(), number_of_rows);
+    ASSERT_EQ(vector_values.size(), number_of_rows);
+    for (size_t row = 0; row != number_of_rows; ++row)
+    {
+        ASSERT_EQ(scalar_values[row].size(), size_t(2));
+        ASSERT_EQ(vector_values[row].size(), size_t(1));
+        EXPECT_EQ(scalar_values[row][0], scalarValue(row, 0));
+        EXPECT_EQ(scalar_values[row][1], scalarValue(row, 1));
+        EXPECT_EQ(vector_values[row][0], vectorValue(row));
+    }
+}
+
+TEST(test_TimeSeries, test_writeToDat)
+{
+    std::string filefullpath = "./time_series_dat.bin";
+    std::string dat_filefullpath = "./time_series_dat.dat";
+    fs::remove(filefullpath);
+    size_t number_of_rows = 5;
+    {
+        TimeSeriesWriter writer(filefullpath, 2);
+        addColumns(writer);
+        writeRows(writer, 0, number_of_rows);
+    }
+    TimeSeriesReader(filefullpath).writeToDat(dat_filefullpath);
+
+    std::ifstream dat_file(dat_filefullpath.c_str());
+    std::string line;
+    std::getline(dat_file, line);
+    std::string header = "\"run_time\"   \"Energy\"   ";
+    for (int j = 0; j != Dimensions; ++j)
+        header += "\"Position[" + std::to_string(j) + "]\"   ";
+    header += "\"Pressure\"   ";
+    EXPECT_EQ(line, header);
+
+    size_t row = 0;
+    while (std::getline(dat_file, line))
+    {
+        std::istringstream row_stream(line);
+        Real time, value;
+        row_stream >> time;
+        EXPECT_NEAR(time, 0.01 * Real(row), 1.0e-9);
+        row_stream >> value;
+        EXPECT_NEAR(value, scalarValue(row, 0), 1.0e-9);
+        for (int j = 0; j != Dimensions; ++j)
+        {
+            row_stream >> value;
+            EXPECT_NEAR(value, vectorValue(row)[j], 1.0e-9);
+        }
+        row_stream >> value;
+        EXPECT_NEAR(value, scalarValue(row, 2), 1.0e-9);
+        row++;
+    }
+    EXPECT_EQ(row, number_of_rows);
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,136 @@
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+Real resolution_ref = 0.01;
+Real BW = 4.0 * resolution_ref;
+Vec3d halfsize_soil(0.05, 0.05, 0.05);
+Vec3d halfsize_wall(0.1, 0.5 * BW, 0.1);
+BoundingBox system_domain_bounds(Vec3d(-0.1 - BW, -BW, -0.1 - BW), Vec3d(0.1 + BW, 0.1 + BW, 0.1 + BW));
+Real rho0_s = 2600.0;
+Real gravity_g = 9.8;
+Real youngs_modulus = 5.98e6;
+Real poisson = 0.3;
+Real c_s = sqrt(youngs_modulus / (rho0_s * 3.0 * (1.0 - 2.0 * poisson)));
+Real friction_angle = 30.0 * Pi / 180.0;
+int number_of_steps = 50;
+
+/** the soil block stands on the wall plate with a geostatic initial stress */
+class SoilInitialCondition : public continuum_dynamics::ContinuumInitialCondition
+{
+  public:
+    explicit SoilInitialCondition(RealBody &soil_block)
+        : continuum_dynamics::ContinuumInitialCondition(soil_block){};
+
+  protected:
+    void update(size_t index_i, Real dt)
+    {
+        Real stress_yy = -rho0_s * gravity_g * (2.0 * halfsize_soil[1] - pos_[index_i][1]);
+        Real lateral_ratio = 1.0 - sin(friction_angle);
+        stress_tensor_3D_[index_i](1, 1) = stress_yy;
+        stress_tensor_3D_[index_i](0, 0) = stress_yy * lateral_ratio;
+        stress_tensor_3D_[index_i](2, 2) = stress_yy * lateral_ratio;
+    };
+};
+
+class SoilBlock : public RealBody
+{
+  public:
+    SoilBlock(SPHSystem &sph_system, const std::string &body_name)
+        : RealBody(sph_system, makeShared<TransformShape<GeometricShapeBox>>(
+                                   Transform(Vec3d(0.0, halfsize_soil[1], 0.0)), halfsize_soil, body_name))
+    {
+        defineMaterial<PlasticContinuum>(rho0_s, c_s, youngs_modulus, poisson, friction_angle);
+        generateParticles<BaseParticles, Lattice>();
+    };
+};
+
+class SoilCollapse
+{
+  public:
+    SoilBlock soil_block_;
+    InnerRelation soil_block_inner_;
+    ContactRelation soil_block_contact_;
+    SimpleDynamics<GravityForce> constant_gravity_;
+    SimpleDynamics<SoilInitialCondition> soil_initial_condition_;
+    Dynamics1Level<continuum_dynamics::PlasticIntegration1stHalfWithWallRiemann> stress_relaxation_;
+    Dynamics1Level<continuum_dynamics::PlasticIntegration2ndHalfWithWallRiemann> density_relaxation_;
+    StdLargeVec<Mat3d> &stress_tensor_3D_;
+    StdLargeVec<int> &is_plastic_active_;
+
+    SoilCollapse(SPHSystem &sph_system, const std::string &body_name, SolidBody &wall_boundary, Gravity &gravity)
+        : soil_block_(sph_system, body_name), soil_block_inner_(soil_block_),
+          soil_block_contact_(soil_block_, {&wall_boundary}),
+          constant_gravity_(soil_block_, gravity), soil_initial_condition_(soil_block_),
+          stress_relaxation_(soil_block_inner_, soil_block_contact_),
+          density_relaxation_(soil_block_inner_, soil_block_contact_),
+          stress_tensor_3D_(*soil_block_.getBaseParticles().getVariableDataByName<Mat3d>("StressTensor3D")),
+          is_plastic_active_(*soil_block_.getBaseParticles().getVariableDataByName<int>("IsPlasticActive")){};
+
+    void initialize()
+    {
+        soil_initial_condition_.exec();
+        constant_gravity_.exec();
+    };
+
+    void advance(Real dt)
+    {
+        stress_relaxation_.exec(dt);
+        density_relaxation_.exec(dt);
+    };
+};
+
+TEST(test_PlasticIntegration2ndHalf, test_elasticPredictorMask)
+{
+    SPHSystem sph_system(system_domain_bounds, resolution_ref);
+    SolidBody wall_boundary(sph_system, makeShared<TransformShape<GeometricShapeBox>>(
+                                            Transform(Vec3d(0.0, -0.5 * BW, 0.0)), halfsize_wall, "WallBoundary"));
+    wall_boundary.defineMaterial<Solid>();
+    wall_boundary.generateParticles<BaseParticles, Lattice>();
+    SimpleDynamics<NormalDirectionFromBodyShape> wall_boundary_normal_direction(wall_boundary);
+    Gravity gravity(Vec3d(0.0, -gravity_g, 0.0));
+    // the soil is integrated with the mask and with the plastic flow always evaluated, as before the mask
+    SoilCollapse masked_soil(sph_system, "MaskedSoil", wall_boundary, gravity);
+    SoilCollapse reference_soil(sph_system, "ReferenceSoil", wall_boundary, gravity);
+    ReduceDynamics<fluid_dynamics::AcousticTimeStepSize> soil_acoustic_time_step(masked_soil.soil_block_, 0.4);
+
+    sph_system.initializeSystemCellLinkedLists();
+    sph_system.initializeSystemConfigurations();
+    wall_boundary_normal_direction.exec();
+    masked_soil.initialize();
+    reference_soil.initialize();
+
+    size_t total_particles = masked_soil.soil_block_.getBaseParticles().TotalRealParticles();
+    size_t max_elastic_particles = 0;
+    size_t max_plastic_particles = 0;
+    for (int step = 0; step != number_of_steps; ++step)
+    {
+        std::fill(reference_soil.is_plastic_active_.begin(), reference_soil.is_plastic_active_.end(), 1);
+        Real dt = soil_acoustic_time_step.exec();
+        masked_soil.advance(dt);
+        reference_soil.advance(dt);
+
+        size_t plastic_particles = std::count(masked_soil.is_plastic_active_.begin(),
+                                              masked_soil.is_plastic_active_.begin() + total_particles, 1);
+        max_plastic_particles = SMAX(max_plastic_particles, plastic_particles);
+        max_elastic_particles = SMAX(max_elastic_particles, total_particles - plastic_particles);
+    }
+    // both elastic and yielding particles are in the soil
+    EXPECT_GT(max_elastic_particles, size_t(0));
+    EXPECT_GT(max_plastic_particles, size_t(0));
+
+    Real max_stress = 0.0;
+    for (size_t i = 0; i != total_particles; ++i)
+        max_stress = SMAX(max_stress, reference_soil.stress_tensor_3D_[i].norm());
+    for (size_t i = 0; i != total_particles; ++i)
+    {
+        EXPECT_LE((masked_soil.stress_tensor_3D_[i] - reference_soil.stress_tensor_3D_[i]).norm(), 1.0e-10 * max_stress);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,183 @@
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+Real L = 1.0;
+Real resolution_ref = L / 6.0; // 216 particles, the last batch is shorter than the batch size
+BoundingBox system_domain_bounds(Vec3d(-L, -L, -L), Vec3d(L, L, L));
+// Aliev-Panfilow model with a fast upstroke for particles above the threshold voltage
+Real c_m = 1.0;
+Real k = 8.0;
+Real a = 0.15;
+Real b = 0.0;
+Real mu_1 = 0.2;
+Real mu_2 = 0.3;
+Real epsilon = 0.04;
+Real k_a = 0.0;
+
+using ReactionRelaxation = BatchedReactionRelaxationForward<ElectroPhysiologyReaction>;
+
+/** Expose the batch operations for testing. */
+class TestingBatchedReactionRelaxation : public ReactionRelaxation
+{
+  public:
+    using ReactionRelaxation::ReactionRelaxation;
+    using ReactionRelaxation::BatchSize;
+
+    void advanceOneBatch(size_t first_index, size_t batch_size, Real dt)
+    {
+        advanceBatch(first_index, batch_size, dt);
+    };
+
+    std::array<size_t, BatchSize> getBatchSubStepNumbers(size_t first_index, size_t batch_size, Real dt)
+    {
+        BatchedSpecies species;
+        for (size_t k = 0; k != NumReactiveSpecies; ++k)
+            for (size_t l = 0; l != batch_size; ++l)
+                species[k][l] = (*reactive_species_[k])[first_index + l];
+        std::array<size_t, BatchSize> sub_steps;
+        getSubStepNumbers(species, batch_size, dt, sub_steps);
+        return sub_steps;
+    };
+};
+
+class ReactionBlocks
+{
+  public:
+    SPHSystem sph_system_;
+    AlievPanfilowModel reaction_model_;
+    SolidBody reference_block_, batched_block_;
+
+    ReactionBlocks()
+        : sph_system_(system_domain_bounds, resolution_ref),
+          reaction_model_(k_a, c_m, k, a, b, mu_1, mu_2, epsilon),
+          reference_block_(sph_system_, makeShared<GeometricShapeBox>(0.5 * L * Vec3d::Ones(), "ReferenceBlock")),
+          batched_block_(sph_system_, makeShared<GeometricShapeBox>(0.5 * L * Vec3d::Ones(), "BatchedBlock"))
+    {
+        sph_system_.setIOEnvironment();
+        for (SolidBody *block : {&reference_block_, &batched_block_})
+        {
+            block->defineMaterial<MonoFieldElectroPhysiology<IsotropicDiffusion>>(reaction_model_, 1.0);
+            block->generateParticles<BaseParticles, Lattice>();
+            // voltages below and above the threshold in every batch
+            BaseParticles &particles = block->getBaseParticles();
+            StdLargeVec<Real> &voltage = *particles.registerSharedVariable<Real>("Voltage");
+            for (size_t i = 0; i != particles.TotalRealParticles(); ++i)
+                voltage[i] = (Real(i % 8) + 0.5) / 8.0;
+        }
+    };
+
+    Real maxSpeciesDifference()
+    {
+        Real max_difference = 0.0;
+        for (const std::string &species_name : reaction_model_.getSpeciesNames())
+        {
+            StdLargeVec<Real> &reference = *reference_block_.getBaseParticles().getVariableDataByName<Real>(species_name);
+            StdLargeVec<Real> &batched = *batched_block_.getBaseParticles().getVariableDataByName<Real>(species_name);
+            for (size_t i = 0; i != reference_block_.getBaseParticles().TotalRealParticles(); ++i)
+                max_difference = SMAX(max_difference, ABS(reference[i] - batched[i]));
+        }
+        return max_difference;
+    };
+};
+
+TEST(test_BatchedReactionRelaxation, test_identicalWithoutSubCycling)
+{
+    ReactionBlocks blocks;
+    SimpleDynamics<ReactionRelaxationForward<ElectroPhysiologyReaction>>
+        reference_reaction(blocks.reference_block_, blocks.reaction_model_);
+    TestingBatchedReactionRelaxation batched_reaction(blocks.batched_block_, blocks.reaction_model_);
+
+    size_t total_real_particles = blocks.batched_block_.getBaseParticles().TotalRealParticles();
+    ASSERT_NE(total_real_particles % TestingBatchedReactionRelaxation::BatchSize, 0);
+
+    Real dt = 0.05;
+    for (size_t step = 0; step != 20; ++step)
+    {
+        reference_reaction.exec(dt);
+        batched_reaction.exec(dt);
+    }
+    EXPECT_LT(blocks.maxSpeciesDifference(), 1.0e-12);
+}
+
+TEST(test_BatchedReactionRelaxation, test_finalShortBatch)
+{
+    ReactionBlocks blocks;
+    TestingBatchedReactionRelaxation batched_reaction(blocks.batched_block_, blocks.reaction_model_);
+    size_t batch_size = TestingBatchedReactionRelaxation::BatchSize;
+    size_t total_real_particles = blocks.batched_block_.getBaseParticles().TotalRealParticles();
+    size_t first_index = (total_real_particles / batch_size) * batch_size;
+    size_t last_batch_size = total_real_particles - first_index;
+    ASSERT_GT(last_batch_size, 0);
+    ASSERT_LT(last_batch_size, batch_size);
+
+    // advancing only the last batch changes only the particles in the last batch
+    StdLargeVec<Real> &voltage = *blocks.batched_block_.getBaseParticles().getVariableDataByName<Real>("Voltage");
+    StdLargeVec<Real> initial_voltage = voltage;
+    Real dt = 0.05;
+    batched_reaction.advanceOneBatch(first_index, last_batch_size, dt);
+    for (size_t i = 0; i != first_index; ++i)
+        EXPECT_EQ(voltage[i], initial_voltage[i]);
+
+    ReactionRelaxationForward<ElectroPhysiologyReaction> reference_reaction(blocks.reference_block_, blocks.reaction_model_);
+    StdLargeVec<Real> &reference_voltage =
+        *blocks.reference_block_.getBaseParticles().getVariableDataByName<Real>("Voltage");
+    for (size_t i = first_index; i != total_real_particles; ++i)
+    {
+        reference_reaction.update(i, dt);
+        EXPECT_NEAR(voltage[i], reference_voltage[i], 1.0e-12);
+    }
+
+    // sub-steps are only given to the particles of the batch, refined for the fast reactions
+    batched_reaction.setAdaptiveSubCycling(200, 0.002);
+    std::array<size_t, TestingBatchedReactionRelaxation::BatchSize> sub_steps =
+        batched_reaction.getBatchSubStepNumbers(first_index, last_batch_size, 0.25);
+    size_t min_sub_steps = *std::min_element(sub_steps.begin(), sub_steps.begin() + last_batch_size);
+    size_t max_sub_steps = *std::max_element(sub_steps.begin(), sub_steps.begin() + last_batch_size);
+    EXPECT_GE(min_sub_steps, 1);
+    EXPECT_LT(min_sub_steps, max_sub_steps);
+    EXPECT_LE(max_sub_steps, 200);
+    for (size_t l = last_batch_size; l != batch_size; ++l)
+        EXPECT_EQ(sub_steps[l], 1);
+}
+
+TEST(test_BatchedReactionRelaxation, test_stiffSubCycling)
+{
+    ReactionBlocks blocks;
+    SimpleDynamics<ReactionRelaxationForward<ElectroPhysiologyReaction>>
+        reference_reaction(blocks.reference_block_, blocks.reaction_model_);
+    TestingBatchedReactionRelaxation batched_reaction(blocks.batched_block_, blocks.reaction_model_);
+    BaseParticles &batched_particles = blocks.batched_block_.getBaseParticles();
+    StdVec<StdLargeVec<Real>> initial_species;
+    for (const std::string &species_name : blocks.reaction_model_.getSpeciesNames())
+        initial_species.push_back(*batched_particles.getVariableDataByName<Real>(species_name));
+
+    // the reference solution with small time steps
+    Real dt = 0.25;
+    size_t number_of_steps = 4;
+    size_t reference_sub_steps = 1000;
+    for (size_t step = 0; step != number_of_steps * reference_sub_steps; ++step)
+        reference_reaction.exec(dt / Real(reference_sub_steps));
+
+    // large time steps without sub-cycling are inaccurate during the upstroke
+    for (size_t step = 0; step != number_of_steps; ++step)
+        batched_reaction.exec(dt);
+    Real error_without_sub_cycling = blocks.maxSpeciesDifference();
+
+    for (size_t k = 0; k != initial_species.size(); ++k)
+        *batched_particles.getVariableDataByName<Real>(blocks.reaction_model_.getSpeciesNames()[k]) = initial_species[k];
+    batched_reaction.setAdaptiveSubCycling(200, 0.002);
+    for (size_t step = 0; step != number_of_steps; ++step)
+        batched_reaction.exec(dt);
+    Real error_with_sub_cycling = blocks.maxSpeciesDifference();
+
+    EXPECT_GT(error_without_sub_cycling, 0.05);
+    EXPECT_LT(error_with_sub_cycling, 0.25 * error_without_sub_cycling);
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,123 @@
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+Real resolution_ref = 0.1;
+Real BW = 3.0 * resolution_ref;
+BoundingBox system_domain_bounds(Vec3d(-0.5 - BW, -0.5 - BW, -0.5 - BW), Vec3d(0.5 + BW, 0.5 + BW, 0.5 + BW));
+Vec3d halfsize_block(0.5, 0.5, 0.5);
+Vec3d halfsize_wall(0.5 * BW, 0.5, 0.5);
+Real diffusion_coeff = 1.0;
+Real wall_temperature = 1.0;
+Real convection = 2.0;
+Real temperature_infinity = 1.0;
+int number_of_steps = 40;
+
+/** the wall is at the left side of the block, the other sides have no flux */
+Transform wallTransform() { return Transform(Vec3d(-0.5 - 0.5 * BW, 0.0, 0.0)); };
+
+template <template <typename...> class BoundaryType>
+using ExplicitRelaxation = DiffusionBodyRelaxationComplex<
+    BaseDiffusion, KernelGradientInner, KernelGradientContact, BoundaryType>;
+template <template <typename...> class BoundaryType>
+using ImplicitRelaxation = DiffusionBodyRelaxationImplicit<
+    BaseDiffusion, KernelGradientInner, KernelGradientContact, BoundaryType>;
+
+/** the block is integrated with the explicit and the implicit scheme by the same time step,
+ *  and the maximum difference is returned together with the maximum of the explicit solution */
+template <template <typename...> class BoundaryType, class WallConditionFunction>
+std::pair<Real, Real> compareImplicitWithExplicit(WallConditionFunction &&setWallCondition)
+{
+    SPHSystem sph_system(system_domain_bounds, resolution_ref);
+    SolidBody explicit_block(sph_system, makeShared<GeometricShapeBox>(halfsize_block, "ExplicitBlock"));
+    IsotropicDiffusion *explicit_diffusion = explicit_block.defineMaterial<IsotropicDiffusion>("Phi", diffusion_coeff);
+    explicit_block.generateParticles<BaseParticles, Lattice>();
+    SolidBody implicit_block(sph_system, makeShared<GeometricShapeBox>(halfsize_block, "ImplicitBlock"));
+    IsotropicDiffusion *implicit_diffusion = implicit_block.defineMaterial<IsotropicDiffusion>("Phi", diffusion_coeff);
+    implicit_block.generateParticles<BaseParticles, Lattice>();
+    SolidBody wall(sph_system, makeShared<TransformShape<GeometricShapeBox>>(wallTransform(), halfsize_wall, "Wall"));
+    wall.defineMaterial<Solid>();
+    wall.generateParticles<BaseParticles, Lattice>();
+
+    InnerRelation explicit_block_inner(explicit_block);
+    InnerRelation implicit_block_inner(implicit_block);
+    ContactRelation explicit_block_contact(explicit_block, {&wall});
+    ContactRelation implicit_block_contact(implicit_block, {&wall});
+
+    SimpleDynamics<NormalDirectionFromBodyShape> explicit_block_normal_direction(explicit_block);
+    SimpleDynamics<NormalDirectionFromBodyShape> implicit_block_normal_direction(implicit_block);
+    SimpleDynamics<NormalDirectionFromBodyShape> wall_normal_direction(wall);
+    ExplicitRelaxation<BoundaryType> explicit_relaxation(
+        ConstructorArgs(explicit_block_inner, explicit_diffusion),
+        ConstructorArgs(explicit_block_contact, explicit_diffusion));
+    ImplicitRelaxation<BoundaryType> implicit_relaxation(
+        ConstructorArgs(implicit_block_inner, implicit_diffusion),
+        ConstructorArgs(implicit_block_contact, implicit_diffusion));
+    implicit_relaxation.setImplicitWeight(0.5);
+    implicit_relaxation.setSolverTolerance(1.0e-8, 500);
+    GetDiffusionTimeStepSize get_time_step_size(explicit_block, *explicit_diffusion);
+
+    sph_system.initializeSystemCellLinkedLists();
+    sph_system.initializeSystemConfigurations();
+    explicit_block_normal_direction.exec();
+    implicit_block_normal_direction.exec();
+    wall_normal_direction.exec();
+    setWallCondition(wall.getBaseParticles());
+
+    Real dt = get_time_step_size.exec();
+    for (int step = 0; step != number_of_steps; ++step)
+    {
+        explicit_relaxation.exec(dt);
+        implicit_relaxation.exec(dt);
+        EXPECT_LT(implicit_relaxation.NumberOfIterations(), size_t(500));
+    }
+
+    BaseParticles &explicit_particles = explicit_block.getBaseParticles();
+    BaseParticles &implicit_particles = implicit_block.getBaseParticles();
+    StdLargeVec<Real> &explicit_phi = *explicit_particles.getVariableDataByName<Real>("Phi");
+    StdLargeVec<Real> &implicit_phi = *implicit_particles.getVariableDataByName<Real>("Phi");
+    Real max_difference = 0.0;
+    Real max_phi = 0.0;
+    for (size_t i = 0; i != explicit_particles.TotalRealParticles(); ++i)
+    {
+        max_difference = SMAX(max_difference, ABS(explicit_phi[i] - implicit_phi[i]));
+        max_phi = SMAX(max_phi, explicit_phi[i]);
+    }
+    return std::make_pair(max_difference, max_phi);
+}
+
+TEST(test_ImplicitDiffusion, test_DirichletBoundary)
+{
+    std::pair<Real, Real> result = compareImplicitWithExplicit<Dirichlet>(
+        [&](BaseParticles &wall_particles)
+        {
+            StdLargeVec<Real> &phi = *wall_particles.getVariableDataByName<Real>("Phi");
+            for (size_t i = 0; i != wall_particles.TotalRealParticles(); ++i)
+                phi[i] = wall_temperature;
+        });
+    // the block is heated from the wall
+    EXPECT_GT(result.second, 0.1 * wall_temperature);
+    EXPECT_LT(result.first, 1.0e-3 * result.second);
+}
+
+TEST(test_ImplicitDiffusion, test_RobinBoundary)
+{
+    std::pair<Real, Real> result = compareImplicitWithExplicit<Robin>(
+        [&](BaseParticles &wall_particles)
+        {
+            StdLargeVec<Real> &phi_convection = *wall_particles.getVariableDataByName<Real>("PhiConvection");
+            for (size_t i = 0; i != wall_particles.TotalRealParticles(); ++i)
+                phi_convection[i] = convection;
+            *wall_particles.getSingleVariableByName<Real>("PhiInfinity") = temperature_infinity;
+        });
+    // the block is heated by the convection at the wall
+    EXPECT_GT(result.second, 0.01 * temperature_infinity);
+    EXPECT_LT(result.first, 1.0e-3 * result.second);
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
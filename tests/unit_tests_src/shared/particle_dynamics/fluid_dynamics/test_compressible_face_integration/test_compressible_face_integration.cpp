@@ -0,0 +1,165 @@
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+std::string mesh_fullpath = "./input/Channel_ICEM.msh";
+BoundingBox system_domain_bounds(Vec3d(-0.3, 0.0, 0.0), Vec3d(0.469846, 0.5, 0.03));
+Real rho0 = 1.0;
+Real heat_capacity_ratio = 1.4;
+int number_of_steps = 10;
+
+/** a smooth but non-uniform state, so that all faces carry fluxes */
+class WaveInitialCondition : public fluid_dynamics::CompressibleFluidInitialCondition
+{
+  public:
+    explicit WaveInitialCondition(SPHBody &sph_body)
+        : fluid_dynamics::CompressibleFluidInitialCondition(sph_body){};
+
+    void update(size_t index_i, Real dt)
+    {
+        Vecd &pos = pos_[index_i];
+        rho_[index_i] = rho0 * (1.0 + 0.2 * sin(4.0 * pos[0]) * cos(3.0 * pos[1]));
+        mass_[index_i] = rho_[index_i] * Vol_[index_i];
+        p_[index_i] = 1.0 + 0.3 * cos(5.0 * pos[0] + 2.0 * pos[1]);
+        vel_[index_i] = Vec3d(0.5 + 0.1 * pos[1], -0.2 * pos[0], 0.0);
+        mom_[index_i] = mass_[index_i] * vel_[index_i];
+        Real rho_e = p_[index_i] / (heat_capacity_ratio - 1.0);
+        E_[index_i] = rho_e * Vol_[index_i] + 0.5 * mass_[index_i] * vel_[index_i].squaredNorm();
+    }
+};
+
+/** all boundaries are walls, open boundaries copy the state of the inner cell */
+class WallBoundaryConditionSetup : public BoundaryConditionSetupInFVM
+{
+  public:
+    WallBoundaryConditionSetup(BaseInnerRelationInFVM &inner_relation, GhostCreationFromMesh &ghost_creation)
+        : BoundaryConditionSetupInFVM(inner_relation, ghost_creation),
+          E_(*particles_->getVariableDataByName<Real>("TotalEnergy")){};
+
+    void applyReflectiveWallBoundary(size_t ghost_index, size_t index_i, Vecd e_ij) override
+    {
+        copyState(ghost_index, index_i);
+        vel_[ghost_index] = vel_[index_i] - 2.0 * e_ij.dot(vel_[index_i]) * e_ij;
+        mom_[ghost_index] = mass_[ghost_index] * vel_[ghost_index];
+    }
+    void applySymmetryBoundary(size_t ghost_index, size_t index_i, Vecd e_ij) override
+    {
+        applyReflectiveWallBoundary(ghost_index, index_i, e_ij);
+    }
+    void applyVelocityInletFlow(size_t ghost_index, size_t index_i) override { copyState(ghost_index, index_i); }
+    void applyPressureOutletBC(size_t ghost_index, size_t index_i) override { copyState(ghost_index, index_i); }
+    void applyOutletBoundary(size_t ghost_index, size_t index_i) override { copyState(ghost_index, index_i); }
+
+  protected:
+    StdLargeVec<Real> &E_;
+
+    void copyState(size_t ghost_index, size_t index_i)
+    {
+        rho_[ghost_index] = rho_[index_i];
+        mass_[ghost_index] = rho_[ghost_index] * Vol_[ghost_index];
+        p_[ghost_index] = p_[index_i];
+        vel_[ghost_index] = vel_[index_i];
+        mom_[ghost_index] = mass_[ghost_index] * vel_[ghost_index];
+        E_[ghost_index] = E_[index_i] / Vol_[index_i] * Vol_[ghost_index];
+    }
+};
+
+/** the same initial state is integrated by the face-based and by the cell-based scheme */
+template <class FaceIntegration1stHalf, class FaceIntegration2ndHalf,
+          class CellIntegration1stHalf, class CellIntegration2ndHalf>
+void expectSameConservedVariables()
+{
+    ANSYSMesh mesh(mesh_fullpath);
+    SPHSystem sph_system(system_domain_bounds, mesh.MinMeshEdge());
+    Vec3d halfsize = 0.5 * (system_domain_bounds.second_ - system_domain_bounds.first_);
+    Transform translation(0.5 * (system_domain_bounds.second_ + system_domain_bounds.first_));
+
+    FluidBody face_block(sph_system, makeShared<TransformShape<GeometricShapeBox>>(translation, halfsize, "FaceBlock"));
+    face_block.defineMaterial<CompressibleFluid>(rho0, heat_capacity_ratio);
+    Ghost<ReserveSizeFactor> face_ghost_boundary(0.5);
+    face_block.generateParticlesWithReserve<BaseParticles, UnstructuredMesh>(face_ghost_boundary, mesh);
+    GhostCreationFromMesh face_ghost_creation(face_block, mesh, face_ghost_boundary);
+    InnerRelationInFVM face_block_inner(face_block, mesh);
+
+    FluidBody cell_block(sph_system, makeShared<TransformShape<GeometricShapeBox>>(translation, halfsize, "CellBlock"));
+    cell_block.defineMaterial<CompressibleFluid>(rho0, heat_capacity_ratio);
+    Ghost<ReserveSizeFactor> cell_ghost_boundary(0.5);
+    cell_block.generateParticlesWithReserve<BaseParticles, UnstructuredMesh>(cell_ghost_boundary, mesh);
+    GhostCreationFromMesh cell_ghost_creation(cell_block, mesh, cell_ghost_boundary);
+    InnerRelationInFVM cell_block_inner(cell_block, mesh);
+
+    FaceIntegration1stHalf face_pressure_relaxation(face_block_inner);
+    FaceIntegration2ndHalf face_density_relaxation(face_block_inner);
+    InteractionWithUpdate<CellIntegration1stHalf> cell_pressure_relaxation(cell_block_inner);
+    InteractionWithUpdate<CellIntegration2ndHalf> cell_density_relaxation(cell_block_inner);
+    SimpleDynamics<WaveInitialCondition> face_initial_condition(face_block);
+    SimpleDynamics<WaveInitialCondition> cell_initial_condition(cell_block);
+    WallBoundaryConditionSetup face_boundary_condition_setup(face_block_inner, face_ghost_creation);
+    WallBoundaryConditionSetup cell_boundary_condition_setup(cell_block_inner, cell_ghost_creation);
+
+    face_block_inner.updateConfiguration();
+    cell_block_inner.updateConfiguration();
+    face_initial_condition.exec();
+    cell_initial_condition.exec();
+    BaseParticles &face_particles = face_block.getBaseParticles();
+    BaseParticles &cell_particles = cell_block.getBaseParticles();
+    StdLargeVec<Real> &face_mass = *face_particles.getVariableDataByName<Real>("Mass");
+    StdLargeVec<Real> initial_mass(face_mass.begin(), face_mass.begin() + face_particles.TotalRealParticles());
+
+    Real dt = 0.05 * mesh.MinMeshEdge();
+    for (int step = 0; step != number_of_steps; ++step)
+    {
+        face_boundary_condition_setup.resetBoundaryConditions();
+        face_pressure_relaxation.exec(dt);
+        face_boundary_condition_setup.resetBoundaryConditions();
+        face_density_relaxation.exec(dt);
+
+        cell_boundary_condition_setup.resetBoundaryConditions();
+        cell_pressure_relaxation.exec(dt);
+        cell_boundary_condition_setup.resetBoundaryConditions();
+        cell_density_relaxation.exec(dt);
+    }
+
+    ASSERT_EQ(face_particles.TotalRealParticles(), cell_particles.TotalRealParticles());
+    StdLargeVec<Real> &cell_mass = *cell_particles.getVariableDataByName<Real>("Mass");
+    StdLargeVec<Vecd> &face_mom = *face_particles.getVariableDataByName<Vecd>("Momentum");
+    StdLargeVec<Vecd> &cell_mom = *cell_particles.getVariableDataByName<Vecd>("Momentum");
+    StdLargeVec<Real> &face_E = *face_particles.getVariableDataByName<Real>("TotalEnergy");
+    StdLargeVec<Real> &cell_E = *cell_particles.getVariableDataByName<Real>("TotalEnergy");
+    StdLargeVec<Real> &Vol = *face_particles.getVariableDataByName<Real>("VolumetricMeasure");
+    Real max_change = 0.0;
+    for (size_t i = 0; i != face_particles.TotalRealParticles(); ++i)
+    {
+        // compared by the cell densities, as the cells differ much in volume
+        Real tolerance = 1.0e-10 * Vol[i];
+        EXPECT_NEAR(face_mass[i], cell_mass[i], tolerance);
+        EXPECT_NEAR((face_mom[i] - cell_mom[i]).norm(), 0.0, tolerance);
+        EXPECT_NEAR(face_E[i], cell_E[i], tolerance);
+        max_change = SMAX(max_change, ABS(face_mass[i] - initial_mass[i]) / Vol[i]);
+    }
+    // the state has been changed by the fluxes
+    EXPECT_GT(max_change, 1.0e-4);
+}
+
+TEST(test_CompressibleFaceIntegration, test_HLLCRiemann)
+{
+    expectSameConservedVariables<fluid_dynamics::EulerianCompressibleFaceIntegration1stHalfHLLCRiemann,
+                                 fluid_dynamics::EulerianCompressibleFaceIntegration2ndHalfHLLCRiemann,
+                                 fluid_dynamics::EulerianCompressibleIntegration1stHalfHLLCRiemann,
+                                 fluid_dynamics::EulerianCompressibleIntegration2ndHalfHLLCRiemann>();
+}
+
+TEST(test_CompressibleFaceIntegration, test_HLLCWithLimiterRiemann)
+{
+    expectSameConservedVariables<fluid_dynamics::EulerianCompressibleFaceIntegration1stHalfHLLCWithLimiterRiemann,
+                                 fluid_dynamics::EulerianCompressibleFaceIntegration2ndHalfHLLCWithLimiterRiemann,
+                                 fluid_dynamics::EulerianCompressibleIntegration1stHalfHLLCWithLimiterRiemann,
+                                 fluid_dynamics::EulerianCompressibleIntegration2ndHalfHLLCWithLimiterRiemann>();
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
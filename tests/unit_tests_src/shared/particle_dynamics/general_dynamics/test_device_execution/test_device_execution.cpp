@@ -0,0 +1,190 @@
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+Real resolution_ref = 0.1;
+Vec3d halfsize_water(0.5, 0.5, 0.5);
+BoundingBox system_domain_bounds(-halfsize_water, halfsize_water);
+
+class WaterBlock : public FluidBody
+{
+  public:
+    explicit WaterBlock(SPHSystem &sph_system)
+        : FluidBody(sph_system, makeShared<GeometricShapeBox>(halfsize_water, "WaterBody"))
+    {
+        defineMaterial<WeaklyCompressibleFluid>(1.0, 10.0);
+        generateParticles<BaseParticles, Lattice>();
+    };
+};
+
+/** The device data path, run on the SYCL device or on the host without SYCL, is checked against par. */
+class test_DeviceExecution : public testing::Test
+{
+  protected:
+    SPHSystem sph_system_{system_domain_bounds, resolution_ref};
+    WaterBlock water_block_{sph_system_};
+    InnerRelation water_block_inner_{water_block_};
+    size_t total_real_particles_ = water_block_.getBaseParticles().TotalRealParticles();
+    StdLargeVec<Real> *mass_ = nullptr;
+    StdLargeVec<Vecd> *vel_ = nullptr;
+
+    void SetUp() override
+    {
+        BaseParticles &particles = water_block_.getBaseParticles();
+        StdLargeVec<Vecd> &pos = particles.ParticlePositions();
+        mass_ = particles.getVariableDataByName<Real>("Mass");
+        vel_ = particles.registerSharedVariable<Vecd>(
+            "Velocity", [&](size_t i) -> Vecd
+            { return Vec3d(pos[i][1], -pos[i][0], pos[i][0] * pos[i][2]); });
+        sph_system_.initializeSystemCellLinkedLists();
+        sph_system_.initializeSystemConfigurations();
+    }
+};
+
+TEST_F(test_DeviceExecution, test_deviceVariable)
+{
+    StdLargeVec<Vecd> &vel = *vel_;
+    StdLargeVec<Vecd> scaled_vel(vel.size(), Vecd::Zero());
+    DeviceVariable<Vecd> device_vel(vel);
+    DeviceVariable<Vecd> device_scaled_vel(scaled_vel);
+    device_vel.copyToDevice(total_real_particles_);
+
+    Vecd *vel_device = device_vel.DeviceData();
+    Vecd *scaled_vel_device = device_scaled_vel.DeviceData();
+    particle_for(par_device, IndexRange(0, total_real_particles_),
+                 [=](size_t i)
+                 { scaled_vel_device[i] = 2.0 * vel_device[i]; });
+    device_scaled_vel.copyFromDevice(total_real_particles_);
+    for (size_t i = 0; i != total_real_particles_; ++i)
+    {
+        EXPECT_EQ(scaled_vel[i], 2.0 * vel[i]);
+    }
+
+    // the device copy is not changed by the host until it is copied again
+    StdLargeVec<Vecd> initial_vel(vel.begin(), vel.begin() + total_real_particles_);
+    particle_for(par, IndexRange(0, total_real_particles_),
+                 [&](size_t i)
+                 { vel[i] = Vecd::Zero(); });
+    device_vel.copyFromDevice(total_real_particles_);
+    for (size_t i = 0; i != total_real_particles_; ++i)
+    {
+        EXPECT_EQ(vel[i], initial_vel[i]);
+    }
+}
+
+TEST_F(test_DeviceExecution, test_particleReduce)
+{
+    StdLargeVec<Real> &mass = *mass_;
+    StdLargeVec<Vecd> &vel = *vel_;
+    DeviceVariable<Real> device_mass(mass);
+    DeviceVariable<Vecd> device_vel(vel);
+    device_mass.copyToDevice(total_real_particles_);
+    device_vel.copyToDevice(total_real_particles_);
+
+    Real *mass_device = device_mass.DeviceData();
+    Vecd *vel_device = device_vel.DeviceData();
+    Real device_kinetic_energy =
+        particle_reduce(par_device, IndexRange(0, total_real_particles_), Real(0), ReduceSum<Real>(),
+                        [=](size_t i)
+                        { return 0.5 * mass_device[i] * vel_device[i].squaredNorm(); });
+    Real kinetic_energy =
+        particle_reduce(par, IndexRange(0, total_real_particles_), Real(0), ReduceSum<Real>(),
+                        [&](size_t i)
+                        { return 0.5 * mass[i] * vel[i].squaredNorm(); });
+    EXPECT_GT(kinetic_energy, 0.0);
+    EXPECT_NEAR(device_kinetic_energy, kinetic_energy, 1.0e-12 * kinetic_energy);
+
+    Real device_max_speed =
+        particle_reduce(par_device, IndexRange(0, total_real_particles_), Real(0), ReduceMax(),
+                        [=](size_t i)
+                        { return vel_device[i].norm(); });
+    Real max_speed =
+        particle_reduce(par, IndexRange(0, total_real_particles_), Real(0), ReduceMax(),
+                        [&](size_t i)
+                        { return vel[i].norm(); });
+    EXPECT_EQ(device_max_speed, max_speed);
+}
+
+TEST_F(test_DeviceExecution, test_deviceConfiguration)
+{
+    ParticleConfiguration &configuration = water_block_inner_.inner_configuration_;
+    StdLargeVec<Vecd> &pos = water_block_.getBaseParticles().ParticlePositions();
+    StdLargeVec<Real> neighbor_summation(total_real_particles_, 0.0);
+    StdLargeVec<Vecd> gradient_summation(total_real_particles_, Vecd::Zero());
+    DeviceVariable<Vecd> device_pos(pos);
+    DeviceVariable<Real> device_neighbor_summation(neighbor_summation);
+    DeviceVariable<Vecd> device_gradient_summation(gradient_summation);
+    DeviceConfiguration device_configuration;
+
+    auto expectSameNeighborhoods = [&]()
+    {
+        device_pos.copyToDevice(total_real_particles_);
+        device_configuration.copyToDevice(configuration, total_real_particles_);
+        Vecd *pos_device = device_pos.DeviceData();
+        Real *neighbor_summation_device = device_neighbor_summation.DeviceData();
+        Vecd *gradient_summation_device = device_gradient_summation.DeviceData();
+        DeviceNeighborhoods neighborhoods = device_configuration.getDeviceNeighborhoods();
+        // all neighbor data are summed, the neighbor indices through the neighbor positions
+        particle_for(par_device, IndexRange(0, total_real_particles_),
+                     [=](size_t i)
+                     {
+                         Real summation = Real(neighborhoods.offset_[i + 1] - neighborhoods.offset_[i]);
+                         Vecd gradient = Vecd::Zero();
+                         for (size_t k = neighborhoods.offset_[i]; k != neighborhoods.offset_[i + 1]; ++k)
+                         {
+                             summation += neighborhoods.W_ij_[k] + neighborhoods.r_ij_[k];
+                             gradient += neighborhoods.dW_ij_[k] * neighborhoods.e_ij_[k] + pos_device[neighborhoods.j_[k]];
+                         }
+                         neighbor_summation_device[i] = summation;
+                         gradient_summation_device[i] = gradient;
+                     });
+        device_neighbor_summation.copyFromDevice(total_real_particles_);
+        device_gradient_summation.copyFromDevice(total_real_particles_);
+
+        StdLargeVec<Real> host_neighbor_summation(total_real_particles_);
+        StdLargeVec<Vecd> host_gradient_summation(total_real_particles_);
+        particle_for(par, IndexRange(0, total_real_particles_),
+                     [&](size_t i)
+                     {
+                         const Neighborhood &neighborhood = configuration[i];
+                         Real summation = Real(neighborhood.current_size_);
+                         Vecd gradient = Vecd::Zero();
+                         for (size_t n = 0; n != neighborhood.current_size_; ++n)
+                         {
+                             summation += neighborhood.W_ij_[n] + neighborhood.r_ij_[n];
+                             gradient += neighborhood.dW_ij_[n] * neighborhood.e_ij_[n] + pos[neighborhood.j_[n]];
+                         }
+                         host_neighbor_summation[i] = summation;
+                         host_gradient_summation[i] = gradient;
+                     });
+        for (size_t i = 0; i != total_real_particles_; ++i)
+        {
+            EXPECT_NEAR(neighbor_summation[i], host_neighbor_summation[i], 1.0e-12 * host_neighbor_summation[i]);
+            EXPECT_LT((gradient_summation[i] - host_gradient_summation[i]).norm(),
+                      1.0e-12 * (host_gradient_summation[i].norm() + 1.0));
+        }
+    };
+
+    expectSameNeighborhoods();
+
+    // the device neighborhoods are reallocated when there are more neighbors
+    size_t number_of_neighbors = 0;
+    for (size_t i = 0; i != total_real_particles_; ++i)
+        number_of_neighbors += configuration[i].current_size_;
+    for (size_t i = 0; i != total_real_particles_; ++i)
+        pos[i] *= 0.8;
+    water_block_.updateCellLinkedList();
+    water_block_inner_.updateConfiguration();
+    size_t number_of_compressed_neighbors = 0;
+    for (size_t i = 0; i != total_real_particles_; ++i)
+        number_of_compressed_neighbors += configuration[i].current_size_;
+    EXPECT_GT(number_of_compressed_neighbors, number_of_neighbors);
+    expectSameNeighborhoods();
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,95 @@
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+Real resolution_ref = 0.05;
+BoundingBox system_domain_bounds(Vec3d(-0.5, -0.5, -0.5), Vec3d(0.5, 0.5, 0.5));
+Real split_threshold = 0.8;
+Real merge_threshold = 0.2;
+
+struct ConservedQuantities
+{
+    Real mass_ = 0.0;
+    Real volume_ = 0.0;
+    Vecd momentum_ = Vecd::Zero();
+    Vecd mass_moment_ = Vecd::Zero();
+};
+
+ConservedQuantities getConservedQuantities(BaseParticles &particles)
+{
+    StdLargeVec<Real> &mass = *particles.getVariableDataByName<Real>("Mass");
+    StdLargeVec<Real> &Vol = *particles.getVariableDataByName<Real>("VolumetricMeasure");
+    StdLargeVec<Vecd> &vel = *particles.getVariableDataByName<Vecd>("Velocity");
+    StdLargeVec<Vecd> &pos = *particles.getVariableDataByName<Vecd>("Position");
+    ConservedQuantities quantities;
+    for (size_t i = 0; i != particles.TotalRealParticles(); ++i)
+    {
+        quantities.mass_ += mass[i];
+        quantities.volume_ += Vol[i];
+        quantities.momentum_ += mass[i] * vel[i];
+        quantities.mass_moment_ += mass[i] * pos[i];
+    }
+    return quantities;
+}
+
+void expectConserved(const ConservedQuantities &before, const ConservedQuantities &after)
+{
+    EXPECT_NEAR(after.mass_, before.mass_, 1.0e-10 * before.mass_);
+    EXPECT_NEAR(after.volume_, before.volume_, 1.0e-10 * before.volume_);
+    EXPECT_LT((after.momentum_ - before.momentum_).norm(), 1.0e-10 * before.mass_);
+    EXPECT_LT((after.mass_moment_ - before.mass_moment_).norm(), 1.0e-10 * before.mass_);
+}
+
+TEST(test_ParticleSplitAndMerge, test_conservation)
+{
+    SPHSystem sph_system(system_domain_bounds, resolution_ref);
+    SolidBody block(sph_system, makeShared<GeometricShapeBox>(0.25 * Vec3d::Ones(), "Block"));
+    block.defineAdaptation<ParticleWithLocalRefinement>(1.3, 1.0, 1);
+    block.defineMaterial<Solid>();
+    ParticleBuffer<ReserveSizeFactor> particle_buffer(8.0);
+    block.generateParticlesWithReserve<BaseParticles, Lattice>(particle_buffer);
+    BaseParticles &particles = block.getBaseParticles();
+
+    // a rotating block with particles to be split at one side
+    StdLargeVec<Vecd> &pos = *particles.getVariableDataByName<Vecd>("Position");
+    particles.registerSharedVariable<Vecd>("Velocity", [&](size_t i) -> Vecd
+                                           { return Vecd(-pos[i][1], pos[i][0], 0.1); });
+    StdLargeVec<Real> &indicator = *particles.registerSharedVariable<Real>(
+        "RefinementIndicator", [&](size_t i) -> Real
+        { return pos[i][0] < 0.0 ? 1.0 : 0.5; });
+
+    AdaptiveInnerRelation block_inner(block);
+    ParticleSplitAndMerge split_and_merge(block_inner, particle_buffer, "RefinementIndicator",
+                                          split_threshold, merge_threshold);
+
+    // splitting
+    block.updateCellLinkedList();
+    block_inner.updateConfiguration();
+    size_t total_particles = particles.TotalRealParticles();
+    ConservedQuantities before_split = getConservedQuantities(particles);
+    split_and_merge.exec();
+    EXPECT_EQ(split_and_merge.NumberOfSplitParticles(), total_particles / 2);
+    EXPECT_EQ(split_and_merge.NumberOfMergedParticles(), 0);
+    EXPECT_EQ(particles.TotalRealParticles(), total_particles + 7 * split_and_merge.NumberOfSplitParticles());
+    expectConserved(before_split, getConservedQuantities(particles));
+
+    // merging the split particles, the original particles are not coarsened
+    total_particles = particles.TotalRealParticles();
+    for (size_t i = 0; i != total_particles; ++i)
+        indicator[i] = 0.0;
+    block.updateCellLinkedList();
+    block_inner.updateConfiguration();
+    ConservedQuantities before_merge = getConservedQuantities(particles);
+    split_and_merge.exec();
+    EXPECT_EQ(split_and_merge.NumberOfSplitParticles(), 0);
+    EXPECT_GT(split_and_merge.NumberOfMergedParticles(), 0);
+    EXPECT_EQ(particles.TotalRealParticles(), total_particles - split_and_merge.NumberOfMergedParticles());
+    expectConserved(before_merge, getConservedQuantities(particles));
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,94 @@
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+Real resolution_ref = 0.1;
+BoundingBox system_domain_bounds(Vec3d(-1.0, -1.0, -1.0), Vec3d(1.0, 1.0, 1.0));
+Vec3d halfsize_block(0.5, 0.5, 0.5);
+Vec3d field_gradient(0.3, -1.2, 0.7);
+Real field_offset = 2.0;
+
+Real linearField(const Vecd &position)
+{
+    return field_offset + field_gradient.dot(position);
+}
+
+class test_PointProbe : public testing::Test
+{
+  protected:
+    SPHSystem sph_system_;
+    SolidBody block_;
+    StdLargeVec<Vecd> *pos_ = nullptr;
+
+    test_PointProbe()
+        : sph_system_(system_domain_bounds, resolution_ref),
+          block_(sph_system_, makeShared<GeometricShapeBox>(halfsize_block, "Block"))
+    {
+        block_.defineMaterial<Solid>();
+        block_.generateParticles<BaseParticles, Lattice>();
+        BaseParticles &particles = block_.getBaseParticles();
+        StdLargeVec<Vecd> &pos = *particles.getVariableDataByName<Vecd>("Position");
+        pos_ = &pos;
+        particles.registerSharedVariable<Real>("LinearField", [&](size_t i) -> Real
+                                               { return linearField(pos[i]); });
+        particles.registerSharedVariable<Vecd>("LinearVectorField", [&](size_t i) -> Vecd
+                                               { return linearField(pos[i]) * Vecd::Ones() + pos[i]; });
+        sph_system_.initializeSystemCellLinkedLists();
+    };
+};
+
+TEST_F(test_PointProbe, test_searchNeighborsByPosition)
+{
+    CellLinkedList &cell_linked_list = *DynamicCast<CellLinkedList>(this, &block_.getCellLinkedList());
+    Kernel &kernel = *block_.sph_adaptation_->getKernel();
+    StdVec<Vecd> points = {Vecd(0.0, 0.0, 0.0), Vecd(0.47, -0.33, 0.12), Vecd(-0.55, 0.55, 0.5)};
+    for (const Vecd &point : points)
+    {
+        std::set<size_t> candidates;
+        cell_linked_list.searchNeighborsByPosition(
+            point, 1, [&](const ListData &list_data)
+            { candidates.insert(list_data.first); });
+
+        // all particles within the cut-off radius are among the candidates
+        size_t number_of_neighbors = 0;
+        for (size_t i = 0; i != block_.getBaseParticles().TotalRealParticles(); ++i)
+        {
+            if (kernel.checkIfWithinCutOffRadius(Vecd(point - (*pos_)[i])))
+            {
+                number_of_neighbors++;
+                EXPECT_EQ(candidates.count(i), 1);
+            }
+        }
+        EXPECT_GT(number_of_neighbors, 0);
+    }
+}
+
+TEST_F(test_PointProbe, test_correctedInterpolationOfLinearField)
+{
+    PointProbe<Real> probe(block_, "LinearField");
+    PointProbe<Real> corrected_probe(block_, "LinearField", true);
+    PointProbe<Vecd> corrected_vector_probe(block_, "LinearVectorField", true);
+
+    // points in the interior, close to a face, an edge and a corner of the block
+    StdVec<Vecd> points = {Vecd(0.03, -0.02, 0.01), Vecd(0.47, 0.1, -0.2),
+                           Vecd(-0.1, -0.48, 0.46), Vecd(0.48, 0.49, -0.47)};
+    StdVec<Real> corrected_values = corrected_probe.probe(points);
+    for (size_t k = 0; k != points.size(); ++k)
+    {
+        Real exact_value = linearField(points[k]);
+        EXPECT_NEAR(corrected_values[k], exact_value, 1.0e-6);
+        EXPECT_NEAR(corrected_probe.probe(points[k]), exact_value, 1.0e-6);
+        Vecd exact_vector = exact_value * Vecd::Ones() + points[k];
+        EXPECT_LT((corrected_vector_probe.probe(points[k]) - exact_vector).norm(), 1.0e-6);
+    }
+
+    // without correction, the interpolation is not exact near the boundary
+    EXPECT_GT(ABS(probe.probe(points[3]) - linearField(points[3])), 1.0e-3);
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
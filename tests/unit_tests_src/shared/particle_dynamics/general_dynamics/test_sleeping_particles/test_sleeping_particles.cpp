@@ -0,0 +1,151 @@
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+Real resolution_ref = 0.1;
+BoundingBox system_domain_bounds(Vec3d(-0.8, -0.8, -0.8), Vec3d(2.0, 0.8, 0.8));
+Vec3d halfsize_block(0.5, 0.5, 0.5);
+Vec3d halfsize_impactor(0.2, 0.2, 0.2);
+Vec3d translation_impactor(1.3, 0.0, 0.0);
+Real impact_velocity = 0.2;
+Real rho0_s = 1.0;
+Real Youngs_modulus = 1.0;
+Real poisson = 0.3;
+Real velocity_threshold = 1.0e-3;
+Real acceleration_threshold = 1.0e-2;
+Real end_time = 6.0;
+Real time_before_impact = 1.5; // the impactor reaches the block at about t = 3.0
+
+struct ImpactResult
+{
+    StdLargeVec<Vecd> block_position_;
+    StdLargeVec<Vecd> block_velocity_;
+    size_t sleeping_before_impact_ = 0;
+    size_t sleeping_after_impact_ = 0;
+};
+
+/** A resting block, with or without sleeping particles, is hit by a moving impactor. */
+ImpactResult runImpact(bool use_sleeping_particles)
+{
+    SPHSystem sph_system(system_domain_bounds, resolution_ref);
+    SolidBody block(sph_system, makeShared<GeometricShapeBox>(halfsize_block, "Block"));
+    block.defineMaterial<SaintVenantKirchhoffSolid>(rho0_s, Youngs_modulus, poisson);
+    block.generateParticles<BaseParticles, Lattice>();
+
+    SolidBody impactor(sph_system, makeShared<TransformShape<GeometricShapeBox>>(
+                                       Transform(translation_impactor), halfsize_impactor, "Impactor"));
+    impactor.defineMaterial<SaintVenantKirchhoffSolid>(rho0_s, Youngs_modulus, poisson);
+    impactor.generateParticles<BaseParticles, Lattice>();
+    impactor.getBaseParticles().registerSharedVariable<Vecd>(
+        "Velocity", [&](size_t i) -> Vecd
+        { return -impact_velocity * Vecd::UnitX(); });
+
+    InnerRelation block_inner(block);
+    InnerRelation impactor_inner(impactor);
+    SurfaceContactRelation block_impactor_contact(block, {&impactor});
+    SurfaceContactRelation impactor_block_contact(impactor, {&block});
+
+    ActiveParticles active_particles(block);
+    UpdateParticleActivity update_particle_activity(block_inner, active_particles,
+                                                    velocity_threshold, acceleration_threshold);
+
+    InteractionWithUpdate<LinearGradientCorrectionMatrixInner> block_corrected_configuration(block_inner);
+    InteractionWithUpdate<LinearGradientCorrectionMatrixInner> impactor_corrected_configuration(impactor_inner);
+    Dynamics1Level<solid_dynamics::Integration1stHalfPK2> block_stress_relaxation_first_half(block_inner);
+    Dynamics1Level<solid_dynamics::Integration2ndHalf> block_stress_relaxation_second_half(block_inner);
+    ActiveParticleDynamics<solid_dynamics::Integration1stHalfPK2> active_block_stress_relaxation_first_half(active_particles, block_inner);
+    ActiveParticleDynamics<solid_dynamics::Integration2ndHalf> active_block_stress_relaxation_second_half(active_particles, block_inner);
+    Dynamics1Level<solid_dynamics::Integration1stHalfPK2> impactor_stress_relaxation_first_half(impactor_inner);
+    Dynamics1Level<solid_dynamics::Integration2ndHalf> impactor_stress_relaxation_second_half(impactor_inner);
+    // the contact forces are prior forces computed for all particles, so that the sleeping ones are woken up
+    InteractionDynamics<solid_dynamics::ContactDensitySummation> block_update_contact_density(block_impactor_contact);
+    InteractionDynamics<solid_dynamics::ContactDensitySummation> impactor_update_contact_density(impactor_block_contact);
+    InteractionWithUpdate<solid_dynamics::ContactForce> block_compute_contact_forces(block_impactor_contact);
+    InteractionWithUpdate<solid_dynamics::ContactForce> impactor_compute_contact_forces(impactor_block_contact);
+    ReduceDynamics<solid_dynamics::AcousticTimeStepSize> block_computing_time_step_size(block);
+    ReduceDynamics<solid_dynamics::AcousticTimeStepSize> impactor_computing_time_step_size(impactor);
+
+    GlobalStaticVariables::physical_time_ = 0.0;
+    sph_system.initializeSystemCellLinkedLists();
+    sph_system.initializeSystemConfigurations();
+    block_corrected_configuration.exec();
+    impactor_corrected_configuration.exec();
+
+    ImpactResult result;
+    Real dt = SMIN(block_computing_time_step_size.exec(), impactor_computing_time_step_size.exec());
+    while (GlobalStaticVariables::physical_time_ < end_time)
+    {
+        block_update_contact_density.exec();
+        impactor_update_contact_density.exec();
+        block_compute_contact_forces.exec();
+        impactor_compute_contact_forces.exec();
+
+        if (use_sleeping_particles)
+        {
+            update_particle_activity.exec();
+            active_block_stress_relaxation_first_half.exec(dt);
+            active_block_stress_relaxation_second_half.exec(dt);
+        }
+        else
+        {
+            block_stress_relaxation_first_half.exec(dt);
+            block_stress_relaxation_second_half.exec(dt);
+        }
+        impactor_stress_relaxation_first_half.exec(dt);
+        impactor_stress_relaxation_second_half.exec(dt);
+
+        GlobalStaticVariables::physical_time_ += dt;
+        if (GlobalStaticVariables::physical_time_ < time_before_impact)
+            result.sleeping_before_impact_ = active_particles.NumberOfSleepingParticles();
+
+        dt = SMIN(block_computing_time_step_size.exec(), impactor_computing_time_step_size.exec());
+        block.updateCellLinkedList();
+        impactor.updateCellLinkedList();
+        block_impactor_contact.updateConfiguration();
+        impactor_block_contact.updateConfiguration();
+    }
+    result.sleeping_after_impact_ = active_particles.NumberOfSleepingParticles();
+
+    BaseParticles &particles = block.getBaseParticles();
+    size_t total_real_particles = particles.TotalRealParticles();
+    StdLargeVec<Vecd> &pos = *particles.getVariableDataByName<Vecd>("Position");
+    StdLargeVec<Vecd> &vel = *particles.getVariableDataByName<Vecd>("Velocity");
+    result.block_position_.assign(pos.begin(), pos.begin() + total_real_particles);
+    result.block_velocity_.assign(vel.begin(), vel.begin() + total_real_particles);
+    return result;
+}
+
+TEST(test_SleepingParticles, test_wokenByImpact)
+{
+    ImpactResult awake_result = runImpact(false);
+    ImpactResult sleeping_result = runImpact(true);
+    size_t number_of_particles = awake_result.block_position_.size();
+    ASSERT_EQ(sleeping_result.block_position_.size(), number_of_particles);
+
+    // the resting block falls asleep completely before the impact and is waken up by it
+    EXPECT_EQ(sleeping_result.sleeping_before_impact_, number_of_particles);
+    EXPECT_LT(sleeping_result.sleeping_after_impact_, number_of_particles);
+
+    // the block responds to the impact as without sleeping particles
+    Real max_velocity = 0.0;
+    Real max_velocity_difference = 0.0;
+    Real max_position_difference = 0.0;
+    for (size_t i = 0; i != number_of_particles; ++i)
+    {
+        max_velocity = SMAX(max_velocity, awake_result.block_velocity_[i].norm());
+        max_velocity_difference = SMAX(max_velocity_difference,
+                                       (sleeping_result.block_velocity_[i] - awake_result.block_velocity_[i]).norm());
+        max_position_difference = SMAX(max_position_difference,
+                                       (sleeping_result.block_position_[i] - awake_result.block_position_[i]).norm());
+    }
+    EXPECT_GT(max_velocity, 0.1 * impact_velocity);
+    EXPECT_LT(max_velocity_difference, 0.02 * max_velocity);
+    EXPECT_LT(max_position_difference, 0.01 * resolution_ref);
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,102 @@
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+using namespace relax_dynamics;
+
+Real resolution_ref = 0.05;
+BoundingBox system_domain_bounds(Vec3d(-0.5, -0.5, -0.5), Vec3d(0.5, 0.5, 0.5));
+Vec3d halfsize_block(0.3, 0.3, 0.3);
+size_t check_interval = 20;
+size_t max_iterations = 2000;
+
+TEST(test_RelaxationUntilConvergence, test_stopBeforeMaxIterations)
+{
+    SPHSystem sph_system(system_domain_bounds, resolution_ref);
+    RealBody block(sph_system, makeShared<GeometricShapeBox>(halfsize_block, "Block"));
+    block.defineBodyLevelSetShape();
+    block.generateParticles<BaseParticles, Lattice>();
+    InnerRelation block_inner(block);
+    SimpleDynamics<RandomizeParticlePosition> random_block_particles(block);
+    RelaxationUntilConvergence<RelaxationStepInner> relaxation(block_inner);
+    relaxation.setConvergenceCriteria(0.01, check_interval, max_iterations);
+
+    sph_system.initializeSystemCellLinkedLists();
+    sph_system.initializeSystemConfigurations();
+    random_block_particles.exec(0.25);
+    relaxation.getRelaxationStep().SurfaceBounding().exec();
+
+    // the residue of the randomized particles is reduced until it stagnates
+    size_t iterations = relaxation.exec();
+    Real stagnated_norm = relaxation.ResidueNorm();
+    EXPECT_LT(iterations, max_iterations);
+    EXPECT_GT(iterations, check_interval);
+    EXPECT_EQ(iterations % check_interval, size_t(0));
+    EXPECT_FALSE(relaxation.isConverged());
+
+    // an absolute tolerance above the reached residue stops at the first check
+    relaxation.setConvergenceCriteria(0.01, check_interval, max_iterations, 2.0 * stagnated_norm);
+    EXPECT_EQ(relaxation.exec(), check_interval);
+    EXPECT_TRUE(relaxation.isConverged());
+    EXPECT_LT(relaxation.ResidueNorm(), 2.0 * stagnated_norm);
+}
+
+TEST(test_ParticleGeneratorSplit, test_childrenAndVolume)
+{
+    SPHSystem sph_system(system_domain_bounds, resolution_ref);
+    // the coarse body has the doubled spacing, so that each particle is split into 2^3 children
+    RealBody coarse_block(sph_system, makeShared<GeometricShapeBox>(halfsize_block, "CoarseBlock"));
+    coarse_block.defineAdaptationRatios(1.15, 0.5);
+    coarse_block.generateParticles<BaseParticles, Lattice>();
+    RealBody block(sph_system, makeShared<GeometricShapeBox>(halfsize_block, "Block"));
+    block.generateParticles<BaseParticles, Split>(coarse_block);
+    RealBody lattice_block(sph_system, makeShared<GeometricShapeBox>(halfsize_block, "LatticeBlock"));
+    lattice_block.generateParticles<BaseParticles, Lattice>();
+
+    BaseParticles &coarse_particles = coarse_block.getBaseParticles();
+    BaseParticles &particles = block.getBaseParticles();
+    size_t number_of_children = 8;
+    size_t number_of_coarse_particles = coarse_particles.TotalRealParticles();
+    ASSERT_GT(number_of_coarse_particles, size_t(0));
+    ASSERT_EQ(particles.TotalRealParticles(), number_of_children * number_of_coarse_particles);
+
+    // the children of a coarse particle are stored together and centered at it
+    StdLargeVec<Vecd> &coarse_pos = *coarse_particles.getVariableDataByName<Vecd>("Position");
+    StdLargeVec<Vecd> &pos = *particles.getVariableDataByName<Vecd>("Position");
+    for (size_t i = 0; i != number_of_coarse_particles; ++i)
+    {
+        Vecd children_center = Vecd::Zero();
+        for (size_t n = 0; n != number_of_children; ++n)
+            children_center += pos[i * number_of_children + n] / Real(number_of_children);
+        EXPECT_LT((children_center - coarse_pos[i]).norm(), 1.0e-12);
+    }
+
+    // the volume is conserved by the split
+    StdLargeVec<Real> &coarse_Vol = *coarse_particles.getVariableDataByName<Real>("VolumetricMeasure");
+    StdLargeVec<Real> &Vol = *particles.getVariableDataByName<Real>("VolumetricMeasure");
+    Real coarse_volume = 0.0;
+    for (size_t i = 0; i != number_of_coarse_particles; ++i)
+        coarse_volume += coarse_Vol[i];
+    Real volume = 0.0;
+    for (size_t i = 0; i != particles.TotalRealParticles(); ++i)
+        volume += Vol[i];
+    EXPECT_NEAR(volume, coarse_volume, 1.0e-10 * coarse_volume);
+
+    // splitting the coarse lattice gives the fine lattice
+    BaseParticles &lattice_particles = lattice_block.getBaseParticles();
+    StdLargeVec<Vecd> &lattice_pos = *lattice_particles.getVariableDataByName<Vecd>("Position");
+    ASSERT_EQ(lattice_particles.TotalRealParticles(), particles.TotalRealParticles());
+    for (size_t i = 0; i != particles.TotalRealParticles(); ++i)
+    {
+        Real min_distance = MaxReal;
+        for (size_t j = 0; j != lattice_particles.TotalRealParticles(); ++j)
+            min_distance = SMIN(min_distance, (pos[i] - lattice_pos[j]).norm());
+        EXPECT_LT(min_distance, 1.0e-12);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,69 @@
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+Real resolution_ref = 0.04;
+BoundingBox system_domain_bounds(Vec3d(-1.0, -1.0, -1.0), Vec3d(1.0, 1.0, 1.0));
+
+/** a ball with a box cut out, so that the lattice has outside, inside and cut blocks */
+class BallWithHole : public ComplexShape
+{
+  public:
+    explicit BallWithHole(const std::string &shape_name) : ComplexShape(shape_name)
+    {
+        add<GeometricShapeBall>(Vec3d(0.1, -0.05, 0.02), 0.75);
+        subtract<TransformShape<GeometricShapeBox>>(Transform(Vec3d(0.3, 0.2, 0.0)), Vec3d(0.2, 0.15, 0.9));
+    }
+};
+
+StdVec<Vecd> generateLatticePositions(SPHSystem &sph_system, const std::string &body_name)
+{
+    SolidBody body(sph_system, makeShared<BallWithHole>(body_name));
+    body.defineMaterial<Solid>();
+    body.generateParticles<BaseParticles, Lattice>();
+    BaseParticles &particles = body.getBaseParticles();
+    StdLargeVec<Vecd> &pos = *particles.getVariableDataByName<Vecd>("Position");
+    return StdVec<Vecd>(pos.begin(), pos.begin() + particles.TotalRealParticles());
+}
+
+TEST(test_ParticleGeneratorLattice, test_positionsAndOrder)
+{
+    SPHSystem sph_system(system_domain_bounds, resolution_ref);
+    StdVec<Vecd> positions = generateLatticePositions(sph_system, "Ball");
+
+    // brute force: each lattice point is checked in the lexicographic lattice order
+    BallWithHole shape("Reference");
+    BaseMesh mesh(system_domain_bounds, resolution_ref, 0);
+    Arrayi number_of_lattices = mesh.AllCellsFromAllGridPoints(mesh.AllGridPoints());
+    StdVec<Vecd> reference_positions;
+    for (int i = 0; i < number_of_lattices[0]; ++i)
+        for (int j = 0; j < number_of_lattices[1]; ++j)
+            for (int k = 0; k < number_of_lattices[2]; ++k)
+            {
+                Vecd lattice_position = mesh.CellPositionFromIndex(Arrayi(i, j, k));
+                if (shape.checkContain(lattice_position))
+                    reference_positions.push_back(lattice_position);
+            }
+
+    EXPECT_GT(reference_positions.size(), size_t(10000));
+    ASSERT_EQ(positions.size(), reference_positions.size());
+    for (size_t i = 0; i != positions.size(); ++i)
+    {
+        EXPECT_EQ(positions[i], reference_positions[i]);
+    }
+
+    // a second run gives the same particles in the same order
+    StdVec<Vecd> second_positions = generateLatticePositions(sph_system, "SecondBall");
+    ASSERT_EQ(second_positions.size(), positions.size());
+    for (size_t i = 0; i != positions.size(); ++i)
+    {
+        EXPECT_EQ(second_positions[i], positions[i]);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
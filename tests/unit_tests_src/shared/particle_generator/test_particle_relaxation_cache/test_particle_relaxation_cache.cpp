@@ -0,0 +1,147 @@
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+using namespace relax_dynamics;
+
+BoundingBox system_domain_bounds(Vec3d(-0.5, -0.5, -0.5), Vec3d(0.5, 0.5, 0.5));
+
+struct RelaxationSetup
+{
+    Real resolution_ = 0.05;
+    Real halfsize_ = 0.25;
+    size_t check_interval_ = 20;
+};
+
+struct RelaxationRecord
+{
+    bool is_loaded_ = false;
+    size_t iterations_ = 0;
+    std::string cache_file_path_;
+    StdLargeVec<Vecd> position_;
+    StdLargeVec<Real> volumetric_measure_;
+};
+
+/** one run of a simulation relaxing a block with the relaxation cache switched on */
+RelaxationRecord relaxBlock(const RelaxationSetup &setup)
+{
+    SPHSystem sph_system(system_domain_bounds, setup.resolution_);
+    sph_system.setRelaxationCache(true);
+    sph_system.setIOEnvironment();
+    RealBody block(sph_system, makeShared<GeometricShapeBox>(setup.halfsize_ * Vec3d::Ones(), "Block"));
+    block.defineBodyLevelSetShape();
+    block.generateParticles<BaseParticles, Cached, Lattice>("Inner");
+    InnerRelation block_inner(block);
+    SimpleDynamics<RandomizeParticlePosition> random_block_particles(block);
+    RelaxationUntilConvergence<RelaxationStepInner> relaxation(block_inner);
+    relaxation.setConvergenceCriteria(0.01, setup.check_interval_, 1000);
+
+    sph_system.initializeSystemCellLinkedLists();
+    sph_system.initializeSystemConfigurations();
+    RelaxationRecord record;
+    ParticleRelaxationCache &relaxation_cache = *block.getRelaxationCache();
+    record.is_loaded_ = relaxation_cache.isLoaded();
+    record.cache_file_path_ = relaxation_cache.CacheFilePath();
+    if (!record.is_loaded_)
+    {
+        random_block_particles.exec(0.25);
+        relaxation.getRelaxationStep().SurfaceBounding().exec();
+    }
+    record.iterations_ = relaxation.exec();
+
+    BaseParticles &particles = block.getBaseParticles();
+    StdLargeVec<Vecd> &pos = *particles.getVariableDataByName<Vecd>("Position");
+    StdLargeVec<Real> &Vol = *particles.getVariableDataByName<Real>("VolumetricMeasure");
+    record.position_.assign(pos.begin(), pos.begin() + particles.TotalRealParticles());
+    record.volumetric_measure_.assign(Vol.begin(), Vol.begin() + particles.TotalRealParticles());
+    return record;
+}
+
+size_t countCacheFiles(const std::string &cache_folder)
+{
+    size_t number_of_files = 0;
+    if (fs::exists(cache_folder))
+    {
+        for (const auto &entry : fs::directory_iterator(cache_folder))
+        {
+            if (entry.is_regular_file())
+                number_of_files++;
+        }
+    }
+    return number_of_files;
+}
+
+class test_ParticleRelaxationCache : public testing::Test
+{
+  protected:
+    std::string cache_folder_ = "./cache/relaxation";
+    RelaxationSetup setup_;
+    RelaxationRecord first_record_;
+
+    void SetUp() override
+    {
+        fs::remove_all(cache_folder_);
+        first_record_ = relaxBlock(setup_);
+    }
+};
+
+TEST_F(test_ParticleRelaxationCache, test_missWritesFile)
+{
+    EXPECT_FALSE(first_record_.is_loaded_);
+    EXPECT_GT(first_record_.iterations_, size_t(0));
+    EXPECT_TRUE(fs::exists(first_record_.cache_file_path_));
+    EXPECT_EQ(countCacheFiles(cache_folder_), size_t(1));
+}
+
+TEST_F(test_ParticleRelaxationCache, test_hitRestoresParticles)
+{
+    RelaxationRecord record = relaxBlock(setup_);
+    EXPECT_TRUE(record.is_loaded_);
+    EXPECT_EQ(record.iterations_, size_t(0));
+    EXPECT_EQ(countCacheFiles(cache_folder_), size_t(1));
+    ASSERT_EQ(record.position_.size(), first_record_.position_.size());
+    for (size_t i = 0; i != record.position_.size(); ++i)
+    {
+        EXPECT_EQ(record.position_[i], first_record_.position_[i]);
+        EXPECT_EQ(record.volumetric_measure_[i], first_record_.volumetric_measure_[i]);
+    }
+}
+
+TEST_F(test_ParticleRelaxationCache, test_changedSetupIsStale)
+{
+    // a changed spacing or shape has its own cache file
+    RelaxationSetup finer_setup = setup_;
+    finer_setup.resolution_ = 0.04;
+    RelaxationRecord finer_record = relaxBlock(finer_setup);
+    EXPECT_FALSE(finer_record.is_loaded_);
+    EXPECT_GT(finer_record.iterations_, size_t(0));
+    EXPECT_NE(finer_record.cache_file_path_, first_record_.cache_file_path_);
+
+    RelaxationSetup larger_setup = setup_;
+    larger_setup.halfsize_ = 0.3;
+    RelaxationRecord larger_record = relaxBlock(larger_setup);
+    EXPECT_FALSE(larger_record.is_loaded_);
+    EXPECT_GT(larger_record.iterations_, size_t(0));
+    EXPECT_NE(larger_record.cache_file_path_, first_record_.cache_file_path_);
+    EXPECT_EQ(countCacheFiles(cache_folder_), size_t(3));
+
+    // particles relaxed with other settings are only the initial guess and are relaxed again
+    RelaxationSetup other_relaxation_setup = setup_;
+    other_relaxation_setup.check_interval_ = 10;
+    RelaxationRecord other_relaxation_record = relaxBlock(other_relaxation_setup);
+    EXPECT_TRUE(other_relaxation_record.is_loaded_);
+    EXPECT_GT(other_relaxation_record.iterations_, size_t(0));
+    EXPECT_EQ(other_relaxation_record.cache_file_path_, first_record_.cache_file_path_);
+
+    // and are cached for these settings afterwards
+    RelaxationRecord repeated_record = relaxBlock(other_relaxation_setup);
+    EXPECT_TRUE(repeated_record.is_loaded_);
+    EXPECT_EQ(repeated_record.iterations_, size_t(0));
+    EXPECT_EQ(countCacheFiles(cache_folder_), size_t(3));
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
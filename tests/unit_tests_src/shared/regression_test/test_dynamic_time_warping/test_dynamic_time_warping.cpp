@@ -0,0 +1,95 @@
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+#include <random>
+
+using namespace SPH;
+
+/** gives access to the distance of two series, which is protected in the regression test */
+template <typename VariableType>
+class DynamicTimeWarping : public RegressionTestDynamicTimeWarping<ObservedQuantityRecording<VariableType>>
+{
+  public:
+    using RegressionTestDynamicTimeWarping<ObservedQuantityRecording<VariableType>>::calculateDTWDistance;
+};
+
+Real pNorm(Real a, Real b) { return std::abs(a - b); };
+Real pNorm(const Vecd &a, const Vecd &b) { return (a - b).norm(); };
+
+/** the dense [a_length, b_length] matrix, with the entries outside of the window left zero */
+template <typename VariableType>
+Real referenceDTWDistance(const StdVec<VariableType> &series_a, const StdVec<VariableType> &series_b, int window_size)
+{
+    int a_length = series_a.size();
+    int b_length = series_b.size();
+    BiVector<Real> local_dtw_distance(a_length, StdVec<Real>(b_length, 0));
+    local_dtw_distance[0][0] = pNorm(series_a[0], series_b[0]);
+    for (int index_i = 1; index_i < a_length; ++index_i)
+        local_dtw_distance[index_i][0] = local_dtw_distance[index_i - 1][0] + pNorm(series_a[index_i], series_b[0]);
+    for (int index_j = 1; index_j < b_length; ++index_j)
+        local_dtw_distance[0][index_j] = local_dtw_distance[0][index_j - 1] + pNorm(series_a[0], series_b[index_j]);
+
+    window_size = SMAX(window_size, ABS(a_length - b_length));
+    for (int index_i = 1; index_i != a_length; ++index_i)
+        for (int index_j = SMAX(1, index_i - window_size); index_j < SMIN(b_length, index_i + window_size); ++index_j)
+            local_dtw_distance[index_i][index_j] = pNorm(series_a[index_i], series_b[index_j]) +
+                                                   SMIN(local_dtw_distance[index_i - 1][index_j],
+                                                        local_dtw_distance[index_i][index_j - 1],
+                                                        local_dtw_distance[index_i - 1][index_j - 1]);
+    return local_dtw_distance[a_length - 1][b_length - 1];
+}
+
+std::mt19937 random_engine(2024);
+Real randomReal() { return std::uniform_real_distribution<Real>(-1.0, 1.0)(random_engine); };
+Vecd randomVecd()
+{
+    Vecd value;
+    for (int i = 0; i != Dimensions; ++i)
+        value[i] = randomReal();
+    return value;
+};
+
+/** a noisy sine, so that the series are similar but not identical */
+template <typename VariableType, typename RandomFunction>
+StdVec<VariableType> randomSeries(int length, const VariableType &direction, RandomFunction random_function)
+{
+    StdVec<VariableType> series;
+    for (int i = 0; i != length; ++i)
+        series.push_back(sin(0.2 * Real(i)) * direction + 0.1 * random_function());
+    return series;
+}
+
+template <typename VariableType, typename RandomFunction>
+void expectSameAsReference(const VariableType &direction, RandomFunction random_function)
+{
+    // pairs of equal and of different lengths within the allowed change of 10%
+    StdVec<std::pair<int, int>> lengths = {{60, 60}, {60, 64}, {64, 59}, {1, 1}, {7, 7}};
+    for (int trial = 0; trial != 5; ++trial)
+        for (const auto &length : lengths)
+        {
+            StdVec<VariableType> series_a = randomSeries(length.first, direction, random_function);
+            StdVec<VariableType> series_b = randomSeries(length.second, direction, random_function);
+            int without_window = SMAX(length.first, length.second);
+            for (int window_size : {1, 5, without_window})
+            {
+                EXPECT_EQ(DynamicTimeWarping<VariableType>::calculateDTWDistance(series_a, series_b, window_size),
+                          referenceDTWDistance(series_a, series_b, window_size));
+            }
+            EXPECT_EQ(DynamicTimeWarping<VariableType>::calculateDTWDistance(series_a, series_a, 5), 0.0);
+        }
+}
+
+TEST(test_DynamicTimeWarping, test_scalarSeries)
+{
+    expectSameAsReference(Real(1), randomReal);
+}
+
+TEST(test_DynamicTimeWarping, test_vectorSeries)
+{
+    expectSameAsReference(Vecd(Vecd::Ones()), randomVecd);
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}